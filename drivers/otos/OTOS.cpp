@@ -15,6 +15,7 @@
 #include "ztimer.h"
 
 #include <cstring>
+#include <inttypes.h>
 
 #define ENABLE_DEBUG 0
 #include <debug.h>
@@ -25,15 +26,33 @@ namespace otos {
 /// Position LSB to mm conversion factor
 static constexpr float POS_LSB_TO_MM = POS_LSB_TO_METERS * METERS_TO_MM;
 
-/// Heading LSB to degrees conversion factor
-static constexpr float HEADING_LSB_TO_DEG = HEADING_LSB_TO_RAD * RAD_TO_DEG;
-
 /// Inverse factors for writing
 static constexpr float MM_TO_POS_LSB = 1.0f / POS_LSB_TO_MM;
-static constexpr float DEG_TO_HEADING_LSB = 1.0f / HEADING_LSB_TO_DEG;
+static constexpr float RAD_TO_HEADING_LSB = 1.0f / HEADING_LSB_TO_RAD;
+
+/// Velocity LSB to mm/s conversion factor
+static constexpr float VEL_LSB_TO_MM_PER_S = VEL_LSB_TO_MPS * METERS_TO_MM;
 
-OTOS::OTOS(soft_i2c_t i2c_dev, uint8_t i2c_addr)
-    : i2c_dev_(i2c_dev), i2c_addr_(i2c_addr), pose_{}, velocity_{}, acceleration_{}
+/// Acceleration LSB to mm/s² conversion factor
+static constexpr float ACC_LSB_TO_MM_PER_S2 = ACC_LSB_TO_MPSS * METERS_TO_MM;
+
+/// @brief Convert 6 bytes (3x little endian int16) to Pose2D
+/// @param buf Raw register block
+/// @param pos_scale Position scale factor (LSB to mm)
+/// @param heading_scale Heading scale factor (LSB to rad)
+/// @return Converted pose
+static Pose2D decode_pose2d(const uint8_t* buf, float pos_scale, float heading_scale)
+{
+    auto raw_x = static_cast<int16_t>(buf[0] | (buf[1] << 8));
+    auto raw_y = static_cast<int16_t>(buf[2] | (buf[3] << 8));
+    auto raw_h = static_cast<int16_t>(buf[4] | (buf[5] << 8));
+
+    return {static_cast<float>(raw_x) * pos_scale, static_cast<float>(raw_y) * pos_scale,
+            static_cast<float>(raw_h) * heading_scale};
+}
+
+OTOS::OTOS(soft_i2c_t i2c_dev, uint8_t i2c_addr, bool read_acceleration)
+    : i2c_dev_(i2c_dev), i2c_addr_(i2c_addr), read_acceleration_(read_acceleration), sample_{}
 {
 }
 
@@ -71,23 +90,29 @@ int OTOS::init()
 
 int OTOS::update()
 {
-    int ret = read_pose2d(REG_POS_XL, pose_, POS_LSB_TO_MM, HEADING_LSB_TO_DEG);
+    // Position, velocity and acceleration registers are contiguous: read the
+    // needed ones in a single transaction instead of one per block
+    uint8_t buf[BURST_POS_VEL_ACC_LEN];
+    const size_t len = read_acceleration_ ? BURST_POS_VEL_ACC_LEN : BURST_POS_VEL_LEN;
+
+    const uint32_t start_us = ztimer_now(ZTIMER_USEC);
+    int ret = read_regs(REG_POS_XL, buf, len);
+    const uint32_t io_time_us = ztimer_now(ZTIMER_USEC) - start_us;
     if (ret < 0) {
         return ret;
     }
 
-    ret = read_pose2d(REG_VEL_XL, velocity_, POS_LSB_TO_MM, HEADING_LSB_TO_DEG);
-    if (ret < 0) {
-        return ret;
+    sample_.pose = decode_pose2d(buf, POS_LSB_TO_MM, HEADING_LSB_TO_RAD);
+    sample_.velocity =
+        decode_pose2d(&buf[REG_VEL_XL - REG_POS_XL], VEL_LSB_TO_MM_PER_S, VEL_HEADING_LSB_TO_RADPS);
+    if (read_acceleration_) {
+        sample_.acceleration = decode_pose2d(&buf[REG_ACC_XL - REG_POS_XL], ACC_LSB_TO_MM_PER_S2,
+                                             ACC_HEADING_LSB_TO_RADPSS);
     }
+    sample_.io_time_us = io_time_us;
 
-    ret = read_pose2d(REG_ACC_XL, acceleration_, POS_LSB_TO_MM, HEADING_LSB_TO_DEG);
-    if (ret < 0) {
-        return ret;
-    }
-
-    DEBUG("OTOS: x=%.1f y=%.1f h=%.1f\n", static_cast<double>(pose_.x),
-          static_cast<double>(pose_.y), static_cast<double>(pose_.h));
+    DEBUG("OTOS: x=%.1f y=%.1f h=%.3f io=%" PRIu32 "us\n", static_cast<double>(sample_.pose.x),
+          static_cast<double>(sample_.pose.y), static_cast<double>(sample_.pose.h), io_time_us);
 
     return 0;
 }
@@ -105,14 +130,14 @@ int OTOS::set_angular_scalar(float scalar)
     return write_reg(REG_SCALAR_ANGULAR, static_cast<uint8_t>(raw));
 }
 
-int OTOS::set_offset(float x_mm, float y_mm, float h_deg)
+int OTOS::set_offset(float x_mm, float y_mm, float h_rad)
 {
-    return write_pose2d(REG_OFFSET_XL, x_mm, y_mm, h_deg, MM_TO_POS_LSB, DEG_TO_HEADING_LSB);
+    return write_pose2d(REG_OFFSET_XL, x_mm, y_mm, h_rad, MM_TO_POS_LSB, RAD_TO_HEADING_LSB);
 }
 
-int OTOS::set_position(float x_mm, float y_mm, float h_deg)
+int OTOS::set_position(float x_mm, float y_mm, float h_rad)
 {
-    return write_pose2d(REG_POS_XL, x_mm, y_mm, h_deg, MM_TO_POS_LSB, DEG_TO_HEADING_LSB);
+    return write_pose2d(REG_POS_XL, x_mm, y_mm, h_rad, MM_TO_POS_LSB, RAD_TO_HEADING_LSB);
 }
 
 int OTOS::calibrate_imu(uint8_t num_samples)
@@ -176,31 +201,12 @@ int OTOS::write_reg(uint8_t reg, uint8_t value)
     return write_regs(reg, &value, 1);
 }
 
-int OTOS::read_pose2d(uint8_t start_reg, Pose2D& out, float pos_scale, float heading_scale)
-{
-    uint8_t buf[6];
-    int ret = read_regs(start_reg, buf, sizeof(buf));
-    if (ret < 0) {
-        return ret;
-    }
-
-    auto raw_x = static_cast<int16_t>(buf[0] | (buf[1] << 8));
-    auto raw_y = static_cast<int16_t>(buf[2] | (buf[3] << 8));
-    auto raw_h = static_cast<int16_t>(buf[4] | (buf[5] << 8));
-
-    out.x = static_cast<float>(raw_x) * pos_scale;
-    out.y = static_cast<float>(raw_y) * pos_scale;
-    out.h = static_cast<float>(raw_h) * heading_scale;
-
-    return 0;
-}
-
-int OTOS::write_pose2d(uint8_t start_reg, float x_mm, float y_mm, float h_deg, float pos_scale,
+int OTOS::write_pose2d(uint8_t start_reg, float x_mm, float y_mm, float h_rad, float pos_scale,
                        float heading_scale)
 {
     auto raw_x = static_cast<int16_t>(x_mm * pos_scale);
     auto raw_y = static_cast<int16_t>(y_mm * pos_scale);
-    auto raw_h = static_cast<int16_t>(h_deg * heading_scale);
+    auto raw_h = static_cast<int16_t>(h_rad * heading_scale);
 
     uint8_t buf[6] = {
         static_cast<uint8_t>(raw_x & 0xFF), static_cast<uint8_t>((raw_x >> 8) & 0xFF),
@@ -19,39 +19,53 @@ namespace cogip {
 namespace otos {
 
 /// @brief Low-level driver for the SparkFun OTOS sensor (PAA5160E1 + IMU)
-/// @details Communicates via software I2C (GPIO bitbanging)
+/// @details Communicates via software I2C (GPIO bitbanging). Each update
+///          reads all tracking data in a single burst transaction. The
+///          accessors are meant for the thread calling update().
 class OTOS
 {
   public:
     /// @brief Constructor
     /// @param i2c_dev Software I2C bus index (e.g., SOFT_I2C_DEV(0))
     /// @param i2c_addr 7-bit I2C address (default 0x17)
-    explicit OTOS(soft_i2c_t i2c_dev, uint8_t i2c_addr = OTOS_DEFAULT_ADDR);
+    /// @param read_acceleration Also read acceleration registers on update
+    explicit OTOS(soft_i2c_t i2c_dev, uint8_t i2c_addr = OTOS_DEFAULT_ADDR,
+                  bool read_acceleration = false);
 
     /// @brief Initialize the sensor (verify product ID, soft reset, configure)
     /// @return 0 on success, negative on error
     int init();
 
-    /// @brief Read pose, velocity and acceleration from sensor
+    /// @brief Read pose and velocity, and acceleration if enabled, in one
+    ///        burst transaction
+    /// @details Waits for the end of the transfer, the calling thread clocks the bus.
     /// @return 0 on success, negative on I2C error
     int update();
 
     /// @brief Get latest pose (valid after update())
     const Pose2D& pose() const
     {
-        return pose_;
+        return sample_.pose;
     }
 
     /// @brief Get latest velocity (valid after update())
     const Pose2D& velocity() const
     {
-        return velocity_;
+        return sample_.velocity;
     }
 
     /// @brief Get latest acceleration (valid after update())
+    /// @note Stays zero unless acceleration reading is enabled
     const Pose2D& acceleration() const
     {
-        return acceleration_;
+        return sample_.acceleration;
+    }
+
+    /// @brief Get the I2C transfer duration of the latest update
+    /// @return Duration (us)
+    uint32_t io_time_us() const
+    {
+        return sample_.io_time_us;
     }
 
     /// @brief Set the linear distance calibration scalar
@@ -67,16 +81,16 @@ class OTOS
     /// @brief Set the sensor mounting offset relative to robot center
     /// @param x_mm X offset in mm
     /// @param y_mm Y offset in mm
-    /// @param h_deg Heading offset in degrees
+    /// @param h_rad Heading offset in radians
     /// @return 0 on success, negative on error
-    int set_offset(float x_mm, float y_mm, float h_deg);
+    int set_offset(float x_mm, float y_mm, float h_rad);
 
     /// @brief Reset tracking to given position
     /// @param x_mm X position in mm
     /// @param y_mm Y position in mm
-    /// @param h_deg Heading in degrees
+    /// @param h_rad Heading in radians
     /// @return 0 on success, negative on error
-    int set_position(float x_mm, float y_mm, float h_deg);
+    int set_position(float x_mm, float y_mm, float h_rad);
 
     /// @brief Run IMU calibration (blocking, ~612ms)
     /// @note The sensor must be stationary during calibration
@@ -87,9 +101,8 @@ class OTOS
   private:
     soft_i2c_t i2c_dev_;
     uint8_t i2c_addr_;
-    Pose2D pose_;
-    Pose2D velocity_;
-    Pose2D acceleration_;
+    bool read_acceleration_; ///< Acceleration is part of the burst read
+    OTOSSample sample_;      ///< Latest sample
 
     /// @brief Read a register block
     int read_regs(uint8_t reg, uint8_t* buf, size_t len);
@@ -103,23 +116,15 @@ class OTOS
     /// @brief Write a single register byte
     int write_reg(uint8_t reg, uint8_t value);
 
-    /// @brief Read 6 bytes (3x int16) and convert to Pose2D
-    /// @param start_reg Starting register address
-    /// @param out Output pose
-    /// @param pos_scale Position scale factor (LSB to mm)
-    /// @param heading_scale Heading scale factor (LSB to deg)
-    /// @return 0 on success, negative on error
-    int read_pose2d(uint8_t start_reg, Pose2D& out, float pos_scale, float heading_scale);
-
     /// @brief Write 6 bytes (3x int16) from Pose2D values
     /// @param start_reg Starting register address
     /// @param x_mm X in mm
     /// @param y_mm Y in mm
-    /// @param h_deg Heading in degrees
+    /// @param h_rad Heading in radians
     /// @param pos_scale mm to LSB scale
-    /// @param heading_scale deg to LSB scale
+    /// @param heading_scale rad to LSB scale
     /// @return 0 on success, negative on error
-    int write_pose2d(uint8_t start_reg, float x_mm, float y_mm, float h_deg, float pos_scale,
+    int write_pose2d(uint8_t start_reg, float x_mm, float y_mm, float h_rad, float pos_scale,
                      float heading_scale);
 };
 
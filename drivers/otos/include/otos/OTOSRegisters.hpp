@@ -43,22 +43,44 @@ constexpr uint8_t REG_VEL_STDDEV_XL = 0x38;
 constexpr uint8_t REG_ACC_STDDEV_XL = 0x3E;
 /// @}
 
+/// @name Burst read lengths
+/// Position, velocity and acceleration registers are contiguous, so they
+/// are read in a single transaction starting at REG_POS_XL.
+/// @{
+constexpr uint8_t BURST_POS_VEL_LEN = REG_ACC_XL - REG_POS_XL;
+constexpr uint8_t BURST_POS_VEL_ACC_LEN = REG_POS_STDDEV_XL - REG_POS_XL;
+/// @}
+
 /// @name Conversion factors
 /// Position: int16, range +-10m, LSB = 10.0/32768 meters
 /// Heading:  int16, range +-pi rad, LSB = pi/32768 radians
+/// Velocity: int16, range +-5m/s and +-2000deg/s
+/// Acceleration: int16, range +-16g and +-1000pi rad/s²
 /// @{
 constexpr float POS_LSB_TO_METERS = 10.0f / 32768.0f;
 constexpr float HEADING_LSB_TO_RAD = 3.14159265358979323846f / 32768.0f;
+constexpr float VEL_LSB_TO_MPS = 5.0f / 32768.0f;
+constexpr float VEL_HEADING_LSB_TO_RADPS = (2000.0f * 3.14159265358979323846f / 180.0f) / 32768.0f;
+constexpr float ACC_LSB_TO_MPSS = (16.0f * 9.80665f) / 32768.0f;
+constexpr float ACC_HEADING_LSB_TO_RADPSS = (1000.0f * 3.14159265358979323846f) / 32768.0f;
 constexpr float METERS_TO_MM = 1000.0f;
-constexpr float RAD_TO_DEG = 180.0f / 3.14159265358979323846f;
 /// @}
 
 /// 2D pose data structure
 struct Pose2D
 {
-    float x; ///< X position in mm
-    float y; ///< Y position in mm
-    float h; ///< Heading in degrees
+    float x; ///< X position in mm (mm/s, mm/s² for derivatives)
+    float y; ///< Y position in mm (mm/s, mm/s² for derivatives)
+    float h; ///< Heading in radians (rad/s, rad/s² for derivatives)
+};
+
+/// Sensor data read by one update
+struct OTOSSample
+{
+    Pose2D pose;         ///< Position (mm, rad)
+    Pose2D velocity;     ///< Velocity (mm/s, rad/s)
+    Pose2D acceleration; ///< Acceleration (mm/s², rad/s²), zero if not read
+    uint32_t io_time_us; ///< Duration of the I2C transfer (us)
 };
 
 } // namespace otos
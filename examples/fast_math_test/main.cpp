@@ -0,0 +1,185 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @file
+/// @brief Test application for the single precision fast math functions
+/// @details Sweeps each function of fast_math.h, compares it against double
+///          precision libm and checks the maximum absolute error against the
+///          bound documented in fast_math.h:
+///          1. fast_sinf() / fast_cosf() for |x| < 1e4 rad
+///          2. fast_atan2f() on a grid of all quadrants, axes and origin
+///          3. fast_sqrtf() against the correctly rounded sqrtf()
+///          4. fast_floorf() / fast_wrap_rad() / fast_wrap_deg()
+///          Exits with a failure status if any bound is exceeded.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "fast_math.h"
+
+/// Maximum absolute error of fast_sinf() and fast_cosf() (see fast_math.h)
+static constexpr double SIN_COS_MAX_ERROR = 4e-6;
+
+/// Maximum absolute error of fast_atan2f() (see fast_math.h)
+static constexpr double ATAN2_MAX_ERROR = 3e-6;
+
+/// Range of the sin/cos sweep (rad)
+static constexpr double SIN_COS_RANGE = 1e4;
+
+/// Number of points of the sin/cos sweep
+static constexpr int SIN_COS_STEPS = 2000000;
+
+/// Number of points per axis of the atan2 grid
+static constexpr int ATAN2_STEPS = 1001;
+
+/// Failed checks
+static int failures = 0;
+
+/// @brief Print a check result and count failures
+/// @param name Checked function
+/// @param max_error Measured maximum absolute error
+/// @param bound Allowed maximum absolute error
+/// @param worst_x Argument of the maximum error
+static void check(const char* name, double max_error, double bound, double worst_x)
+{
+    const bool ok = max_error <= bound;
+    printf("%-14s max error %.3e at %.6f (bound %.1e): %s\n", name, max_error, worst_x, bound,
+           ok ? "OK" : "FAIL");
+    if (!ok) {
+        failures++;
+    }
+}
+
+/// Test 1: sine and cosine
+static void test_sin_cos()
+{
+    double sin_max = 0.0, cos_max = 0.0;
+    double sin_worst = 0.0, cos_worst = 0.0;
+
+    for (int i = 0; i <= SIN_COS_STEPS; i++) {
+        const float x =
+            static_cast<float>(-SIN_COS_RANGE + 2.0 * SIN_COS_RANGE * i / SIN_COS_STEPS);
+        // Reference on the exact float argument, not on the double it was rounded from
+        const double sin_error = std::fabs(fast_sinf(x) - std::sin(static_cast<double>(x)));
+        const double cos_error = std::fabs(fast_cosf(x) - std::cos(static_cast<double>(x)));
+        if (sin_error > sin_max) {
+            sin_max = sin_error;
+            sin_worst = x;
+        }
+        if (cos_error > cos_max) {
+            cos_max = cos_error;
+            cos_worst = x;
+        }
+    }
+
+    check("fast_sinf", sin_max, SIN_COS_MAX_ERROR, sin_worst);
+    check("fast_cosf", cos_max, SIN_COS_MAX_ERROR, cos_worst);
+}
+
+/// Test 2: arc tangent, including axes, diagonals and origin
+static void test_atan2()
+{
+    double max_error = 0.0;
+    double worst_angle = 0.0;
+
+    for (int i = 0; i < ATAN2_STEPS; i++) {
+        for (int j = 0; j < ATAN2_STEPS; j++) {
+            const float y = static_cast<float>(-1000.0 + 2000.0 * i / (ATAN2_STEPS - 1));
+            const float x = static_cast<float>(-1000.0 + 2000.0 * j / (ATAN2_STEPS - 1));
+            const double ref = std::atan2(static_cast<double>(y), static_cast<double>(x));
+            double error = std::fabs(fast_atan2f(y, x) - ref);
+            // -pi and pi are the same angle
+            error = std::fmin(error, std::fabs(error - 2.0 * M_PI));
+            if (error > max_error) {
+                max_error = error;
+                worst_angle = ref;
+            }
+        }
+    }
+
+    check("fast_atan2f", max_error, ATAN2_MAX_ERROR, worst_angle);
+}
+
+/// Test 3: square root
+static void test_sqrt()
+{
+    double max_error = 0.0;
+    double worst_x = 0.0;
+
+    for (int i = 0; i <= 100000; i++) {
+        const float x = static_cast<float>(i) * 0.37f;
+        const double error = std::fabs(fast_sqrtf(x) - std::sqrt(x));
+        if (error > max_error) {
+            max_error = error;
+            worst_x = x;
+        }
+    }
+    check("fast_sqrtf", max_error, 0.0, worst_x);
+
+    // Negative values are handled as 0
+    check("fast_sqrtf(<0)", std::fabs(fast_sqrtf(-1.0f)), 0.0, -1.0);
+}
+
+/// Test 4: floor and angle wrapping
+static void test_floor_wrap()
+{
+    double floor_max = 0.0, wrap_rad_max = 0.0, wrap_deg_max = 0.0;
+    double floor_worst = 0.0, wrap_rad_worst = 0.0, wrap_deg_worst = 0.0;
+
+    for (int i = -200000; i <= 200000; i++) {
+        const float x = static_cast<float>(i) * 0.0125f;
+        const double floor_error = std::fabs(fast_floorf(x) - std::floor(x));
+        if (floor_error > floor_max) {
+            floor_max = floor_error;
+            floor_worst = x;
+        }
+
+        // Compare the wrapped angles on the circle, and check their range up to the
+        // rounding of x / (2 * pi) documented in fast_math.h
+        const float rad = fast_wrap_rad(x);
+        const double rad_margin = std::fabs(x) * 0x1p-23;
+        double rad_error = std::fabs(std::remainder(rad - static_cast<double>(x), 2.0 * M_PI));
+        if (std::fabs(rad) > FAST_MATH_PI + rad_margin) {
+            rad_error = INFINITY;
+        }
+        if (rad_error > wrap_rad_max) {
+            wrap_rad_max = rad_error;
+            wrap_rad_worst = x;
+        }
+
+        const float deg = fast_wrap_deg(x * 10.0f);
+        double deg_error = std::fabs(std::remainder(deg - static_cast<double>(x * 10.0f), 360.0));
+        if ((deg < -180.0f) || (deg >= 180.0f)) {
+            deg_error = INFINITY;
+        }
+        if (deg_error > wrap_deg_max) {
+            wrap_deg_max = deg_error;
+            wrap_deg_worst = x * 10.0f;
+        }
+    }
+
+    check("fast_floorf", floor_max, 0.0, floor_worst);
+    check("fast_wrap_rad", wrap_rad_max, 1e-5, wrap_rad_worst);
+    check("fast_wrap_deg", wrap_deg_max, 1e-3, wrap_deg_worst);
+}
+
+int main(void)
+{
+    printf("\n=== fast_math test ===\n\n");
+
+    test_sin_cos();
+    test_atan2();
+    test_sqrt();
+    test_floor_wrap();
+
+    if (failures) {
+        printf("\n%d check(s) FAILED\n", failures);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("\nAll checks passed\n");
+    return 0;
+}
@@ -0,0 +1,293 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @file
+/// @brief Test application for LocalizationFused
+/// @details Drives the fused localization with simulated encoders and OTOS
+///          sources and checks its behavior:
+///          1. Prediction from encoders only (OTOS lost)
+///          2. Correction of the encoders drift by OTOS
+///          3. Gating of a single OTOS outlier
+///          4. Re-anchoring on OTOS after too many rejections (robot pushed)
+///          5. OTOS only (encoders lost): OTOS is not counted twice
+///          Exits with a failure status if any check fails.
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "localization/LocalizationFused.hpp"
+#include "localization/LocalizationFusedParameters.hpp"
+
+using cogip::localization::LocalizationFused;
+using cogip::localization::LocalizationFusedParameters;
+using cogip::localization::LocalizationInterface;
+using cogip::localization::PoseCovariance;
+
+/// @brief Simulated localization source
+/// @details Integrates the requested moves like LocalizationDifferential and
+///          returns the configured error on update.
+class SimulatedLocalization : public LocalizationInterface
+{
+  public:
+    void set_pose(float x, float y, float O) override
+    {
+        pose_.set_x(x);
+        pose_.set_y(y);
+        pose_.set_O(O);
+    }
+
+    void set_pose(const cogip::cogip_defs::Pose& pose) override
+    {
+        pose_ = pose;
+    }
+
+    const cogip::cogip_defs::Pose& pose() override
+    {
+        return pose_;
+    }
+
+    const cogip::cogip_defs::Polar& delta_polar_pose() override
+    {
+        return delta_;
+    }
+
+    int init() override
+    {
+        return 0;
+    }
+
+    void reset() override {}
+
+    int update() override
+    {
+        return error_;
+    }
+
+    /// @brief Move along the mean heading of the period
+    /// @param distance Linear delta (mm)
+    /// @param angle Angular delta (rad)
+    void move(float distance, float angle)
+    {
+        const float heading = pose_.O() + 0.5f * angle;
+        pose_.set_x(pose_.x() + distance * std::cos(heading));
+        pose_.set_y(pose_.y() + distance * std::sin(heading));
+        pose_.set_O(pose_.O() + angle);
+        delta_.set_distance(distance);
+        delta_.set_angle(angle);
+    }
+
+    /// @brief Move the pose without reporting any delta (pushed robot, outlier)
+    /// @param dx X shift (mm)
+    /// @param dy Y shift (mm)
+    void shift(float dx, float dy)
+    {
+        pose_.set_x(pose_.x() + dx);
+        pose_.set_y(pose_.y() + dy);
+    }
+
+    /// @brief Set the error returned by update(), 0 for a working source
+    void set_error(int error)
+    {
+        error_ = error;
+    }
+
+  private:
+    cogip::cogip_defs::Pose pose_;
+    cogip::cogip_defs::Polar delta_;
+    int error_ = 0;
+};
+
+/// Fewer rejections than the default before re-anchoring, to keep the test short
+static constexpr unsigned max_rejected_corrections = 5;
+
+/// OTOS position standard deviation (mm)
+static constexpr float otos_position_stddev_mm = 5.0f;
+
+static LocalizationFusedParameters parameters(0.01f, 0.02f, 0.0001f, otos_position_stddev_mm,
+                                              0.01f, 16.0f, max_rejected_corrections);
+
+static SimulatedLocalization encoders;
+static SimulatedLocalization otos;
+static LocalizationFused fused(encoders, otos, parameters);
+
+/// Failed checks
+static int failures = 0;
+
+/// @brief Print a check result and count failures
+static void check(const char* name, bool ok)
+{
+    printf("  %-60s %s\n", name, ok ? "OK" : "FAIL");
+    if (!ok) {
+        failures++;
+    }
+}
+
+/// @brief Variance of x of the fused pose
+static float variance_x()
+{
+    PoseCovariance covariance;
+    fused.pose_covariance(covariance);
+    return covariance.xx;
+}
+
+/// @brief Move both sources, then update the fused localization
+/// @param encoders_distance Linear delta measured by encoders (mm)
+/// @param otos_distance Linear delta measured by OTOS (mm)
+/// @param angle Angular delta of both sources (rad)
+/// @return Fused localization update result
+static int step(float encoders_distance, float otos_distance, float angle = 0.0f)
+{
+    encoders.move(encoders_distance, angle);
+    otos.move(otos_distance, angle);
+    return fused.update();
+}
+
+/// @brief Restart from the origin with both sources working
+static void restart()
+{
+    encoders.set_error(0);
+    otos.set_error(0);
+    fused.set_pose(0.0f, 0.0f, 0.0f);
+}
+
+/// Test 1: dead reckoning from encoders, covariance grows
+static void test_prediction()
+{
+    printf("\nTest 1: prediction from encoders only\n");
+    restart();
+    otos.set_error(-EIO);
+
+    bool growing = true;
+    float previous_variance = variance_x();
+    for (int i = 0; i < 100; i++) {
+        step(10.0f, 0.0f);
+        growing = growing && (variance_x() > previous_variance);
+        previous_variance = variance_x();
+    }
+    for (int i = 0; i < 10; i++) {
+        step(0.0f, 0.0f, static_cast<float>(M_PI) / 20.0f);
+    }
+    for (int i = 0; i < 10; i++) {
+        step(10.0f, 0.0f);
+    }
+
+    const auto& pose = fused.pose();
+    check("pose reaches (1000, 100, pi/2)",
+          std::fabs(pose.x() - 1000.0f) < 0.5f && std::fabs(pose.y() - 100.0f) < 0.5f &&
+              std::fabs(pose.O() - static_cast<float>(M_PI) / 2.0f) < 1e-4f);
+    check("x variance grows while moving", growing);
+    check("update succeeds without OTOS", fused.update() == 0);
+}
+
+/// Test 2: OTOS corrects the encoders slip
+static void test_correction()
+{
+    printf("\nTest 2: correction of the encoders drift\n");
+    restart();
+
+    // Encoders overestimate the travelled distance by 1%
+    for (int i = 0; i < 200; i++) {
+        step(10.1f, 10.0f);
+    }
+
+    const float error = std::fabs(fused.pose().x() - otos.pose().x());
+    printf("  fused x=%.1f, OTOS x=%.1f, encoders x=%.1f\n",
+           static_cast<double>(fused.pose().x()), static_cast<double>(otos.pose().x()),
+           static_cast<double>(encoders.pose().x()));
+    check("fused pose stays within 5 mm of OTOS (encoders drift 20 mm)", error < 5.0f);
+    check("x variance stays below the OTOS variance",
+          variance_x() < otos_position_stddev_mm * otos_position_stddev_mm);
+}
+
+/// Test 3: a single OTOS outlier is rejected
+static void test_gating()
+{
+    printf("\nTest 3: gating of an OTOS outlier\n");
+    restart();
+    for (int i = 0; i < 20; i++) {
+        step(10.0f, 10.0f);
+    }
+
+    const float y = fused.pose().y();
+    otos.shift(0.0f, 300.0f);
+    step(10.0f, 10.0f);
+    check("outlier does not move the pose", std::fabs(fused.pose().y() - y) < 1.0f);
+
+    otos.shift(0.0f, -300.0f);
+    step(10.0f, 10.0f);
+    check("next consistent OTOS pose is accepted", std::fabs(fused.pose().y() - y) < 1.0f);
+}
+
+/// Test 4: persistent disagreement re-anchors on OTOS
+static void test_reanchoring()
+{
+    printf("\nTest 4: re-anchoring on OTOS\n");
+    restart();
+    for (int i = 0; i < 20; i++) {
+        step(10.0f, 10.0f);
+    }
+
+    // Robot pushed sideways: only OTOS sees it
+    otos.shift(0.0f, 300.0f);
+    for (unsigned i = 1; i < max_rejected_corrections; i++) {
+        step(0.0f, 0.0f);
+    }
+    check("pose is kept until the rejection limit", std::fabs(fused.pose().y()) < 1.0f);
+
+    step(0.0f, 0.0f);
+    const auto& pose = fused.pose();
+    check("pose is re-anchored on OTOS at the rejection limit",
+          pose.x() == otos.pose().x() && pose.y() == otos.pose().y() &&
+              pose.O() == otos.pose().O());
+    check("covariance is reset to the OTOS covariance",
+          variance_x() == otos_position_stddev_mm * otos_position_stddev_mm);
+}
+
+/// Test 5: OTOS deltas drive the prediction, without a correction by the same OTOS pose
+static void test_otos_only()
+{
+    printf("\nTest 5: prediction from OTOS only\n");
+    restart();
+
+    // Drifting encoders leave the fused pose a few mm away from OTOS
+    for (int i = 0; i < 200; i++) {
+        step(10.1f, 10.0f);
+    }
+    encoders.set_error(-EIO);
+
+    const float x = fused.pose().x();
+    float previous_variance = variance_x();
+    bool growing = true;
+    for (int i = 0; i < 10; i++) {
+        step(0.0f, 10.0f);
+        growing = growing && (variance_x() > previous_variance);
+        previous_variance = variance_x();
+    }
+
+    // A correction by the OTOS pose would also pull the pose towards it
+    check("pose follows the OTOS deltas only", std::fabs(fused.pose().x() - x - 100.0f) < 0.01f);
+    check("x variance grows (no correction by the predicting source)", growing);
+}
+
+int main(void)
+{
+    printf("\n=== LocalizationFused test ===\n");
+
+    test_prediction();
+    test_correction();
+    test_gating();
+    test_reanchoring();
+    test_otos_only();
+
+    if (failures) {
+        printf("\n%d check(s) FAILED\n", failures);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("\nAll checks passed\n");
+    return 0;
+}
@@ -0,0 +1,448 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/**
+ * @brief Execution time benchmark of the motion control chains
+ *
+ * Builds the controllers chains of the platforms (quadpid, quadpid_tracker,
+ * brake and the motors dualpid_tracker chain) and executes each of them in a
+ * tight loop, without any engine thread or timer, on synthetic inputs: a
+ * simple first order plant follows the speed commands, and a new target is
+ * given each time the current one is reached.
+ *
+ * Run the benchmark:
+ *
+ *     MC_BENCHMARK_CYCLES=100000 make all term
+ *
+ * Results are printed as CSV lines, after a "kind,chain,controller,..."
+ * header line:
+ * - one "chain" line per chain, execution time of the whole chain,
+ * - with the motion_control_profiling module (BENCHMARK_PROFILING=1, default),
+ *   one "controller" line per executed controller of the chain.
+ *
+ * Profiling measures every controller, so chain times include its overhead.
+ * Build with BENCHMARK_PROFILING=0 to get chain times only, without it.
+ */
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "etl/array.h"
+#include "etl/limits.h"
+
+#include "motion_control_common/ChainLinker.hpp"
+#include "motion_control_common/ControllersIO.hpp"
+#include "motion_control_common/CycleCounter.hpp"
+#include "motion_control_common/ExecutionStats.hpp"
+#include "motion_control_common/IOKey.hpp"
+#include "parameter/Parameter.hpp"
+#include "path/Pose.hpp"
+#include "pid/PID.hpp"
+#include "pid/PIDParameters.hpp"
+#include "trigonometry.h"
+
+#include "brake_chain.hpp"
+#include "dualpid_tracker_chain.hpp"
+#include "motion_control.hpp"
+#include "quadpid_chain.hpp"
+#include "quadpid_tracker_chain.hpp"
+
+namespace pf_mc = cogip::pf::motion_control;
+
+using cogip::motion_control::BaseController;
+using cogip::motion_control::ChainLinker;
+using cogip::motion_control::ControllersIO;
+using cogip::motion_control::ExecutionStats;
+using cogip::motion_control::IOKey;
+using cogip::motion_control::target_pose_status_t;
+namespace cycle_counter = cogip::motion_control::cycle_counter;
+
+/// Default number of measured cycles per chain
+#ifndef BENCHMARK_CYCLES
+#define BENCHMARK_CYCLES 100000
+#endif
+
+/// Cycles executed before measuring, to leave the startup transient
+#ifndef BENCHMARK_WARMUP_CYCLES
+#define BENCHMARK_WARMUP_CYCLES 1000
+#endif
+
+/// Cycles after which a new target is given if the current one is not reached
+#ifndef BENCHMARK_RETARGET_CYCLES
+#define BENCHMARK_RETARGET_CYCLES 2000
+#endif
+
+/// Part of the speed error corrected by the plant each cycle
+constexpr float plant_response = 0.2f;
+
+/// Platform IO keys, as written by PlatformEngine::prepare_inputs()
+static const IOKey current_pose_x_key("current_pose_x");
+static const IOKey current_pose_y_key("current_pose_y");
+static const IOKey current_pose_O_key("current_pose_O");
+static const IOKey linear_current_speed_key("linear_current_speed");
+static const IOKey angular_current_speed_key("angular_current_speed");
+static const IOKey linear_target_speed_key("linear_target_speed");
+static const IOKey angular_target_speed_key("angular_target_speed");
+static const IOKey path_complete_key("path_complete");
+static const IOKey platform_pose_reached_key("pose_reached");
+static const IOKey linear_speed_command_key("linear_speed_command");
+static const IOKey angular_speed_command_key("angular_speed_command");
+static const IOKey linear_speed_order_key("linear_speed_order");
+static const IOKey angular_speed_order_key("angular_speed_order");
+
+/// Motor IO keys, as written by MotorEngine::prepare_inputs()
+static const IOKey current_pose_key("current_pose");
+static const IOKey target_pose_key("target_pose");
+static const IOKey current_speed_key("current_speed");
+static const IOKey target_speed_key("target_speed");
+static const IOKey motor_pose_reached_key("pose_reached");
+static const IOKey new_target_key("new_target");
+static const IOKey pose_error_key("pose_error");
+static const IOKey speed_command_key("speed_command");
+
+/// Targets of the platform chains, in turn
+static const etl::array<cogip::path::Pose, 4> platform_targets = {
+    cogip::path::Pose(500, 0, 0, 100, 100),
+    cogip::path::Pose(500, 500, DEG2RAD(90.0f), 100, 100),
+    cogip::path::Pose(0, 500, DEG2RAD(180.0f), 100, 100),
+    cogip::path::Pose(0, 0, DEG2RAD(-90.0f), 50, 50),
+};
+
+/// Targets of the motor chain, in turn (mm)
+static const etl::array<float, 4> motor_targets = {150, 20, 100, 0};
+
+/// Synthetic platform: pose integrated from speeds following speed commands
+static struct
+{
+    float x, y, O;
+    float linear_speed, angular_speed;
+    target_pose_status_t pose_reached;
+    size_t target;
+    uint32_t target_cycles;
+} platform;
+
+/// Synthetic motor: distance integrated from a speed following the command
+static struct
+{
+    float distance;
+    float speed;
+    bool new_target;
+    size_t target;
+    uint32_t target_cycles;
+} motor;
+
+/// Benchmarked chain with its synthetic engine
+struct BenchmarkChain
+{
+    const char* name;                        ///< Chain name, in results
+    BaseController* controller;              ///< Chain root
+    void (*reset)();                         ///< Reset the synthetic plant
+    void (*link_inputs)(ChainLinker&);       ///< Declare the keys of prepare_inputs
+    void (*prepare_inputs)(ControllersIO&);  ///< Write plant state into the IO
+    void (*process_outputs)(ControllersIO&); ///< Apply commands to the plant
+};
+
+/// Give the next platform target, through the path as the platform does
+static void _platform_next_target()
+{
+    platform.target = (platform.target + 1) % platform_targets.size();
+    platform.target_cycles = 0;
+    platform.pose_reached = target_pose_status_t::moving;
+
+    pf_mc::motion_control_path.reset();
+    pf_mc::motion_control_path.add_point(platform_targets[platform.target]);
+    pf_mc::motion_control_path.start();
+}
+
+static void _platform_reset()
+{
+    platform = {};
+    platform.target = platform_targets.size() - 1;
+    _platform_next_target();
+}
+
+static void _platform_link_inputs(ChainLinker& linker)
+{
+    linker.provides(current_pose_x_key);
+    linker.provides(current_pose_y_key);
+    linker.provides(current_pose_O_key);
+    linker.provides(linear_current_speed_key);
+    linker.provides(angular_current_speed_key);
+    linker.provides(linear_target_speed_key);
+    linker.provides(angular_target_speed_key);
+    linker.provides(path_complete_key);
+    linker.provides(platform_pose_reached_key);
+    linker.provides(linear_speed_command_key);
+    linker.provides(angular_speed_command_key);
+    linker.provides(linear_speed_order_key);
+    linker.provides(angular_speed_order_key);
+}
+
+static void _platform_prepare_inputs(ControllersIO& io)
+{
+    const cogip::path::Pose& target = platform_targets[platform.target];
+
+    io.reset_readonly_markers();
+
+    io.set(current_pose_x_key, platform.x);
+    io.set(current_pose_y_key, platform.y);
+    io.set(current_pose_O_key, platform.O);
+    io.set(linear_current_speed_key, platform.linear_speed);
+    io.set(angular_current_speed_key, platform.angular_speed);
+    io.set(linear_target_speed_key, (pf_mc::platform_max_speed_linear_mm_per_period *
+                                     target.max_speed_ratio_linear()) /
+                                        100);
+    io.set(angular_target_speed_key, (pf_mc::platform_max_speed_angular_rad_per_period *
+                                      target.max_speed_ratio_angular()) /
+                                         100);
+    io.set(path_complete_key, false);
+    io.set(platform_pose_reached_key, platform.pose_reached);
+    io.set(linear_speed_command_key, 0.0f);
+    io.set(angular_speed_command_key, 0.0f);
+    io.set(linear_speed_order_key, 0.0f);
+    io.set(angular_speed_order_key, 0.0f);
+
+    io.mark_readonly(current_pose_x_key);
+    io.mark_readonly(current_pose_y_key);
+    io.mark_readonly(current_pose_O_key);
+    io.mark_readonly(linear_current_speed_key);
+    io.mark_readonly(angular_current_speed_key);
+}
+
+/// Move the platform according to the speed commands
+static void _platform_move(const ControllersIO& io)
+{
+    const float linear_command = io.get_as<float>(linear_speed_command_key).value_or(0.0f);
+    const float angular_command = io.get_as<float>(angular_speed_command_key).value_or(0.0f);
+
+    platform.linear_speed += (linear_command - platform.linear_speed) * plant_response;
+    platform.angular_speed += (angular_command - platform.angular_speed) * plant_response;
+
+    platform.O += platform.angular_speed;
+    platform.x += platform.linear_speed * cosf(platform.O);
+    platform.y += platform.linear_speed * sinf(platform.O);
+}
+
+static void _platform_process_outputs(ControllersIO& io)
+{
+    _platform_move(io);
+
+    auto pose_reached = io.get_as<target_pose_status_t>(platform_pose_reached_key);
+    if (pose_reached) {
+        platform.pose_reached = *pose_reached;
+    }
+
+    if ((platform.pose_reached != target_pose_status_t::moving) ||
+        (++platform.target_cycles >= BENCHMARK_RETARGET_CYCLES)) {
+        _platform_next_target();
+    }
+}
+
+/// Brake chain: the platform is thrown back at full speed periodically
+static void _brake_process_outputs(ControllersIO& io)
+{
+    _platform_move(io);
+
+    if (++platform.target_cycles >= BENCHMARK_RETARGET_CYCLES / 10) {
+        platform.target_cycles = 0;
+        platform.linear_speed = pf_mc::platform_max_speed_linear_mm_per_period;
+        platform.angular_speed = pf_mc::platform_max_speed_angular_rad_per_period;
+    }
+}
+
+static void _brake_reset()
+{
+    _platform_reset();
+    platform.target_cycles = BENCHMARK_RETARGET_CYCLES;
+}
+
+static void _motor_reset()
+{
+    motor = {};
+    motor.new_target = true;
+}
+
+static void _motor_link_inputs(ChainLinker& linker)
+{
+    linker.provides(current_pose_key);
+    linker.provides(target_pose_key);
+    linker.provides(current_speed_key);
+    linker.provides(target_speed_key);
+    linker.provides(motor_pose_reached_key);
+    linker.provides(new_target_key);
+    linker.provides(pose_error_key);
+}
+
+static void _motor_prepare_inputs(ControllersIO& io)
+{
+    const float target = motor_targets[motor.target];
+
+    io.set(current_pose_key, motor.distance);
+    io.set(target_pose_key, target);
+    io.set(current_speed_key, motor.speed);
+    io.set(target_speed_key, pf_mc::platform_max_speed_linear_mm_per_period);
+    io.set(motor_pose_reached_key, target_pose_status_t::moving);
+    io.set(new_target_key, motor.new_target);
+    // Written by the motor pose filter on the robot
+    io.set(pose_error_key, target - motor.distance);
+    motor.new_target = false;
+}
+
+static void _motor_process_outputs(ControllersIO& io)
+{
+    const float command = io.get_as<float>(speed_command_key).value_or(0.0f);
+
+    motor.speed += (command - motor.speed) * plant_response;
+    motor.distance += motor.speed;
+
+    const float error = motor_targets[motor.target] - motor.distance;
+    if (((fabsf(error) < 0.5f) && (fabsf(motor.speed) < 0.1f)) ||
+        (++motor.target_cycles >= BENCHMARK_RETARGET_CYCLES)) {
+        motor.target = (motor.target + 1) % motor_targets.size();
+        motor.target_cycles = 0;
+        motor.new_target = true;
+    }
+}
+
+/// Motor chain PIDs, as configured on the motors platform
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_pose_kp{1.f};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_pose_ki{0.f};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_pose_kd{0.f};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_pose_limit{
+    static_cast<float>(etl::numeric_limits<uint16_t>::max())};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_speed_kp{2.f};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_speed_ki{0.1f};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_speed_kd{0.f};
+static cogip::parameter::Parameter<float, cogip::parameter::NonNegative> motor_speed_limit{
+    static_cast<float>(etl::numeric_limits<uint16_t>::max())};
+static cogip::pid::PIDParameters motor_pose_pid_params(motor_pose_kp, motor_pose_ki,
+                                                       motor_pose_kd, motor_pose_limit);
+static cogip::pid::PIDParameters motor_speed_pid_params(motor_speed_kp, motor_speed_ki,
+                                                        motor_speed_kd, motor_speed_limit);
+static cogip::pid::PID motor_pose_pid(motor_pose_pid_params);
+static cogip::pid::PID motor_speed_pid(motor_speed_pid_params);
+
+/// Motor chain, built in place
+static pf_mc::dualpid_tracker_chain::DualPIDTrackerChain motor_chain =
+    pf_mc::dualpid_tracker_chain::create_chain({
+        .pose_pid = &motor_pose_pid,
+        .speed_pid = &motor_speed_pid,
+        .max_speed_mm_per_period = 10.f,
+        .acceleration_mm_per_period2 = 0.5f,
+        .deceleration_mm_per_period2 = 0.5f,
+        .anti_blocking_params = cogip::motion_control::AntiBlockingControllerParameters(),
+    });
+
+/// Print an ExecutionStats as the end of a CSV line
+static void _print_stats(const ExecutionStats& stats)
+{
+    printf("%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\n", stats.count(),
+           cycle_counter::to_ns(stats.min()), cycle_counter::to_ns(stats.mean()),
+           cycle_counter::to_ns(stats.max()));
+}
+
+/// Resolve all keys of a chain before its first cycle, as the engine does
+/// @return false if a key is dropped by a full registry or read without writer
+static bool _link(const BenchmarkChain& chain)
+{
+    ChainLinker linker;
+    chain.link_inputs(linker);
+    linker.link(*chain.controller);
+
+    if (linker.overflows() || linker.unresolved()) {
+        printf("Chain %s: %" PRIu32 " keys rejected by the registry (%" PRIu32 "/%" PRIu32
+               " keys), %" PRIu32 " keys read without writer\n",
+               chain.name, static_cast<uint32_t>(linker.overflows()),
+               static_cast<uint32_t>(ControllersIO::registered_keys()),
+               static_cast<uint32_t>(cogip::motion_control::MAX_PARAMS),
+               static_cast<uint32_t>(linker.unresolved()));
+        return false;
+    }
+    return true;
+}
+
+/// Execute a chain for the given number of cycles and print its results
+static void _benchmark(const BenchmarkChain& chain, uint32_t cycles)
+{
+    ControllersIO io;
+    ExecutionStats stats;
+
+    chain.reset();
+    chain.controller->reset();
+
+    for (uint32_t i = 0; i < BENCHMARK_WARMUP_CYCLES + cycles; i++) {
+        if (i == BENCHMARK_WARMUP_CYCLES) {
+            stats.reset();
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+            BaseController::reset_profiled_execution_stats();
+#endif
+        }
+
+        chain.prepare_inputs(io);
+        io.clear_modified();
+
+        const uint32_t start = cycle_counter::now();
+        chain.controller->profiled_execute(io);
+        stats.add(cycle_counter::now() - start);
+
+        chain.process_outputs(io);
+    }
+
+    printf("chain,%s,,", chain.name);
+    _print_stats(stats);
+
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+    // Controllers of other chains were reset and not executed since
+    for (size_t i = 0; i < BaseController::profiled_controllers_count(); i++) {
+        const BaseController* controller = BaseController::profiled_controller(i);
+        if (!controller->execution_stats().count()) {
+            continue;
+        }
+        const etl::string_view name = controller->name();
+        printf("controller,%s,%s%s%.*s,", chain.name, controller->type_name(),
+               name.empty() ? "" : ":", static_cast<int>(name.size()), name.data());
+        _print_stats(controller->execution_stats());
+    }
+    BaseController::reset_profiled_execution_stats();
+#endif
+}
+
+int main(void)
+{
+    const char* cycles_env = getenv("MC_BENCHMARK_CYCLES");
+    const uint32_t cycles = cycles_env ? strtoul(cycles_env, nullptr, 10) : BENCHMARK_CYCLES;
+
+    cycle_counter::init();
+
+    pf_mc::brake_chain::init();
+
+    const BenchmarkChain chains[] = {
+        {"quadpid", pf_mc::quadpid_chain::init(), _platform_reset, _platform_link_inputs,
+         _platform_prepare_inputs, _platform_process_outputs},
+        {"quadpid_tracker", pf_mc::quadpid_tracker_chain::init(), _platform_reset,
+         _platform_link_inputs, _platform_prepare_inputs, _platform_process_outputs},
+        {"brake", &pf_mc::brake_chain::brake_meta_controller, _brake_reset, _platform_link_inputs,
+         _platform_prepare_inputs, _brake_process_outputs},
+        {"dualpid_tracker", motor_chain.get_controller(), _motor_reset, _motor_link_inputs,
+         _motor_prepare_inputs, _motor_process_outputs},
+    };
+
+    // Link every chain first: keys are registered process-wide, so a chain
+    // running on defaults would be timed without doing its actual work
+    for (const BenchmarkChain& chain : chains) {
+        if (!_link(chain)) {
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    printf("kind,chain,controller,cycles,min_ns,mean_ns,max_ns\n");
+    for (const BenchmarkChain& chain : chains) {
+        _benchmark(chain, cycles);
+    }
+
+    exit(EXIT_SUCCESS);
+}
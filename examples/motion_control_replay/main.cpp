@@ -0,0 +1,111 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/**
+ * @brief Replay of recorded motion control cycles
+ *
+ * Feeds a recording made on the robot by the motion_control_recorder module
+ * back through the platform controllers chains, as fast as possible, and
+ * compares the chain outputs with the recorded ones.
+ *
+ * Get the recording from the robot shell with the mc_record command, then
+ * convert the hexadecimal lines to binary:
+ *
+ *     grep -v '^#' mc_record.txt | xxd -r -p > recording.bin
+ *
+ * Run the replay:
+ *
+ *     MC_REPLAY_FILE=recording.bin MC_REPLAY_CHAIN=quadpid_tracker make all term
+ *
+ * MC_REPLAY_CHAIN is one of quadpid, quadpid_tracker (default) or
+ * tracker_speed_tuning. Braking cycles are replayed through the brake chain.
+ *
+ * The result is printed on a single line of key=value pairs, and the
+ * application exits with a non-zero status if any output differs.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "motion_control_common/ControllersIO.hpp"
+#include "motion_control_common/CycleReplayer.hpp"
+
+#include "brake_chain.hpp"
+#include "quadpid_chain.hpp"
+#include "quadpid_tracker_chain.hpp"
+#include "tracker_speed_tuning_chain.hpp"
+
+namespace pf_mc = cogip::pf::motion_control;
+
+using cogip::motion_control::BaseController;
+using cogip::motion_control::ControllersIO;
+using cogip::motion_control::CycleReplayer;
+using cogip::motion_control::ReplayResult;
+
+/// Maximum recording size
+#ifndef REPLAY_RECORDING_MAX_SIZE
+#define REPLAY_RECORDING_MAX_SIZE (1024 * 1024)
+#endif
+
+/// Recording loaded from the host file system
+static uint8_t recording[REPLAY_RECORDING_MAX_SIZE];
+
+/// Controllers IO of the replayed chain
+static ControllersIO io;
+
+/// Select a chain by name
+static BaseController* _chain(const char* name)
+{
+    if (strcmp(name, "quadpid") == 0) {
+        return pf_mc::quadpid_chain::init();
+    }
+    if (strcmp(name, "quadpid_tracker") == 0) {
+        return pf_mc::quadpid_tracker_chain::init();
+    }
+    if (strcmp(name, "tracker_speed_tuning") == 0) {
+        return pf_mc::tracker_speed_tuning_chain::init();
+    }
+    return nullptr;
+}
+
+int main(void)
+{
+    const char* path = getenv("MC_REPLAY_FILE");
+    const char* chain_name = getenv("MC_REPLAY_CHAIN");
+    path = path ? path : "recording.bin";
+    chain_name = chain_name ? chain_name : "quadpid_tracker";
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        printf("Cannot open %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    const size_t size = fread(recording, 1, sizeof(recording), file);
+    fclose(file);
+
+    BaseController* chain = _chain(chain_name);
+    if (!chain) {
+        printf("Unknown chain %s\n", chain_name);
+        exit(EXIT_FAILURE);
+    }
+    pf_mc::brake_chain::init();
+
+    CycleReplayer replayer;
+    if (replayer.load(recording, size)) {
+        exit(EXIT_FAILURE);
+    }
+
+    const ReplayResult result =
+        replayer.replay(io, *chain, &pf_mc::brake_chain::brake_meta_controller);
+
+    printf("replay chain=%s cycles=%" PRIu32 " skipped=%" PRIu32 " mismatched_cycles=%" PRIu32
+           " mismatches=%" PRIu32 " unmapped=%" PRIu32 " ns_per_cycle=%" PRIu64 "\n",
+           chain_name, result.cycles, result.skipped, result.mismatched_cycles, result.mismatches,
+           result.unmapped, result.cycles ? result.execution_ns / result.cycles : 0);
+
+    exit(result.mismatches ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -120,7 +120,7 @@ int main(void)
 
     // Filter controller behavior to always moves in a straight line
     cogip::motion_control::PoseStraightFilterParameters pose_straight_filter_parameters =
-        cogip::motion_control::PoseStraightFilterParameters(2, 2);
+        cogip::motion_control::PoseStraightFilterParameters(DEG2RAD(2.0f), 2);
     cogip::motion_control::PoseStraightFilter pose_straight_filter =
         cogip::motion_control::PoseStraightFilter(
             cogip::motion_control::pose_straight_filter_io_keys_default,
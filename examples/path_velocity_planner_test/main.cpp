@@ -0,0 +1,201 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @file
+/// @brief Test application for PathVelocityPlanner
+/// @details Plans junction speeds over simple paths starting at the origin
+///          and checks them against closed-form values:
+///          1. Straight path: waypoints are passed at max speed
+///          2. 90° junction: speed bounded by the junction deviation
+///          3. Reversal and motion direction change: robot stops
+///          4. Path too short to reach cruise speed: backward and forward passes
+///          Exits with a failure status if any check fails.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "path/Path.hpp"
+#include "path_manager_filter/PathVelocityPlanner.hpp"
+
+using cogip::motion_control::PathManagerFilterParameters;
+using cogip::motion_control::PathVelocityPlanner;
+using cogip::path::motion_direction;
+using cogip::path::Path;
+using cogip::path::Pose;
+
+/// Planner limits, per 20 ms period
+static constexpr float max_speed = 10.0f;         ///< mm/period
+static constexpr float acceleration = 1.0f;       ///< mm/period²
+static constexpr float deceleration = 0.5f;       ///< mm/period²
+static constexpr float junction_deviation = 5.0f; ///< mm
+
+/// Largest turn angle to flow through a waypoint (rad)
+static constexpr float max_junction_angle = 3.0f * static_cast<float>(M_PI) / 4.0f;
+
+/// Relative tolerance on speeds, for fast_math approximations
+static constexpr double tolerance = 1e-4;
+
+static PathManagerFilterParameters parameters(Path::MAX_WAYPOINTS, max_speed, acceleration,
+                                              deceleration, junction_deviation,
+                                              max_junction_angle);
+static PathVelocityPlanner planner;
+static Path path;
+
+/// Failed checks
+static int failures = 0;
+
+/// @brief Print a check result and count failures
+static void check(const char* name, bool ok)
+{
+    printf("  %-60s %s\n", name, ok ? "OK" : "FAIL");
+    if (!ok) {
+        failures++;
+    }
+}
+
+/// @brief Add a waypoint to the path
+/// @param x X coordinate (mm)
+/// @param y Y coordinate (mm)
+/// @param intermediate Waypoint the robot can flow through, the last one otherwise
+/// @param direction Motion direction to reach the waypoint
+static void add_waypoint(float x, float y, bool intermediate,
+                         motion_direction direction = motion_direction::forward_only)
+{
+    path.add_point(Pose(x, y, 0.0f, 100.0f, 100.0f, direction, false, 0, intermediate,
+                        intermediate));
+}
+
+/// @brief Plan the path from the origin and compare junction speeds to expected ones
+/// @param name Checked case
+/// @param expected Expected junction speed of each waypoint (mm/period)
+/// @param count Number of waypoints
+static void check_speeds(const char* name, const double* expected, size_t count)
+{
+    planner.plan(path, 0.0f, 0.0f, parameters);
+
+    bool ok = true;
+    printf("  junction speeds:");
+    for (size_t i = 0; i < count; i++) {
+        const double speed = planner.junction_speed(i);
+        printf(" %.4f (%.4f)", speed, expected[i]);
+        ok = ok && (std::fabs(speed - expected[i]) <= tolerance * std::fmax(1.0, expected[i]));
+    }
+    printf("\n");
+    check(name, ok);
+}
+
+/// @brief Check that every junction speed can be reached from the previous one
+/// @param lengths Length of each segment (mm)
+/// @param count Number of waypoints
+/// @return true if no segment needs more than the acceleration or deceleration limits
+static bool is_feasible(const double* lengths, size_t count)
+{
+    double previous = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        const double speed = planner.junction_speed(i);
+        const double change = speed * speed - previous * previous;
+        const double limit = 2.0 * ((change > 0.0) ? acceleration : deceleration) * lengths[i];
+        if (std::fabs(change) > limit * (1.0 + tolerance)) {
+            return false;
+        }
+        previous = speed;
+    }
+    return true;
+}
+
+/// Test 1: straight path
+static void test_straight()
+{
+    printf("\nTest 1: straight path\n");
+    path.reset();
+    add_waypoint(500.0f, 0.0f, true);
+    add_waypoint(1000.0f, 0.0f, true);
+    add_waypoint(1500.0f, 0.0f, false);
+
+    static const double expected[] = {max_speed, max_speed, 0.0};
+    check_speeds("max speed through aligned waypoints, stop at the end", expected, 3);
+}
+
+/// Test 2: 90° junction
+static void test_right_angle()
+{
+    printf("\nTest 2: 90 degrees junction\n");
+    path.reset();
+    add_waypoint(500.0f, 0.0f, true);
+    add_waypoint(500.0f, 500.0f, false);
+
+    // v² / r = a on the arc deviating by junction_deviation: r = d.cos(t/2) / (1 - cos(t/2))
+    const double cos_half_turn = std::cos(M_PI / 4.0);
+    const double radius = junction_deviation * cos_half_turn / (1.0 - cos_half_turn);
+    const double expected[] = {std::sqrt(acceleration * radius), 0.0};
+    check_speeds("junction speed is sqrt(a.d.cos(t/2) / (1 - cos(t/2)))", expected, 2);
+
+    // Turn above max_junction_angle
+    path.reset();
+    add_waypoint(500.0f, 0.0f, true);
+    add_waypoint(0.0f, 100.0f, false);
+    static const double stop[] = {0.0, 0.0};
+    check_speeds("stop on a turn above the maximum junction angle", stop, 2);
+}
+
+/// Test 3: reversal
+static void test_reversal()
+{
+    printf("\nTest 3: reversal\n");
+    path.reset();
+    add_waypoint(500.0f, 0.0f, true);
+    add_waypoint(0.0f, 0.0f, false);
+    static const double stop[] = {0.0, 0.0};
+    check_speeds("stop before going back", stop, 2);
+
+    // Same line, backward motion on the second segment
+    path.reset();
+    add_waypoint(500.0f, 0.0f, true);
+    add_waypoint(1000.0f, 0.0f, false, motion_direction::backward_only);
+    check_speeds("stop on a motion direction change", stop, 2);
+}
+
+/// Test 4: short segments
+static void test_short_path()
+{
+    printf("\nTest 4: path too short to reach cruise speed\n");
+    path.reset();
+    add_waypoint(10.0f, 0.0f, true);
+    add_waypoint(20.0f, 0.0f, true);
+    add_waypoint(30.0f, 0.0f, true);
+    add_waypoint(40.0f, 0.0f, false);
+
+    // Forward pass from rest: v1² = 2.a.10, v2² = v1² + 2.a.10
+    // Backward pass from the stop: v3² = 2.d.10, v2² = v3² + 2.d.10
+    const double v1 = std::sqrt(2.0 * acceleration * 10.0);
+    const double v3 = std::sqrt(2.0 * deceleration * 10.0);
+    const double v2 = std::fmin(std::sqrt(v1 * v1 + 2.0 * acceleration * 10.0),
+                                std::sqrt(v3 * v3 + 2.0 * deceleration * 10.0));
+    const double expected[] = {v1, v2, v3, 0.0};
+    check_speeds("speeds limited by both passes", expected, 4);
+
+    static const double lengths[] = {10.0, 10.0, 10.0, 10.0};
+    check("cruise speed is never reached", planner.junction_speed(1) < max_speed);
+    check("each junction speed is reachable from the previous one", is_feasible(lengths, 4));
+}
+
+int main(void)
+{
+    printf("\n=== PathVelocityPlanner test ===\n");
+
+    test_straight();
+    test_right_angle();
+    test_reversal();
+    test_short_path();
+
+    if (failures) {
+        printf("\n%d check(s) FAILED\n", failures);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("\nAll checks passed\n");
+    return 0;
+}
@@ -0,0 +1,265 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @file
+/// @brief Test application for SCurveProfile and ProfileCursor
+/// @details Generates jerk-limited profiles and checks them against their
+///          closed-form phases:
+///          1. Long move: phase boundaries, plateau and end state
+///          2. Jerk, acceleration and speed limits on every period
+///          3. Short move and initial velocity opposite to the target
+///          4. compute_distance_for_duration() agrees with generated profiles
+///          5. ProfileCursor matches the closed-form evaluation of
+///             trapezoidal and S-curve profiles
+///          Exits with a failure status if any check fails.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "motion_control_common/ProfileCursor.hpp"
+#include "motion_control_common/SCurveProfile.hpp"
+#include "motion_control_common/TrapezoidalProfile.hpp"
+
+using cogip::motion_control::ProfileCursor;
+using cogip::motion_control::SCurveProfile;
+using cogip::motion_control::TrapezoidalProfile;
+using cogip::motion_control::VelocityProfile;
+
+/// Profile limits, per 20 ms period
+static constexpr float acceleration = 1.0f; ///< mm/period²
+static constexpr float deceleration = 1.0f; ///< mm/period²
+static constexpr float max_speed = 10.0f;   ///< mm/period
+static constexpr float jerk = 0.25f;        ///< mm/period³
+
+/// Tolerance on limits and closed-form values, for float rounding
+static constexpr float epsilon = 1e-4f;
+
+/// Failed checks
+static int failures = 0;
+
+/// @brief Print a check result and count failures
+static void check(const char* name, bool ok)
+{
+    printf("  %-68s %s\n", name, ok ? "OK" : "FAIL");
+    if (!ok) {
+        failures++;
+    }
+}
+
+/// Test 1: phases of a long move from rest
+static void test_long_move()
+{
+    printf("\nTest 1: long move phases\n");
+    SCurveProfile profile(jerk);
+    const uint32_t total =
+        profile.generate_optimal_profile(0.0f, 1000.0f, acceleration, deceleration, max_speed,
+                                         true);
+
+    // Jerk phases last a / j = 4 periods and reach v = a² / (2j) = 2, constant acceleration
+    // lasts (10 - 2 * 2) / a = 6 periods: each ramp takes 14 periods and 70 mm, the plateau
+    // covers the 860 mm left in 86 periods
+    static const uint32_t expected_ends[] = {4, 10, 14, 100, 104, 110, 114};
+    static const float expected_jerks[] = {jerk, 0.0f, -jerk, 0.0f, -jerk, 0.0f, jerk};
+    static constexpr size_t expected_phases = sizeof(expected_ends) / sizeof(expected_ends[0]);
+
+    bool phases_ok = true;
+    size_t phases = 0;
+    uint32_t end = 0;
+    float phase_acceleration = 0.0f;
+    float phase_jerk = 0.0f;
+    for (uint32_t period = 0; profile.phase_at(period, end, phase_acceleration, phase_jerk);
+         period = end) {
+        printf("  phase %u: periods [%3u, %3u) jerk %+.2f\n", static_cast<unsigned>(phases),
+               static_cast<unsigned>(period), static_cast<unsigned>(end),
+               static_cast<double>(phase_jerk));
+        phases_ok = phases_ok && (phases < expected_phases) && (end == expected_ends[phases]) &&
+                    (phase_jerk == expected_jerks[phases]);
+        phases++;
+    }
+
+    check("114 periods", total == 114);
+    check("7 phases with the expected boundaries and jerks",
+          phases_ok && (phases == expected_phases));
+    check("plateau at max speed", profile.plateau_velocity() == max_speed);
+    check("v = 2 at the end of the first jerk phase",
+          std::fabs(profile.compute_theoretical_velocity(4) - 2.0f) < epsilon);
+    check("v = max speed at the end of the acceleration",
+          std::fabs(profile.compute_theoretical_velocity(14) - max_speed) < epsilon);
+    check("remaining distance 930 mm at the end of the acceleration",
+          std::fabs(profile.compute_theoretical_remaining_distance(14) - 930.0f) < 1e-3f);
+    check("stopped on target at the end",
+          std::fabs(profile.compute_theoretical_velocity(total)) < epsilon &&
+              std::fabs(profile.compute_theoretical_remaining_distance(total)) < 1e-3f);
+}
+
+/// @brief Check jerk, acceleration and speed limits over all periods of a profile
+/// @param profile Generated profile
+/// @param speed_limit Maximum speed magnitude
+/// @return true if all limits are respected
+static bool respects_limits(const SCurveProfile& profile, float speed_limit)
+{
+    float previous_acceleration = 0.0f;
+    for (uint32_t period = 0; period <= profile.total_periods(); period++) {
+        uint32_t end = 0;
+        float period_acceleration = 0.0f;
+        float period_jerk = 0.0f;
+        profile.phase_at(period, end, period_acceleration, period_jerk);
+        if ((std::fabs(period_acceleration) > acceleration + epsilon) ||
+            (std::fabs(period_acceleration - previous_acceleration) > jerk + epsilon) ||
+            (std::fabs(profile.compute_theoretical_velocity(period)) > speed_limit + epsilon)) {
+            printf("  limit exceeded at period %u\n", static_cast<unsigned>(period));
+            return false;
+        }
+        previous_acceleration = period_acceleration;
+    }
+    return true;
+}
+
+/// Test 2: limits
+static void test_limits()
+{
+    printf("\nTest 2: jerk, acceleration and speed limits\n");
+    SCurveProfile profile(jerk);
+
+    profile.generate_optimal_profile(0.0f, 1000.0f, acceleration, deceleration, max_speed, true);
+    check("long move", respects_limits(profile, max_speed));
+
+    profile.generate_optimal_profile(0.0f, -300.0f, acceleration, deceleration, max_speed, true);
+    check("backward move", respects_limits(profile, max_speed));
+
+    profile.generate_optimal_profile(4.0f, 500.0f, acceleration, deceleration, max_speed, false);
+    check("move continuing at speed", respects_limits(profile, max_speed));
+}
+
+/// Test 3: short move and reverse deceleration
+static void test_short_and_reverse()
+{
+    printf("\nTest 3: short move and reverse deceleration\n");
+    SCurveProfile profile(jerk);
+
+    uint32_t total =
+        profile.generate_optimal_profile(0.0f, 20.0f, acceleration, deceleration, max_speed, true);
+    printf("  short move: peak %.3f mm/period in %u periods\n",
+           static_cast<double>(profile.plateau_velocity()), static_cast<unsigned>(total));
+    check("short move peaks below max speed", profile.plateau_velocity() < max_speed);
+    check("short move respects limits", respects_limits(profile, max_speed));
+    check("short move stops on target",
+          std::fabs(profile.compute_theoretical_remaining_distance(total)) < 1e-3f &&
+              std::fabs(profile.compute_theoretical_velocity(total)) < epsilon);
+
+    total = profile.generate_optimal_profile(-3.0f, 200.0f, acceleration, deceleration,
+                                             max_speed, true);
+    float max_remaining = 0.0f;
+    for (uint32_t period = 0; period <= total; period++) {
+        max_remaining =
+            std::fmax(max_remaining, profile.compute_theoretical_remaining_distance(period));
+    }
+    check("reverse start moves away from the target first", max_remaining > 200.0f);
+    check("reverse start respects limits", respects_limits(profile, max_speed));
+    check("reverse start stops on target",
+          std::fabs(profile.compute_theoretical_remaining_distance(total)) < 1e-3f &&
+              std::fabs(profile.compute_theoretical_velocity(total)) < epsilon);
+}
+
+/// Test 4: speed mode distance
+static void test_distance_for_duration()
+{
+    printf("\nTest 4: compute_distance_for_duration()\n");
+
+    const float long_distance = SCurveProfile::compute_distance_for_duration(
+        max_speed, acceleration, deceleration, jerk, 114, true);
+    check("1000 mm in 114 periods", std::fabs(long_distance - 1000.0f) < 1e-2f);
+
+    const float short_distance = SCurveProfile::compute_distance_for_duration(
+        max_speed, acceleration, deceleration, jerk, 20, true);
+    SCurveProfile profile(jerk);
+    const uint32_t total = profile.generate_optimal_profile(0.0f, short_distance, acceleration,
+                                                            deceleration, max_speed, true);
+    printf("  20 periods: %.3f mm, generated profile lasts %u periods\n",
+           static_cast<double>(short_distance), static_cast<unsigned>(total));
+    check("distance for 20 periods is covered in 20 periods", total == 20);
+}
+
+/// @brief Walk a profile with a cursor and compare it to the closed-form evaluation
+/// @param name Checked profile
+/// @param profile Generated profile
+/// @param steps Periods per cursor advance
+static void check_cursor(const char* name, const VelocityProfile& profile, uint32_t steps)
+{
+    float velocity_error = 0.0f;
+    float distance_error = 0.0f;
+    float acceleration_error = 0.0f;
+    ProfileCursor cursor;
+    for (cursor.start(profile, steps); !cursor.done(); cursor.advance()) {
+        const uint32_t period = cursor.period();
+        uint32_t end = 0;
+        float period_acceleration = 0.0f;
+        float period_jerk = 0.0f;
+        profile.phase_at(period, end, period_acceleration, period_jerk);
+        velocity_error = std::fmax(
+            velocity_error,
+            std::fabs(cursor.velocity() - profile.compute_theoretical_velocity(period)));
+        distance_error = std::fmax(
+            distance_error, std::fabs(cursor.remaining_distance() -
+                                      profile.compute_theoretical_remaining_distance(period)));
+        acceleration_error =
+            std::fmax(acceleration_error, std::fabs(cursor.acceleration() - period_acceleration));
+    }
+
+    char label[96];
+    snprintf(label, sizeof(label), "%s, %u-period steps: %.1e %.1e %.1e", name,
+             static_cast<unsigned>(steps), static_cast<double>(velocity_error),
+             static_cast<double>(acceleration_error), static_cast<double>(distance_error));
+    // Remaining distance is relative to 1000 mm: float resolution is 6e-5 mm there
+    check(label, (velocity_error < epsilon) && (acceleration_error < epsilon) &&
+                     (distance_error < 1e-3f));
+}
+
+/// Test 5: cursor against closed-form evaluation
+static void test_cursor()
+{
+    printf("\nTest 5: ProfileCursor matches closed-form evaluation\n");
+    printf("  errors: velocity, acceleration, remaining distance\n");
+
+    TrapezoidalProfile trapezoidal;
+    trapezoidal.generate_optimal_profile(0.0f, 1000.0f, acceleration, deceleration, max_speed,
+                                         true);
+    check_cursor("trapezoidal", trapezoidal, 1);
+    check_cursor("trapezoidal", trapezoidal, 3);
+
+    SCurveProfile scurve(jerk);
+    scurve.generate_optimal_profile(0.0f, 1000.0f, acceleration, deceleration, max_speed, true);
+    check_cursor("S-curve", scurve, 1);
+    check_cursor("S-curve", scurve, 3);
+
+    scurve.generate_optimal_profile(-3.0f, 200.0f, acceleration, deceleration, max_speed, true);
+    check_cursor("S-curve, reverse start", scurve, 1);
+
+    // Phase boundaries between periods
+    scurve.set_jerk(0.3f);
+    scurve.generate_optimal_profile(1.7f, 777.7f, 0.9f, 0.7f, 8.3f, true);
+    check_cursor("S-curve, fractional phases", scurve, 1);
+    check_cursor("S-curve, fractional phases", scurve, 3);
+}
+
+int main(void)
+{
+    printf("\n=== SCurveProfile test ===\n");
+
+    test_long_move();
+    test_limits();
+    test_short_and_reverse();
+    test_distance_for_duration();
+    test_cursor();
+
+    if (failures) {
+        printf("\n%d check(s) FAILED\n", failures);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("\nAll checks passed\n");
+    return 0;
+}
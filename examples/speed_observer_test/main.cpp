@@ -0,0 +1,217 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @file
+/// @brief Test application for SpeedObserverFilter
+/// @details Feeds the observer with the linear speed of two simulated
+///          quadrature encoders (robot 1 wheels and resolution, 20 ms period)
+///          and checks its behavior:
+///          1. Zero bandwidth forwards the measured speed
+///          2. Quantization noise at crawl speed is filtered
+///          3. A speed step is tracked without steady state error
+///          4. Reset and handoff restart from the measured speed
+///          Exits with a failure status if any check fails.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "motion_control_common/ControllersIO.hpp"
+#include "parameter/Parameter.hpp"
+#include "speed_observer_filter/SpeedObserverFilter.hpp"
+#include "speed_observer_filter/SpeedObserverFilterIOKeysDefault.hpp"
+#include "speed_observer_filter/SpeedObserverFilterParameters.hpp"
+
+using cogip::motion_control::ControllersIO;
+using cogip::motion_control::linear_speed_observer_filter_io_keys_default;
+using cogip::motion_control::SpeedObserverFilter;
+using cogip::motion_control::SpeedObserverFilterParameters;
+
+/// Control loop period (ms)
+static constexpr float period_ms = 20.0f;
+
+/// Encoder wheel diameter (mm)
+static constexpr double wheel_diameter_mm = 47.7;
+
+/// Encoder resolution (pulses per revolution)
+static constexpr double wheel_resolution_pulses = 4096 * 4;
+
+/// Encoder tick (mm)
+static constexpr double tick_mm = M_PI * wheel_diameter_mm / wheel_resolution_pulses;
+
+/// Observer bandwidth used by the tests (Hz)
+static constexpr float bandwidth_hz = 5.0f;
+
+static cogip::parameter::Parameter<float> bandwidth_parameter(bandwidth_hz);
+static SpeedObserverFilterParameters parameters(bandwidth_parameter, period_ms);
+static SpeedObserverFilter observer(linear_speed_observer_filter_io_keys_default, parameters);
+static ControllersIO io;
+
+/// Failed checks
+static int failures = 0;
+
+/// @brief Print a check result and count failures
+static void check(const char* name, bool ok)
+{
+    printf("  %-60s %s\n", name, ok ? "OK" : "FAIL");
+    if (!ok) {
+        failures++;
+    }
+}
+
+/// @brief Convert a speed from mm/period to mm/s
+static double mm_per_s(double speed)
+{
+    return speed * 1000.0 / period_ms;
+}
+
+/// @brief Two wheels encoders, linear speed is the mean of the quantized wheel deltas
+class EncodersSimulator
+{
+  public:
+    /// @brief Move both wheels and return the measured linear speed
+    /// @param distance True linear delta of the period (mm)
+    /// @return Measured linear delta (mm/period)
+    float move(double distance)
+    {
+        const double left_ticks = std::floor(left_ / tick_mm);
+        const double right_ticks = std::floor(right_ / tick_mm);
+        left_ += distance;
+        right_ += distance;
+        const double left_delta = (std::floor(left_ / tick_mm) - left_ticks) * tick_mm;
+        const double right_delta = (std::floor(right_ / tick_mm) - right_ticks) * tick_mm;
+        return static_cast<float>((left_delta + right_delta) / 2.0);
+    }
+
+  private:
+    double left_ = 0.0;
+    double right_ = 0.37 * tick_mm; ///< Wheels do not cross ticks at the same time
+};
+
+/// @brief Run the observer for one period
+/// @param measured_speed Measured speed (mm/period)
+/// @return Observed speed (mm/period)
+static float step(float measured_speed)
+{
+    io.set(linear_speed_observer_filter_io_keys_default.current_speed, measured_speed);
+    observer.execute(io);
+    return *io.get_as<float>(linear_speed_observer_filter_io_keys_default.observed_speed);
+}
+
+/// Test 1: observer bypassed
+static void test_pass_through()
+{
+    printf("\nTest 1: zero bandwidth forwards the measured speed\n");
+    bandwidth_parameter.set(0.0f);
+    observer.reset();
+
+    bool equal = true;
+    for (int i = 0; i < 50; i++) {
+        const float measured = 0.1f * static_cast<float>(i % 7);
+        equal = equal && (step(measured) == measured);
+    }
+    check("observed speed equals measured speed", equal);
+
+    bandwidth_parameter.set(bandwidth_hz);
+}
+
+/// Test 2: quantization noise at 2 mm/s
+static void test_noise()
+{
+    printf("\nTest 2: quantization noise at 2 mm/s\n");
+    observer.reset();
+
+    EncodersSimulator encoders;
+    const double speed = 2.0 * period_ms / 1000.0;
+    double measured_sum2 = 0.0, observed_sum2 = 0.0, observed_sum = 0.0;
+    const int settling = 100, periods = 5000;
+    for (int i = 0; i < settling + periods; i++) {
+        const float measured = encoders.move(speed);
+        const float observed = step(measured);
+        if (i >= settling) {
+            measured_sum2 += (measured - speed) * (measured - speed);
+            observed_sum2 += (observed - speed) * (observed - speed);
+            observed_sum += observed;
+        }
+    }
+
+    const double measured_rms = mm_per_s(std::sqrt(measured_sum2 / periods));
+    const double observed_rms = mm_per_s(std::sqrt(observed_sum2 / periods));
+    const double observed_mean = mm_per_s(observed_sum / periods);
+    printf("  measured noise %.3f mm/s rms, observed noise %.3f mm/s rms, mean %.4f mm/s\n",
+           measured_rms, observed_rms, observed_mean);
+    check("noise is reduced by more than 5", observed_rms * 5.0 < measured_rms);
+    check("mean observed speed is the true speed", std::fabs(observed_mean - 2.0) < 0.01);
+}
+
+/// Test 3: speed step response
+static void test_step()
+{
+    printf("\nTest 3: speed step from 0 to 500 mm/s\n");
+    observer.reset();
+    step(0.0f);
+
+    const float speed = 10.0f;
+    float observed = 0.0f;
+    int settled_period = -1;
+    float max_observed = 0.0f;
+    for (int i = 1; i <= 100; i++) {
+        observed = step(speed);
+        if (observed > max_observed) {
+            max_observed = observed;
+        }
+        if ((settled_period < 0) && (std::fabs(observed - speed) < 0.02f * speed)) {
+            settled_period = i;
+        }
+    }
+
+    printf("  within 2%% after %d periods, overshoot %.2f%%\n", settled_period,
+           static_cast<double>((max_observed - speed) / speed * 100.0f));
+    check("settles within 2% in less than 20 periods",
+          (settled_period > 0) && (settled_period < 20));
+    check("no steady state error", std::fabs(observed - speed) < 1e-4f);
+}
+
+/// Test 4: restart from the measured speed
+static void test_restart()
+{
+    printf("\nTest 4: reset and handoff\n");
+    observer.reset();
+    for (int i = 0; i < 100; i++) {
+        step(10.0f);
+    }
+
+    observer.reset();
+    check("first speed after reset is the measured speed", step(0.0f) == 0.0f);
+
+    // Chain switched out at 500 mm/s, switched in again once the robot stopped
+    for (int i = 0; i < 100; i++) {
+        step(10.0f);
+    }
+    io.set(linear_speed_observer_filter_io_keys_default.current_speed, 0.0f);
+    observer.handoff(io);
+    const float observed = step(0.0f);
+    check("first speed after handoff is the measured speed", observed == 0.0f);
+}
+
+int main(void)
+{
+    printf("\n=== SpeedObserverFilter test ===\n");
+    printf("Encoder tick %.5f mm, bandwidth %.1f Hz, period %.0f ms\n", tick_mm,
+           static_cast<double>(bandwidth_hz), static_cast<double>(period_ms));
+
+    test_pass_through();
+    test_noise();
+    test_step();
+    test_restart();
+
+    if (failures) {
+        printf("\n%d check(s) FAILED\n", failures);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("\nAll checks passed\n");
+    return 0;
+}
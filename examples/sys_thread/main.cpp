@@ -53,7 +53,7 @@ static void* _thread_buggy(void* data)
 {
     (void)data;
 
-    ztimer_now_t loop_start_time = ztimer_now(ZTIMER_SEC);
+    ztimer_now_t loop_start_time = cogip::thread::thread_ztimer_now(ZTIMER_SEC);
 
     while (true) {
         // Sleep 3 seconds in a thread with a period of 1 second.
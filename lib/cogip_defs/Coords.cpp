@@ -1,7 +1,7 @@
 #include "cogip_defs/Coords.hpp"
 
-// System includes
-#include <cmath>
+// Project includes
+#include "fast_math.h"
 
 namespace cogip {
 
@@ -9,7 +9,7 @@ namespace cogip_defs {
 
 float Coords::distance(const Coords& dest) const
 {
-    return sqrt((dest.x_ - x_) * (dest.x_ - x_) + (dest.y_ - y_) * (dest.y_ - y_));
+    return fast_sqrtf((dest.x_ - x_) * (dest.x_ - x_) + (dest.y_ - y_) * (dest.y_ - y_));
 }
 
 bool Coords::on_segment(const Coords& a, const Coords& b) const
@@ -6,8 +6,6 @@
 /// @brief       Pose class implementation
 /// @author      COGIP Robotics
 
-#include <cmath>
-
 #include "cogip_defs/Pose.hpp"
 #include "trigonometry.h"
 #include "utils.hpp"
@@ -21,9 +19,9 @@ Polar Pose::operator-(const Pose& p)
     float error_x = x_ - p.x();
     float error_y = y_ - p.y();
 
-    float error_O = limit_angle_rad(std::atan2(error_y, error_x) - DEG2RAD(p.O()));
+    float error_O = limit_angle_rad(fast_atan2f(error_y, error_x) - p.O());
 
-    return Polar(std::sqrt(square(error_x) + square(error_y)), RAD2DEG(error_O));
+    return Polar(fast_sqrtf(square(error_x) + square(error_y)), error_O);
 }
 
 } // namespace cogip_defs
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "PB_Polar.hpp"
+#include "trigonometry.h"
 
 namespace cogip {
 
@@ -23,13 +24,14 @@ class Polar
   public:
     /// Constructor.
     explicit Polar(float distance = 0.0, ///< [in] distance
-                   float angle = 0.0     ///< [in] angle
+                   float angle = 0.0     ///< [in] angle (rad)
                    )
         : distance_(distance), angle_(angle){};
 
-    /// Constructor from Protobuf class
+    /// Constructor from Protobuf class (angle in degrees)
     explicit Polar(const PB_Polar& polar)
-        : distance_(polar.get_distance()), angle_(polar.get_angle()){};
+        : distance_(polar.get_distance()),
+          angle_(DEG2RAD(static_cast<float>(polar.get_angle()))){};
 
     /// Return distance.
     float distance(void) const
@@ -37,7 +39,7 @@ class Polar
         return distance_;
     };
 
-    /// Return angle.
+    /// Return angle (rad).
     float angle(void) const
     {
         return angle_;
@@ -50,19 +52,19 @@ class Polar
         distance_ = distance;
     };
 
-    /// Set angle.
-    void set_angle(float angle ///< [in] new angle
+    /// Set angle (rad).
+    void set_angle(float angle ///< [in] new angle (rad)
     )
     {
         angle_ = angle;
     };
 
-    /// Copy data to Protobuf message.
+    /// Copy data to Protobuf message (angle in degrees).
     void pb_copy(PB_Polar& polar ///< [out] Protobuf message to fill
     ) const
     {
         polar.set_distance(distance_);
-        polar.set_angle(angle_);
+        polar.set_angle(RAD2DEG(angle_));
     };
 
     /// Reverse distance and angle
@@ -70,15 +72,15 @@ class Polar
     {
         distance_ *= -1;
         if (angle_ < 0) {
-            angle_ += 180;
+            angle_ += FAST_MATH_PI;
         } else {
-            angle_ -= 180;
+            angle_ -= FAST_MATH_PI;
         }
     };
 
   private:
     float distance_; ///< distance
-    float angle_;    ///< angle
+    float angle_;    ///< angle (rad)
 };
 
 } // namespace cogip_defs
@@ -27,21 +27,22 @@ class Pose : public Coords
     /// Constructor.
     explicit Pose(float x = 0.0, ///< [in] X coordinate
                   float y = 0.0, ///< [in] Y coordinate
-                  float O = 0.0  ///< [in] 0-orientation
+                  float O = 0.0  ///< [in] 0-orientation (rad)
                   )
         : Coords(x, y), O_(O){};
 
-    /// Constructor from Protobuf class
-    explicit Pose(const PB_Pose& pose) : Coords(pose.get_x(), pose.get_y()), O_(pose.get_O()){};
+    /// Constructor from Protobuf class (orientation in degrees)
+    explicit Pose(const PB_Pose& pose)
+        : Coords(pose.get_x(), pose.get_y()), O_(DEG2RAD(static_cast<float>(pose.get_O()))){};
 
-    /// Return 0-orientation.
+    /// Return 0-orientation (rad).
     float O(void) const
     {
         return O_;
     };
 
-    /// Set 0-orientation.
-    void set_O(float O ///< [in] new 0-orientation
+    /// Set 0-orientation (rad).
+    void set_O(float O ///< [in] new 0-orientation (rad)
     )
     {
         O_ = O;
@@ -55,19 +56,19 @@ class Pose : public Coords
         return x_ == other.x_ && y_ == other.y_ && O_ == other.O_;
     };
 
-    /// Copy data to Protobuf message.
+    /// Copy data to Protobuf message (orientation in degrees).
     void pb_copy(PB_Pose& pose ///< [out] Protobuf message to fill
     ) const
     {
         pose.set_x(x_);
         pose.set_y(y_);
-        pose.set_O(O_);
+        pose.set_O(RAD2DEG(O_));
     };
 
     Polar operator-(const Pose& p);
 
   protected:
-    float O_; ///< 0-orientation
+    float O_; ///< 0-orientation (rad)
 };
 
 } // namespace cogip_defs
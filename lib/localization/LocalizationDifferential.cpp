@@ -3,14 +3,10 @@
 // General Public License v2.1. See the file LICENSE in the top level
 // directory for more details.
 
-#include <cmath>
 #include <inttypes.h>
 
 #include "localization/LocalizationDifferential.hpp"
 #include "log.h"
-#ifdef MODULE_TELEMETRY
-#include "telemetry/Telemetry.hpp"
-#endif
 #include "trigonometry.h"
 #include "utils.hpp"
 
@@ -66,28 +62,25 @@ int LocalizationDifferential::update()
     const float delta_angular_pose = (dR - dL) / parameters_.track_width_mm.get();
 
     // Compute angle in rad between -pi and pi
-    float O_rad = DEG2RAD(pose_.O());
-    O_rad = limit_angle_rad(O_rad + delta_angular_pose);
+    const float O = limit_angle_rad(pose_.O() + delta_angular_pose);
 
     // Compute x and y coordinates in mm
-    pose_.set_x(pose_.x() + delta_linear_pose * cos(O_rad));
-    pose_.set_y(pose_.y() + delta_linear_pose * sin(O_rad));
-    pose_.set_O(RAD2DEG(O_rad));
+    pose_.set_x(pose_.x() + delta_linear_pose * fast_cosf(O));
+    pose_.set_y(pose_.y() + delta_linear_pose * fast_sinf(O));
+    pose_.set_O(O);
 
     // Save polar pose delta since last call
     polar_.set_distance(delta_linear_pose);
-    polar_.set_angle(RAD2DEG(delta_angular_pose));
+    polar_.set_angle(delta_angular_pose);
 
     return 0;
 }
 
-void LocalizationDifferential::send_telemetry()
+void LocalizationDifferential::capture_telemetry(LocalizationTelemetry& telemetry)
 {
-#ifdef MODULE_TELEMETRY
-    using cogip::utils::operator"" _key_hash;
-    cogip::telemetry::Telemetry::send<int64_t>("encoder_left"_key_hash, left_encoder_.counter());
-    cogip::telemetry::Telemetry::send<int64_t>("encoder_right"_key_hash, right_encoder_.counter());
-#endif
+    telemetry.encoder_left = left_encoder_.counter();
+    telemetry.encoder_right = right_encoder_.counter();
+    telemetry.has_encoders = true;
 }
 
 } // namespace localization
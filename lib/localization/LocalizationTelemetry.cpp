@@ -0,0 +1,33 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+#include "localization/LocalizationTelemetry.hpp"
+#ifdef MODULE_TELEMETRY
+#include "telemetry/Telemetry.hpp"
+#endif
+
+namespace cogip {
+
+namespace localization {
+
+void send_localization_telemetry([[maybe_unused]] const LocalizationTelemetry& telemetry)
+{
+#ifdef MODULE_TELEMETRY
+    using cogip::utils::operator"" _key_hash;
+    if (telemetry.has_encoders) {
+        cogip::telemetry::Telemetry::send<int64_t>("encoder_left"_key_hash, telemetry.encoder_left);
+        cogip::telemetry::Telemetry::send<int64_t>("encoder_right"_key_hash,
+                                                   telemetry.encoder_right);
+    }
+    if (telemetry.has_otos) {
+        cogip::telemetry::Telemetry::send<uint32_t>("otos_io_time_us"_key_hash,
+                                                    telemetry.otos_io_time_us);
+    }
+#endif
+}
+
+} // namespace localization
+
+} // namespace cogip
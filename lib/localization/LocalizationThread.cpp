@@ -0,0 +1,164 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+#include "localization/LocalizationThread.hpp"
+#include "log.h"
+#include "thread/thread.hpp"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+#include <cerrno>
+#include <time_units.h>
+#include <ztimer.h>
+
+namespace cogip {
+
+namespace localization {
+
+/// Localization thread entry point
+static void* _start_thread(void* arg)
+{
+    DEBUG("Localization start thread\n");
+    static_cast<LocalizationThread*>(arg)->thread_loop();
+    return nullptr;
+}
+
+LocalizationThread::LocalizationThread(LocalizationInterface& localization, uint32_t period_ms,
+                                       uint32_t speed_period_ms, uint8_t priority,
+                                       uint32_t lead_us)
+    : localization_(localization), period_ms_(period_ms),
+      speed_scale_(static_cast<float>(speed_period_ms) / static_cast<float>(period_ms)),
+      priority_(priority), lead_us_(lead_us), mutex_(MUTEX_INIT), timestamp_us_(0),
+      covariance_(), has_covariance_(false)
+{
+}
+
+LocalizationSample LocalizationThread::publish(int status)
+{
+    const cogip::cogip_defs::Pose& pose = localization_.pose();
+    const cogip::cogip_defs::Polar& delta = localization_.delta_polar_pose();
+
+    LocalizationSample sample{};
+    sample.x = pose.x();
+    sample.y = pose.y();
+    sample.O = pose.O();
+    sample.linear_delta = delta.distance() * speed_scale_;
+    sample.angular_delta = delta.angle() * speed_scale_;
+    sample.timestamp_us = thread::thread_ztimer_now(ZTIMER_USEC);
+    sample.status = status;
+    sample.has_covariance = localization_.pose_covariance(sample.covariance);
+    localization_.capture_telemetry(sample.telemetry);
+
+    samples_.write(sample);
+    return sample;
+}
+
+void LocalizationThread::load(const LocalizationSample& sample)
+{
+    pose_.set_x(sample.x);
+    pose_.set_y(sample.y);
+    pose_.set_O(sample.O);
+    delta_polar_pose_.set_distance(sample.linear_delta);
+    delta_polar_pose_.set_angle(sample.angular_delta);
+    timestamp_us_ = sample.timestamp_us;
+    covariance_ = sample.covariance;
+    has_covariance_ = sample.has_covariance;
+}
+
+void LocalizationThread::set_pose(float x, float y, float O)
+{
+    mutex_lock(&mutex_);
+    localization_.set_pose(x, y, O);
+    const LocalizationSample sample = publish(0);
+    mutex_unlock(&mutex_);
+
+    // Do not leave the previous pose to update() callers until their next update
+    load(sample);
+}
+
+void LocalizationThread::set_pose(const cogip::cogip_defs::Pose& pose)
+{
+    mutex_lock(&mutex_);
+    localization_.set_pose(pose);
+    const LocalizationSample sample = publish(0);
+    mutex_unlock(&mutex_);
+
+    // Do not leave the previous pose to update() callers until their next update
+    load(sample);
+}
+
+int LocalizationThread::init()
+{
+    mutex_lock(&mutex_);
+    int ret = localization_.init();
+    publish(ret);
+    mutex_unlock(&mutex_);
+    return ret;
+}
+
+void LocalizationThread::reset()
+{
+    mutex_lock(&mutex_);
+    localization_.reset();
+    publish(0);
+    mutex_unlock(&mutex_);
+}
+
+int LocalizationThread::update()
+{
+    LocalizationSample sample;
+    if (!samples_.read(sample)) {
+        return -EAGAIN;
+    }
+    const uint32_t age_us = thread::thread_ztimer_now(ZTIMER_USEC) - sample.timestamp_us;
+    if (age_us > 2 * period_ms_ * US_PER_MS) {
+        // Thread stalled, e.g. blocked on a sensor: the sample is outdated
+        return -ETIMEDOUT;
+    }
+
+    load(sample);
+
+    return sample.status;
+}
+
+void LocalizationThread::send_telemetry()
+{
+    LocalizationSample sample;
+    if (samples_.read(sample)) {
+        send_localization_telemetry(sample.telemetry);
+    }
+}
+
+void LocalizationThread::thread_loop()
+{
+    const uint32_t period_us = period_ms_ * US_PER_MS;
+    uint32_t loop_start_time =
+        thread::thread_align_wakeup(thread::thread_ztimer_now(ZTIMER_USEC), period_us, lead_us_);
+
+    while (true) {
+        mutex_lock(&mutex_);
+        int ret = localization_.update();
+        if (ret) {
+            LOG_WARNING("Localization update failed, error=%d\n", ret);
+        }
+        publish(ret);
+        mutex_unlock(&mutex_);
+
+        // Stay lead_us_ ahead of the period boundaries, even after an overshoot
+        thread::thread_ztimer_periodic_wakeup(ZTIMER_USEC, &loop_start_time, period_us);
+        loop_start_time = thread::thread_align_wakeup(loop_start_time, period_us, lead_us_);
+    }
+}
+
+void LocalizationThread::start_thread()
+{
+    thread_create(thread_stack_, sizeof(thread_stack_), priority_, THREAD_CREATE_STACKTEST,
+                  _start_thread, this, "Localization thread");
+}
+
+} // namespace localization
+
+} // namespace cogip
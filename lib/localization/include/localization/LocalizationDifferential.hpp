@@ -35,7 +35,7 @@ class LocalizationDifferential : public LocalizationInterface
     ///
     /// @param x X coordinate (mm)
     /// @param y Y coordinate (mm)
-    /// @param O angle (deg)
+    /// @param O angle (rad)
     void set_pose(float x, float y, float O) override;
 
     /// @brief Set the default localization pose
@@ -49,7 +49,7 @@ class LocalizationDifferential : public LocalizationInterface
     /// @brief Get current pose using cogip def format
     /// @note Data units:
     ///         - x, y: mm
-    ///         - O: deg
+    ///         - O: rad
     /// @return pose cogip::cogip_defs::Pose current pose reference
     const cogip::cogip_defs::Pose& pose() override
     {
@@ -59,7 +59,7 @@ class LocalizationDifferential : public LocalizationInterface
     /// @brief Get current polar pose delta cogip def format
     /// @note Data units:
     ///         - linear: mm
-    ///         - O: deg
+    ///         - O: rad
     /// @return velocity cogip::cogip_defs::Polar current polar pose delta
     /// reference
     const cogip::cogip_defs::Polar& delta_polar_pose() override
@@ -78,8 +78,8 @@ class LocalizationDifferential : public LocalizationInterface
     /// @return int 0 on success, negative on failure.
     int update() override;
 
-    /// @brief Send encoder telemetry data
-    void send_telemetry() override;
+    /// @brief Capture encoder counters
+    void capture_telemetry(LocalizationTelemetry& telemetry) override;
 
   private:
     const LocalizationDifferentialParameters& parameters_;
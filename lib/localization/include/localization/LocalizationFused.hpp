@@ -0,0 +1,124 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup     localization
+/// @{
+/// @file
+/// @brief       Localization fusing encoders odometry and OTOS optical tracking
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include "localization/LocalizationFusedParameters.hpp"
+#include "localization/LocalizationInterface.hpp"
+
+namespace cogip {
+
+namespace localization {
+
+/// @brief 2D localization fusing encoders odometry and OTOS optical tracking.
+/// @details
+///   Runs an extended Kalman filter on the pose (x, y, O), with fixed size
+///   3x3 matrices and no dynamic allocation:
+///   - prediction: pose deltas of the encoders localization, low latency but
+///     drifting when wheels slip,
+///   - correction: absolute pose of the OTOS localization, immune to wheel
+///     slip. Poses too far from the prediction, given both uncertainties,
+///     are rejected as outliers; after too many rejections in a row the
+///     filter re-anchors on the OTOS pose.
+///
+///   Pose deltas, used as current speeds, come from the encoders.
+///
+///   When a source fails, the other one keeps the localization running:
+///   without encoders, OTOS deltas drive the prediction and no correction is
+///   applied; without OTOS, the pose is dead-reckoned from encoders. Either
+///   way, its covariance grows until both sources are back.
+///   update() fails only if both sources fail.
+class LocalizationFused : public LocalizationInterface
+{
+  public:
+    /// @brief Constructor
+    /// @param odometry   Encoders localization (e.g. LocalizationDifferential)
+    /// @param optical    OTOS localization (LocalizationOTOS)
+    /// @param parameters Noise model
+    LocalizationFused(LocalizationInterface& odometry, LocalizationInterface& optical,
+                      const LocalizationFusedParameters& parameters);
+
+    /// @brief Set the current pose of the filter and of both sources
+    /// @param x X coordinate (mm)
+    /// @param y Y coordinate (mm)
+    /// @param O angle (rad)
+    void set_pose(float x, float y, float O) override;
+
+    /// @brief Set the current pose of the filter and of both sources
+    /// @param pose position reference
+    void set_pose(const cogip::cogip_defs::Pose& pose) override;
+
+    /// @brief Get the filtered pose
+    const cogip::cogip_defs::Pose& pose() override
+    {
+        return pose_;
+    }
+
+    /// @brief Get the polar pose delta of the last update
+    const cogip::cogip_defs::Polar& delta_polar_pose() override
+    {
+        return polar_;
+    }
+
+    /// @brief Get the covariance of the filtered pose
+    /// @param covariance Destination of the covariance
+    /// @return Always true
+    bool pose_covariance(PoseCovariance& covariance) override;
+
+    /// @brief Initialize both sources
+    /// @return 0 if at least one source is initialized, error of the encoders otherwise
+    int init() override;
+
+    /// @brief Reset both sources
+    void reset() override;
+
+    /// @brief Update both sources, then predict and correct the pose
+    /// @return 0 if at least one source is updated, error of the encoders otherwise
+    int update() override;
+
+    /// @brief Capture telemetry data of both sources
+    void capture_telemetry(LocalizationTelemetry& telemetry) override;
+
+  private:
+    /// @brief Propagate the pose and its covariance with a polar pose delta
+    /// @param delta          Polar pose delta (mm, rad)
+    /// @param linear_stddev  Standard deviation of the linear delta (mm)
+    /// @param angular_stddev Standard deviation of the angular delta (rad)
+    void predict(const cogip::cogip_defs::Polar& delta, float linear_stddev,
+                 float angular_stddev);
+
+    /// @brief Correct the pose with an absolute pose measurement
+    /// @param measure Measured pose (mm, rad)
+    void correct(const cogip::cogip_defs::Pose& measure);
+
+    /// @brief Log source availability changes
+    /// @param odometry_ok Encoders update succeeded
+    /// @param optical_ok  OTOS update succeeded
+    void report_sources(bool odometry_ok, bool optical_ok);
+
+    LocalizationInterface& odometry_;               ///< Encoders localization
+    LocalizationInterface& optical_;                ///< OTOS localization
+    const LocalizationFusedParameters& parameters_; ///< Noise model
+
+    cogip::cogip_defs::Pose pose_;   ///< Filtered pose
+    cogip::cogip_defs::Polar polar_; ///< Pose delta of the last update
+    float covariance_[3][3];         ///< Pose covariance (x, y, O)
+
+    unsigned rejected_corrections_; ///< OTOS poses rejected in a row
+    bool odometry_ok_;              ///< Encoders update succeeded on the last cycle
+    bool optical_ok_;               ///< OTOS update succeeded on the last cycle
+};
+
+} // namespace localization
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,60 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup     localization
+/// @{
+/// @file
+/// @brief       Fused localization noise parameters
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+namespace cogip {
+
+namespace localization {
+
+/// @brief Noise model of the fused localization filter
+/// @details Encoder noise grows with the travelled distance and rotation,
+///          OTOS noise is constant. Values are standard deviations.
+struct LocalizationFusedParameters
+{
+    /// @brief Constructor
+    /// @param linear_noise_ratio_       Encoder linear error per travelled mm (mm/mm)
+    /// @param angular_noise_ratio_      Encoder angular error per turned rad (rad/rad)
+    /// @param angular_drift_per_mm_     Encoder angular error per travelled mm (rad/mm)
+    /// @param otos_position_stddev_mm_  OTOS position error (mm)
+    /// @param otos_heading_stddev_rad_  OTOS heading error (rad)
+    /// @param gate_                     Squared Mahalanobis distance above which an OTOS
+    ///                                  pose is rejected as an outlier
+    /// @param max_rejected_corrections_ Consecutive rejections after which the filter
+    ///                                  re-anchors on the OTOS pose
+    LocalizationFusedParameters(float linear_noise_ratio_ = 0.01f,
+                                float angular_noise_ratio_ = 0.02f,
+                                float angular_drift_per_mm_ = 0.0001f,
+                                float otos_position_stddev_mm_ = 5.0f,
+                                float otos_heading_stddev_rad_ = 0.01f, float gate_ = 16.0f,
+                                unsigned max_rejected_corrections_ = 50)
+        : linear_noise_ratio(linear_noise_ratio_), angular_noise_ratio(angular_noise_ratio_),
+          angular_drift_per_mm(angular_drift_per_mm_),
+          otos_position_stddev_mm(otos_position_stddev_mm_),
+          otos_heading_stddev_rad(otos_heading_stddev_rad_), gate(gate_),
+          max_rejected_corrections(max_rejected_corrections_)
+    {
+    }
+
+    float linear_noise_ratio;          ///< Encoder linear error per travelled mm (mm/mm)
+    float angular_noise_ratio;         ///< Encoder angular error per turned rad (rad/rad)
+    float angular_drift_per_mm;        ///< Encoder angular error per travelled mm (rad/mm)
+    float otos_position_stddev_mm;     ///< OTOS position error (mm)
+    float otos_heading_stddev_rad;     ///< OTOS heading error (rad)
+    float gate;                        ///< Outlier gate on the squared Mahalanobis distance
+    unsigned max_rejected_corrections; ///< Rejections in a row before re-anchoring on OTOS
+};
+
+} // namespace localization
+
+} // namespace cogip
+
+/// @}
@@ -9,11 +9,24 @@
 
 #include "cogip_defs/Polar.hpp"
 #include "cogip_defs/Pose.hpp"
+#include "localization/LocalizationTelemetry.hpp"
 
 namespace cogip {
 
 namespace localization {
 
+/// @brief Covariance of a pose estimate, upper triangle of the symmetric 3x3 matrix
+/// @note Data units: mm², mm.rad and rad²
+struct PoseCovariance
+{
+    float xx; ///< Variance of x
+    float xy; ///< Covariance of x and y
+    float xO; ///< Covariance of x and O
+    float yy; ///< Variance of y
+    float yO; ///< Covariance of y and O
+    float OO; ///< Variance of O
+};
+
 class LocalizationInterface
 {
   public:
@@ -24,7 +37,7 @@ class LocalizationInterface
     ///
     /// @param x X coordinate (mm)
     /// @param y Y coordinate (mm)
-    /// @param O angle (deg)
+    /// @param O angle (rad)
     virtual void set_pose(float x, float y, float O) = 0;
 
     /// @brief Set the default localization pose
@@ -38,18 +51,27 @@ class LocalizationInterface
     /// @brief Get current pose using cogip def format
     /// @note Data units:
     ///         - x, y: mm
-    ///         - O: deg
+    ///         - O: rad
     /// @return pose cogip::cogip_defs::Pose current pose reference
     virtual const cogip::cogip_defs::Pose& pose() = 0;
 
     /// @brief Get current polar pose delta cogip def format
     /// @note Data units:
     ///         - linear: mm
-    ///         - O: deg
+    ///         - O: rad
     /// @return velocity cogip::cogip_defs::Polar current polar pose delta
     /// reference
     virtual const cogip::cogip_defs::Polar& delta_polar_pose() = 0;
 
+    /// @brief Get the covariance of the current pose (optional)
+    /// @param covariance Destination of the covariance
+    /// @return true if the localization estimates its uncertainty, false otherwise
+    virtual bool pose_covariance(PoseCovariance& covariance)
+    {
+        (void)covariance;
+        return false;
+    }
+
     /// @brief Initialize the localization sensors
     /// @return 0 on success, negative on failure.
     virtual int init() = 0;
@@ -61,8 +83,20 @@ class LocalizationInterface
     /// @return int 0 on success, negative on failure.
     virtual int update() = 0;
 
-    /// @brief Send localization-specific telemetry data (optional)
-    virtual void send_telemetry() {};
+    /// @brief Capture localization-specific telemetry data (optional)
+    /// @param telemetry Destination of the data, fields of other sources are left unchanged
+    virtual void capture_telemetry(LocalizationTelemetry& telemetry)
+    {
+        (void)telemetry;
+    }
+
+    /// @brief Send localization-specific telemetry data
+    virtual void send_telemetry()
+    {
+        LocalizationTelemetry telemetry{};
+        capture_telemetry(telemetry);
+        send_localization_telemetry(telemetry);
+    }
 };
 
 } // namespace localization
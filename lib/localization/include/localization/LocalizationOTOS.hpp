@@ -79,6 +79,9 @@ class LocalizationOTOS : public LocalizationInterface
     /// @return 0 on success, negative on error
     int update() override;
 
+    /// @brief Capture the I2C transfer duration of the latest update
+    void capture_telemetry(LocalizationTelemetry& telemetry) override;
+
   private:
     /// @brief Push the current calibration scalars to the sensor chip if
     /// either parameter was changed since the last poll.
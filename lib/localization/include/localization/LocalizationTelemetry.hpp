@@ -0,0 +1,40 @@
+// Copyright (C) 2026 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup     localization
+/// @{
+/// @file
+/// @brief       Localization telemetry data
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+namespace cogip {
+
+namespace localization {
+
+/// @brief Telemetry data captured from the localization sensors
+/// @details Captured by the thread updating the localization, so that it can
+///          be sent later from any thread without accessing the sensors.
+struct LocalizationTelemetry
+{
+    int64_t encoder_left;     ///< Left encoder counter (pulses)
+    int64_t encoder_right;    ///< Right encoder counter (pulses)
+    uint32_t otos_io_time_us; ///< I2C transfer duration of the last OTOS update (us)
+    bool has_encoders;        ///< Encoders counters are valid
+    bool has_otos;            ///< OTOS transfer duration is valid
+};
+
+/// @brief Send the valid telemetry data, if telemetry is enabled
+/// @param telemetry Captured telemetry data
+void send_localization_telemetry(const LocalizationTelemetry& telemetry);
+
+} // namespace localization
+
+} // namespace cogip
+
+/// @}
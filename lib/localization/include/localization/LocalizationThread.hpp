@@ -0,0 +1,180 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup     localization
+/// @{
+/// @file
+/// @brief       Localization updated in its own thread
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+// RIOT includes
+#include <mutex.h>
+#include <thread.h>
+
+#include "SeqLock.hpp"
+#include "localization/LocalizationInterface.hpp"
+
+namespace cogip {
+
+namespace localization {
+
+/// @brief Localization state published by LocalizationThread
+struct LocalizationSample
+{
+    float x;                         ///< X coordinate (mm)
+    float y;                         ///< Y coordinate (mm)
+    float O;                         ///< Angle (rad)
+    float linear_delta;              ///< Linear pose delta, per speed period (mm)
+    float angular_delta;             ///< Angular pose delta, per speed period (rad)
+    uint32_t timestamp_us;           ///< Time of the update, from thread_ztimer_now(ZTIMER_USEC)
+    int status;                      ///< Result of the update, 0 on success
+    PoseCovariance covariance;       ///< Pose covariance, valid if has_covariance
+    bool has_covariance;             ///< The wrapped localization estimates its uncertainty
+    LocalizationTelemetry telemetry; ///< Telemetry data captured with the pose
+};
+
+/// @brief Runs a localization in its own periodic thread.
+/// @details
+///   The wrapped localization (encoders, OTOS) is updated by a dedicated
+///   thread, at its own rate. Each update is published with its time stamp
+///   through a lock-free double buffer, so that update() only samples the
+///   last publication: sensors I/O is no longer on the caller critical path.
+///
+///   Pose deltas of the wrapped localization are measured over the thread
+///   period. They are scaled to the speed period, the period of the update()
+///   caller, in which speeds are expressed.
+///
+///   Updates happen lead_us before the period boundaries, where engine cycles
+///   start (see BaseControllerEngine::thread_loop()). With a priority above
+///   the update() caller and the same period, each caller cycle then samples
+///   a pose lead_us old, instead of up to one full period old.
+///
+///   Other methods (set_pose, init, reset) are forwarded to the wrapped
+///   localization under a mutex shared with the thread, and publish the
+///   resulting pose right away. Telemetry is captured with each publication
+///   and sent from the last one, so that it never waits for sensors I/O.
+class LocalizationThread : public LocalizationInterface
+{
+  public:
+    /// @brief Constructor
+    /// @param localization    Localization updated by the thread
+    /// @param period_ms       Thread period (ms)
+    /// @param speed_period_ms Period of the pose deltas read by update() callers (ms)
+    /// @param priority        Thread priority, above the update() caller so that
+    ///                        its cycles see the pose updated just before
+    /// @param lead_us         Update time ahead of the period boundaries (us), at
+    ///                        least the duration of the wrapped localization update
+    LocalizationThread(LocalizationInterface& localization, uint32_t period_ms,
+                       uint32_t speed_period_ms, uint8_t priority, uint32_t lead_us = 0);
+
+    /// @brief Set the current pose of the wrapped localization. The new pose
+    ///        is returned by pose() right away, without waiting for update().
+    void set_pose(float x, float y, float O) override;
+
+    /// @brief Set the current pose of the wrapped localization. The new pose
+    ///        is returned by pose() right away, without waiting for update().
+    void set_pose(const cogip::cogip_defs::Pose& pose) override;
+
+    /// @brief Get the pose sampled by the last update()
+    const cogip::cogip_defs::Pose& pose() override
+    {
+        return pose_;
+    }
+
+    /// @brief Get the pose delta sampled by the last update(), per speed period
+    const cogip::cogip_defs::Polar& delta_polar_pose() override
+    {
+        return delta_polar_pose_;
+    }
+
+    /// @brief Get the pose covariance sampled by the last update()
+    /// @param covariance Destination of the covariance
+    /// @return true if the wrapped localization estimates its uncertainty
+    bool pose_covariance(PoseCovariance& covariance) override
+    {
+        covariance = covariance_;
+        return has_covariance_;
+    }
+
+    /// @brief Initialize the wrapped localization sensors
+    /// @return 0 on success, negative on failure.
+    int init() override;
+
+    /// @brief Reset the wrapped localization sensors
+    void reset() override;
+
+    /// @brief Sample the last published pose and pose delta. Never blocks.
+    /// @return Status of the sampled update, -EAGAIN if none was published yet,
+    ///         -ETIMEDOUT if the last publication is older than two thread periods.
+    int update() override;
+
+    /// @brief Send the telemetry data of the last published sample. Never blocks
+    ///        on the wrapped localization.
+    void send_telemetry() override;
+
+    /// @brief Time stamp of the sample read by the last update()
+    /// @return Time from thread_ztimer_now(ZTIMER_USEC) (us)
+    uint32_t timestamp_us() const
+    {
+        return timestamp_us_;
+    }
+
+    /// @brief Last published sample, readable from any thread
+    /// @param sample Destination of the copy
+    /// @return Number of publications so far, 0 if none yet
+    uint32_t read(LocalizationSample& sample) const
+    {
+        return samples_.read(sample);
+    }
+
+    /// @brief Start the localization thread
+    void start_thread();
+
+    /// @brief Localization thread loop
+    void thread_loop();
+
+  private:
+    /// @brief Publish the state of the wrapped localization. Called with
+    ///        mutex_ locked: publications have a single writer at a time.
+    /// @param status Result of the wrapped localization update
+    /// @return Published sample
+    LocalizationSample publish(int status);
+
+    /// @brief Copy a sample to the state returned by pose(), delta_polar_pose()
+    ///        and pose_covariance()
+    /// @param sample Sampled state
+    void load(const LocalizationSample& sample);
+
+    LocalizationInterface& localization_; ///< Localization updated by the thread
+    uint32_t period_ms_;                  ///< Thread period (ms)
+    float speed_scale_;                   ///< Thread period to speed period ratio
+    uint8_t priority_;                    ///< Thread priority
+    uint32_t lead_us_;                    ///< Update time ahead of the period boundaries (us)
+
+    /// Protect the wrapped localization from concurrent accesses
+    mutex_t mutex_;
+
+    /// Published samples
+    utils::SeqLock<LocalizationSample> samples_;
+
+    cogip::cogip_defs::Pose pose_;              ///< Pose sampled by update()
+    cogip::cogip_defs::Polar delta_polar_pose_; ///< Pose delta sampled by update()
+    uint32_t timestamp_us_;                     ///< Time stamp sampled by update()
+    PoseCovariance covariance_;                 ///< Pose covariance sampled by update()
+    bool has_covariance_;                       ///< Covariance sampled by update() is valid
+
+    /// Localization thread stack
+    char thread_stack_[THREAD_STACKSIZE_LARGE];
+};
+
+} // namespace localization
+
+} // namespace cogip
+
+/// @}
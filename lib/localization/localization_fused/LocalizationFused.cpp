@@ -0,0 +1,346 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup     localization
+/// @{
+/// @file
+/// @brief       Localization fusing encoders odometry and OTOS optical tracking
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+
+#include "localization/LocalizationFused.hpp"
+#include "log.h"
+#include "trigonometry.h"
+
+namespace cogip {
+
+namespace localization {
+
+namespace {
+
+/// Minimum determinant of the innovation covariance considered invertible
+constexpr float min_determinant = 1e-12f;
+
+/// @brief Set a 3x3 matrix to zero
+void zero(float m[3][3])
+{
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            m[i][j] = 0.0f;
+        }
+    }
+}
+
+/// @brief Compute r = a * b
+void multiply(const float a[3][3], const float b[3][3], float r[3][3])
+{
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            r[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j];
+        }
+    }
+}
+
+/// @brief Compute r = a * b^T
+void multiply_transposed(const float a[3][3], const float b[3][3], float r[3][3])
+{
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            r[i][j] = a[i][0] * b[j][0] + a[i][1] * b[j][1] + a[i][2] * b[j][2];
+        }
+    }
+}
+
+/// @brief Invert a 3x3 matrix with its adjugate
+/// @return false if the matrix is singular
+bool invert(const float m[3][3], float r[3][3])
+{
+    const float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    const float c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    const float c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+
+    const float det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+    if (det < min_determinant && det > -min_determinant) {
+        return false;
+    }
+    const float inv_det = 1.0f / det;
+
+    r[0][0] = c00 * inv_det;
+    r[1][0] = c01 * inv_det;
+    r[2][0] = c02 * inv_det;
+    r[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inv_det;
+    r[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv_det;
+    r[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inv_det;
+    r[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv_det;
+    r[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inv_det;
+    r[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv_det;
+    return true;
+}
+
+/// @brief Force exact symmetry to contain rounding errors
+void symmetrize(float m[3][3])
+{
+    for (int i = 0; i < 3; i++) {
+        for (int j = i + 1; j < 3; j++) {
+            const float mean = 0.5f * (m[i][j] + m[j][i]);
+            m[i][j] = mean;
+            m[j][i] = mean;
+        }
+    }
+}
+
+} // namespace
+
+LocalizationFused::LocalizationFused(LocalizationInterface& odometry,
+                                     LocalizationInterface& optical,
+                                     const LocalizationFusedParameters& parameters)
+    : odometry_(odometry), optical_(optical), parameters_(parameters), pose_(), polar_(),
+      rejected_corrections_(0), odometry_ok_(true), optical_ok_(true)
+{
+    zero(covariance_);
+}
+
+void LocalizationFused::set_pose(float x, float y, float O)
+{
+    odometry_.set_pose(x, y, O);
+    optical_.set_pose(x, y, O);
+
+    pose_.set_x(x);
+    pose_.set_y(y);
+    pose_.set_O(O);
+
+    // The pose is a reference: no uncertainty
+    zero(covariance_);
+    rejected_corrections_ = 0;
+}
+
+void LocalizationFused::set_pose(const cogip::cogip_defs::Pose& pose)
+{
+    set_pose(pose.x(), pose.y(), pose.O());
+}
+
+bool LocalizationFused::pose_covariance(PoseCovariance& covariance)
+{
+    covariance.xx = covariance_[0][0];
+    covariance.xy = covariance_[0][1];
+    covariance.xO = covariance_[0][2];
+    covariance.yy = covariance_[1][1];
+    covariance.yO = covariance_[1][2];
+    covariance.OO = covariance_[2][2];
+    return true;
+}
+
+int LocalizationFused::init()
+{
+    int odometry_error = odometry_.init();
+    if (odometry_error) {
+        LOG_ERROR("Fused localization: encoders init failed, error=%d\n", odometry_error);
+    }
+    int optical_error = optical_.init();
+    if (optical_error) {
+        LOG_ERROR("Fused localization: OTOS init failed, error=%d\n", optical_error);
+    }
+    return (odometry_error && optical_error) ? odometry_error : 0;
+}
+
+void LocalizationFused::reset()
+{
+    odometry_.reset();
+    optical_.reset();
+}
+
+void LocalizationFused::report_sources(bool odometry_ok, bool optical_ok)
+{
+    if (odometry_ok != odometry_ok_) {
+        if (odometry_ok) {
+            LOG_WARNING("Fused localization: encoders recovered\n");
+        } else {
+            LOG_WARNING("Fused localization: encoders lost, using OTOS only\n");
+        }
+    }
+    if (optical_ok != optical_ok_) {
+        if (optical_ok) {
+            LOG_WARNING("Fused localization: OTOS recovered\n");
+        } else {
+            LOG_WARNING("Fused localization: OTOS lost, using encoders only\n");
+        }
+    }
+    odometry_ok_ = odometry_ok;
+    optical_ok_ = optical_ok;
+}
+
+void LocalizationFused::predict(const cogip::cogip_defs::Polar& delta, float linear_stddev,
+                                float angular_stddev)
+{
+    const float distance = delta.distance();
+    const float angle = delta.angle();
+
+    // Integrate along the mean heading of the period, as LocalizationDifferential
+    const float heading = pose_.O() + 0.5f * angle;
+    const float c = fast_cosf(heading);
+    const float s = fast_sinf(heading);
+
+    pose_.set_x(pose_.x() + distance * c);
+    pose_.set_y(pose_.y() + distance * s);
+    pose_.set_O(limit_angle_rad(pose_.O() + angle));
+
+    // Jacobian of the motion model with respect to the pose
+    const float f[3][3] = {
+        {1.0f, 0.0f, -distance * s},
+        {0.0f, 1.0f, distance * c},
+        {0.0f, 0.0f, 1.0f},
+    };
+
+    // P = F.P.F^T
+    float fp[3][3];
+    multiply(f, covariance_, fp);
+    multiply_transposed(fp, f, covariance_);
+
+    // P += G.Q.G^T, with G the Jacobian with respect to (distance, angle) and Q diagonal
+    const float g[3][2] = {
+        {c, -0.5f * distance * s},
+        {s, 0.5f * distance * c},
+        {0.0f, 1.0f},
+    };
+    const float q[2] = {linear_stddev * linear_stddev, angular_stddev * angular_stddev};
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            covariance_[i][j] += g[i][0] * q[0] * g[j][0] + g[i][1] * q[1] * g[j][1];
+        }
+    }
+    symmetrize(covariance_);
+}
+
+void LocalizationFused::correct(const cogip::cogip_defs::Pose& measure)
+{
+    const float position_variance =
+        parameters_.otos_position_stddev_mm * parameters_.otos_position_stddev_mm;
+    const float heading_variance =
+        parameters_.otos_heading_stddev_rad * parameters_.otos_heading_stddev_rad;
+
+    const float innovation[3] = {
+        measure.x() - pose_.x(),
+        measure.y() - pose_.y(),
+        limit_angle_rad(measure.O() - pose_.O()),
+    };
+
+    // Innovation covariance S = P + R (the measurement is the pose itself)
+    float s[3][3];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            s[i][j] = covariance_[i][j];
+        }
+    }
+    s[0][0] += position_variance;
+    s[1][1] += position_variance;
+    s[2][2] += heading_variance;
+
+    float s_inv[3][3];
+    if (!invert(s, s_inv)) {
+        LOG_WARNING("Fused localization: singular innovation covariance, correction skipped\n");
+        return;
+    }
+
+    // Outlier gate on the squared Mahalanobis distance of the innovation
+    float mahalanobis = 0.0f;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            mahalanobis += innovation[i] * s_inv[i][j] * innovation[j];
+        }
+    }
+    if (mahalanobis > parameters_.gate) {
+        rejected_corrections_++;
+        if (rejected_corrections_ < parameters_.max_rejected_corrections) {
+            return;
+        }
+
+        // Encoders have drifted too far (e.g. robot pushed): trust OTOS again
+        LOG_WARNING("Fused localization: %u OTOS poses rejected, re-anchoring on OTOS\n",
+                    rejected_corrections_);
+        pose_ = measure;
+        zero(covariance_);
+        covariance_[0][0] = position_variance;
+        covariance_[1][1] = position_variance;
+        covariance_[2][2] = heading_variance;
+        rejected_corrections_ = 0;
+        return;
+    }
+    rejected_corrections_ = 0;
+
+    // Kalman gain K = P.S^-1
+    float k[3][3];
+    multiply(covariance_, s_inv, k);
+
+    pose_.set_x(pose_.x() + k[0][0] * innovation[0] + k[0][1] * innovation[1] +
+                k[0][2] * innovation[2]);
+    pose_.set_y(pose_.y() + k[1][0] * innovation[0] + k[1][1] * innovation[1] +
+                k[1][2] * innovation[2]);
+    pose_.set_O(limit_angle_rad(pose_.O() + k[2][0] * innovation[0] +
+                                k[2][1] * innovation[1] + k[2][2] * innovation[2]));
+
+    // Joseph form P = (I - K).P.(I - K)^T + K.R.K^T, keeps P symmetric positive
+    float i_k[3][3];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            i_k[i][j] = ((i == j) ? 1.0f : 0.0f) - k[i][j];
+        }
+    }
+    float i_k_p[3][3];
+    multiply(i_k, covariance_, i_k_p);
+    multiply_transposed(i_k_p, i_k, covariance_);
+
+    const float r[3] = {position_variance, position_variance, heading_variance};
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            covariance_[i][j] += k[i][0] * r[0] * k[j][0] + k[i][1] * r[1] * k[j][1] +
+                                 k[i][2] * r[2] * k[j][2];
+        }
+    }
+    symmetrize(covariance_);
+}
+
+int LocalizationFused::update()
+{
+    const int odometry_error = odometry_.update();
+    const int optical_error = optical_.update();
+
+    report_sources(!odometry_error, !optical_error);
+
+    if (odometry_error && optical_error) {
+        return odometry_error;
+    }
+
+    // Prediction from the available relative motion, encoders first for their latency
+    const cogip::cogip_defs::Polar& delta =
+        odometry_error ? optical_.delta_polar_pose() : odometry_.delta_polar_pose();
+    const float distance = delta.distance();
+    const float angle = delta.angle();
+    const float distance_abs = (distance < 0.0f) ? -distance : distance;
+    const float angle_abs = (angle < 0.0f) ? -angle : angle;
+
+    predict(delta, parameters_.linear_noise_ratio * distance_abs,
+            parameters_.angular_noise_ratio * angle_abs +
+                parameters_.angular_drift_per_mm * distance_abs);
+    polar_ = delta;
+
+    // Without encoders, the prediction already follows OTOS: correcting with
+    // the OTOS pose as well would count the same measurement twice
+    if (!optical_error && !odometry_error) {
+        correct(optical_.pose());
+    }
+
+    return 0;
+}
+
+void LocalizationFused::capture_telemetry(LocalizationTelemetry& telemetry)
+{
+    odometry_.capture_telemetry(telemetry);
+    optical_.capture_telemetry(telemetry);
+}
+
+} // namespace localization
+
+} // namespace cogip
+
+/// @}
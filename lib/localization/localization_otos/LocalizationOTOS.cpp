@@ -9,10 +9,9 @@
 /// @brief       Localization implementation using SparkFun OTOS sensor
 /// @author      Gilles DOFFE <g.doffe@gmail.com>
 
-#include <cmath>
-
 #include "localization/LocalizationOTOS.hpp"
 #include "trigonometry.h"
+#include "utils.hpp"
 
 namespace cogip {
 namespace localization {
@@ -35,7 +34,7 @@ int LocalizationOTOS::init()
     params_.linear_scalar.clear_changed();
     params_.angular_scalar.clear_changed();
 
-    otos_.set_offset(params_.offset_x_mm, params_.offset_y_mm, params_.offset_h_deg);
+    otos_.set_offset(params_.offset_x_mm, params_.offset_y_mm, DEG2RAD(params_.offset_h_deg));
     return otos_.calibrate_imu();
 }
 
@@ -96,7 +95,7 @@ int LocalizationOTOS::update()
     // Store previous pose for delta computation
     prev_pose_ = pose_;
 
-    // Update pose from sensor (already in mm and degrees)
+    // Update pose from sensor (already in mm and radians)
     pose_.set_x(otos_pose.x);
     pose_.set_y(otos_pose.y);
     pose_.set_O(otos_pose.h);
@@ -113,11 +112,11 @@ int LocalizationOTOS::update()
     // (matches the convention of LocalizationDifferential where positive = forward)
     float dx = pose_.x() - prev_pose_.x();
     float dy = pose_.y() - prev_pose_.y();
-    float heading_rad = DEG2RAD(prev_pose_.O());
-    float delta_linear = dx * cos(heading_rad) + dy * sin(heading_rad);
+    float heading = prev_pose_.O();
+    float delta_linear = dx * fast_cosf(heading) + dy * fast_sinf(heading);
 
-    // Compute angular delta, normalized to [-180, 180]
-    float delta_angular = limit_angle_deg(pose_.O() - prev_pose_.O());
+    // Compute angular delta, normalized to [-pi, pi]
+    float delta_angular = limit_angle_rad(pose_.O() - prev_pose_.O());
 
     polar_.set_distance(delta_linear);
     polar_.set_angle(delta_angular);
@@ -125,6 +124,12 @@ int LocalizationOTOS::update()
     return 0;
 }
 
+void LocalizationOTOS::capture_telemetry(LocalizationTelemetry& telemetry)
+{
+    telemetry.otos_io_time_us = otos_.io_time_us();
+    telemetry.has_otos = true;
+}
+
 } // namespace localization
 } // namespace cogip
 
@@ -68,6 +68,32 @@ template <int PeriodMs> struct AccelerationConversion
     }
 };
 
+/// @brief Angle unit conversion policy for protobuf interface
+/// Converts between user units (deg) and internal units (rad) at the protobuf boundary.
+/// Internal storage and C++ set()/get() remain in rad, so validation bounds are in rad too.
+/// Composes with SpeedConversion and AccelerationConversion for angular speeds (deg/s)
+/// and accelerations (deg/s²).
+struct DegreesConversion
+{
+    /// @brief Convert from user units (deg) to internal units (rad)
+    /// Called when receiving a value from protobuf (user configures in deg)
+    template <typename T> static void on_pb_read(T& value)
+    {
+        static_assert(etl::is_same<T, float>::value,
+                      "DegreesConversion only supports float parameters");
+        value = value * (static_cast<T>(3.14159265358979) / static_cast<T>(180));
+    }
+
+    /// @brief Convert from internal units (rad) to user units (deg)
+    /// Called when sending a value to protobuf (user sees deg)
+    template <typename T> static void on_pb_copy(T& value)
+    {
+        static_assert(etl::is_same<T, float>::value,
+                      "DegreesConversion only supports float parameters");
+        value = value * (static_cast<T>(180) / static_cast<T>(3.14159265358979));
+    }
+};
+
 } // namespace parameter
 } // namespace cogip
 
@@ -13,6 +13,7 @@
 
 #include <cstdint>
 
+#include "etl/type_traits.h"
 #include "flash_kv_storage/FlashKVStorage.hpp"
 
 namespace cogip {
@@ -53,6 +54,51 @@ template <uint32_t KeyHash> struct WithFlashStorage
     }
 };
 
+/// @brief Flash storage policy for a parameter formerly persisted in degrees
+/// @tparam KeyHash Key of the value stored in radians
+/// @tparam LegacyDegreesKeyHash Key of the value previously stored in degrees
+///
+/// @details Behaves like WithFlashStorage<KeyHash>. If no value is stored
+///          under KeyHash yet, a value stored in degrees under
+///          LegacyDegreesKeyHash is converted to radians, stored under
+///          KeyHash and the legacy entry is erased.
+template <uint32_t KeyHash, uint32_t LegacyDegreesKeyHash>
+struct WithFlashStorageFromDegrees : WithFlashStorage<KeyHash>
+{
+    /// @brief Load parameter value from flash storage, migrating a legacy entry
+    /// @tparam T The parameter value type
+    /// @param value Reference to value (overwritten if flash contains a valid entry)
+    /// @return true if a value was successfully loaded from flash
+    template <typename T> static bool on_init(T& value)
+    {
+        static_assert(etl::is_same<T, float>::value,
+                      "WithFlashStorageFromDegrees only supports float parameters");
+
+        auto& storage = flash_kv_storage::FlashKVStorage::instance();
+        if (storage.load(KeyHash, value) == 0) {
+            return true;
+        }
+
+        T degrees;
+        if (storage.load(LegacyDegreesKeyHash, degrees) != 0) {
+            return false;
+        }
+        value = degrees * (static_cast<T>(3.14159265358979) / static_cast<T>(180));
+        if (storage.store(KeyHash, value) == 0) {
+            storage.del(LegacyDegreesKeyHash);
+        }
+        return true;
+    }
+
+    /// @brief Erase parameter value and any legacy entry from flash storage
+    static void on_clear()
+    {
+        auto& storage = flash_kv_storage::FlashKVStorage::instance();
+        storage.del(KeyHash);
+        storage.del(LegacyDegreesKeyHash);
+    }
+};
+
 } // namespace parameter
 } // namespace cogip
 
@@ -15,7 +15,7 @@ namespace cogip {
 
 namespace path {
 
-Path::Path() : current_index_(0), started_(false) {}
+Path::Path() : current_index_(0), started_(false), revision_(0) {}
 
 void Path::reset()
 {
@@ -45,6 +45,7 @@ void Path::start()
     if (!waypoints_.empty()) {
         started_ = true;
         current_index_ = 0;
+        revision_++;
     }
 }
 
@@ -124,6 +125,11 @@ const Path::PathContainer& Path::waypoints() const
     return waypoints_;
 }
 
+uint32_t Path::revision() const
+{
+    return revision_;
+}
+
 } // namespace path
 
 } // namespace cogip
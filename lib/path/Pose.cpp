@@ -2,6 +2,8 @@
 
 #include <algorithm>
 
+#include "trigonometry.h"
+
 namespace cogip {
 
 namespace path {
@@ -23,7 +25,7 @@ void Pose::pb_read(const PB_PathPose& path_pose)
     auto& pose = path_pose.pose();
     x_ = pose.x();
     y_ = pose.y();
-    O_ = pose.O();
+    O_ = DEG2RAD(static_cast<float>(pose.O()));
     motion_direction_ = static_cast<motion_direction>(path_pose.motion_direction());
     max_speed_ratio_linear_ = path_pose.max_speed_ratio_linear();
     max_speed_ratio_angular_ = path_pose.max_speed_ratio_angular();
@@ -38,7 +40,7 @@ void Pose::pb_copy(PB_PathPose& path_pose) const
     auto& pose = path_pose.mutable_pose();
     pose.set_x(x_);
     pose.set_y(y_);
-    pose.set_O(O_);
+    pose.set_O(RAD2DEG(O_));
     path_pose.set_motion_direction(static_cast<PB_MotionDirection>(motion_direction_));
     path_pose.set_max_speed_ratio_linear(max_speed_ratio_linear_);
     path_pose.set_max_speed_ratio_angular(max_speed_ratio_angular_);
@@ -50,6 +50,7 @@ class Path
     bool add_point_from_pb(const PB_PathPose& pb_pose);
 
     /// @brief Start path execution.
+    /// Each start is a new revision of the path.
     void start();
 
     /// @brief Stop path execution.
@@ -96,10 +97,15 @@ class Path
     /// @return Reference to waypoints vector
     const PathContainer& waypoints() const;
 
+    /// @brief Get path revision, to detect a new path started.
+    /// @return Number of times the path was started
+    uint32_t revision() const;
+
   private:
     PathContainer waypoints_; ///< List of waypoints
     size_t current_index_;    ///< Current waypoint index
     bool started_;            ///< Path execution started
+    uint32_t revision_;       ///< Number of times the path was started
 };
 
 } // namespace path
@@ -29,7 +29,7 @@ class Pose : public cogip_defs::Pose
     explicit Pose(
         float x = 0.0,                                                 ///< [in] X coordinate
         float y = 0.0,                                                 ///< [in] Y coodinate
-        float O = 0.0,                                                 ///< [in] 0-orientation
+        float O = 0.0,                                                 ///< [in] 0-orientation (rad)
         float max_speed_ratio_linear = 0.0,                            ///< [in] max speed linear
         float max_speed_ratio_angular = 0.0,                           ///< [in] max speed angular
         motion_direction motion_dir = motion_direction::bidirectional, ///< [in] motion direction
@@ -91,11 +91,11 @@ class Pose : public cogip_defs::Pose
         return is_intermediate_;
     }
 
-    /// Initialize the object from a Protobuf message.
+    /// Initialize the object from a Protobuf message (orientation in degrees).
     void pb_read(const PB_PathPose& path_pose ///< [in] Protobuf message to read
     );
 
-    /// Copy object to a Probobuf message.
+    /// Copy object to a Probobuf message (orientation in degrees).
     void pb_copy(PB_PathPose& path_pose ///< [out] Protobuf message to fill
     ) const;
 
@@ -42,6 +42,25 @@ float PID::compute(float error)
     return p + i + d;
 }
 
+void PID::warm_start(float error, float output)
+{
+    float ki = parameters_.ki.get();
+    float limit = parameters_.integral_term_limit.get();
+
+    // Without integral gain, the output cannot be matched and the integral
+    // term has no effect
+    integral_term_ = 0;
+    if (ki != 0) {
+        integral_term_ = (output - error * parameters_.kp.get()) / ki;
+
+        // Clamp integral to limits
+        integral_term_ = etl::min(integral_term_, limit);
+        integral_term_ = etl::max(integral_term_, -limit);
+    }
+
+    previous_error_ = error;
+}
+
 } // namespace pid
 
 } // namespace cogip
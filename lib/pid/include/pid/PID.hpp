@@ -37,6 +37,20 @@ class PID
     /// Compute PID.
     float compute(float error);
 
+    /// Initialize the PID state so that it continues from a known output
+    /// (bumpless transfer). The integral term is back-calculated so that
+    /// proportional and integral terms give the output for the error, and the
+    /// previous error is set to the error to avoid a derivative kick.
+    void warm_start(float error, ///< [in]   current error
+                    float output ///< [in]   output to continue from
+    );
+
+    /// Get integral term (error sum).
+    float integral_term() const
+    {
+        return integral_term_;
+    }
+
   private:
     const PIDParameters& parameters_;
     float integral_term_;  ///< error sum
@@ -15,6 +15,7 @@
 #include "etl/type_traits.h"
 #include "mutex.h"
 #include "ztimer.h"
+#include "thread/thread.hpp"
 
 #include "KeyHash.hpp"
 #include "PB_Telemetry.hpp"
@@ -67,7 +68,7 @@ class Telemetry
 
         PB_TelemetryData message;
         message.set_key_hash(key_hash);
-        message.set_timestamp_ms(ztimer_now(ZTIMER_MSEC));
+        message.set_timestamp_ms(cogip::thread::thread_ztimer_now(ZTIMER_MSEC));
 
         if constexpr (etl::is_same<T, float>::value) {
             message.set_float_value(value);
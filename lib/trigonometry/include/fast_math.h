@@ -0,0 +1,128 @@
+#pragma once
+
+/// @file
+/// @brief Single precision math functions with bounded error
+///
+/// All computations stay in float, so that they run on the single precision
+/// FPU of Cortex-M4F targets instead of double precision software emulation,
+/// without calling libm (no errno handling, no large range reduction).
+///
+/// Maximum absolute errors, checked against double precision libm on native:
+/// - fast_sinf(), fast_cosf(): 4e-6 for |x| < 1e4 rad
+/// - fast_atan2f(): 3e-6 rad
+/// - fast_sqrtf(): correctly rounded (single instruction on FPU targets)
+///
+/// Angle wrapping is branchless and valid for |x / period| < 2^31.
+
+#include <stdint.h>
+
+#define FAST_MATH_PI 3.14159265358979f         ///< pi
+#define FAST_MATH_HALF_PI 1.57079632679490f    ///< pi / 2
+#define FAST_MATH_TWO_PI 6.28318530717959f     ///< 2 * pi
+#define FAST_MATH_INV_TWO_PI 0.15915494309190f ///< 1 / (2 * pi)
+
+/// 2 * pi split in an exactly representable part with few significant bits and the rest,
+/// so that the multiples of 2 * pi removed by range reduction keep float precision
+#define FAST_MATH_TWO_PI_HI 6.28125f
+#define FAST_MATH_TWO_PI_LO 1.9353071795864769e-3f
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief Largest integral value not greater than x, without branch nor libm call
+/// @param x Value, |x| < 2^31
+/// @return floor(x)
+inline float fast_floorf(float x)
+{
+    // Conversion truncates towards 0: subtract 1 for negative non-integral values
+    const float t = (float)(int32_t)x;
+    return t - (float)(x < t);
+}
+
+/// @brief Map an angle in radians to [-pi, pi)
+/// @details The bounds may be exceeded by the rounding of x / (2 * pi), at most |x| * 2^-23
+/// @param x Angle in radians
+/// @return Wrapped angle
+inline float fast_wrap_rad(float x)
+{
+    const float k = fast_floorf(x * FAST_MATH_INV_TWO_PI + 0.5f);
+    return (x - k * FAST_MATH_TWO_PI_HI) - k * FAST_MATH_TWO_PI_LO;
+}
+
+/// @brief Map an angle in degrees to [-180, 180)
+/// @param x Angle in degrees
+/// @return Wrapped angle
+inline float fast_wrap_deg(float x)
+{
+    return x - 360.0f * fast_floorf(x * (1.0f / 360.0f) + 0.5f);
+}
+
+/// @brief Sine
+/// @param x Angle in radians
+/// @return sin(x)
+inline float fast_sinf(float x)
+{
+    x = fast_wrap_rad(x);
+
+    // sin(pi - a) = sin(a): fold |x| in [0, pi] onto [0, pi/2]
+    const float a = FAST_MATH_HALF_PI - __builtin_fabsf(__builtin_fabsf(x) - FAST_MATH_HALF_PI);
+    const float a2 = a * a;
+
+    // Taylor series up to a^9, error below 4e-6 on [0, pi/2]
+    const float s =
+        a * (1.0f +
+             a2 * (-1.0f / 6.0f +
+                   a2 * (1.0f / 120.0f + a2 * (-1.0f / 5040.0f + a2 * (1.0f / 362880.0f)))));
+
+    // sin is odd (a may be slightly negative when x is rounded just outside [-pi, pi))
+    return __builtin_copysignf(1.0f, x) * s;
+}
+
+/// @brief Cosine
+/// @param x Angle in radians
+/// @return cos(x)
+inline float fast_cosf(float x)
+{
+    // Shift after range reduction, so that large angles keep their precision
+    return fast_sinf(fast_wrap_rad(x) + FAST_MATH_HALF_PI);
+}
+
+/// @brief Arc tangent of y / x, using the signs of both arguments to find the quadrant
+/// @param y Ordinate
+/// @param x Abscissa
+/// @return Angle in radians in [-pi, pi], 0 if x and y are both 0
+inline float fast_atan2f(float y, float x)
+{
+    const float ax = __builtin_fabsf(x);
+    const float ay = __builtin_fabsf(y);
+
+    // Reduce to atan(a) with a in [0, 1]
+    const float num = (ax < ay) ? ax : ay;
+    const float den = (ax < ay) ? ay : ax;
+    const float a = num / (den + 1e-30f);
+    const float a2 = a * a;
+
+    // Minimax polynomial (Abramowitz & Stegun 4.4.49 form)
+    float r = a * (0.99997726f +
+                   a2 * (-0.33262347f +
+                         a2 * (0.19354346f +
+                               a2 * (-0.11643287f + a2 * (0.05265332f + a2 * -0.01172120f)))));
+
+    // Back to the octant, then to the quadrant
+    r = (ay > ax) ? FAST_MATH_HALF_PI - r : r;
+    r = (x < 0.0f) ? FAST_MATH_PI - r : r;
+    return __builtin_copysignf(r, y);
+}
+
+/// @brief Square root
+/// @param x Value, negative values are handled as 0
+/// @return sqrt(x)
+inline float fast_sqrtf(float x)
+{
+    return __builtin_sqrtf((x > 0.0f) ? x : 0.0f);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
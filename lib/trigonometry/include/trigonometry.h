@@ -1,6 +1,7 @@
 #pragma once
 
 #include "etl/math_constants.h"
+#include "fast_math.h"
 #include <cmath>
 
 #ifndef M_PI
@@ -9,8 +10,8 @@
 
 #define square(__x) (__x * __x)
 
-#define RAD2DEG(a) ((a * 180.0) / M_PI)
-#define DEG2RAD(a) ((a * M_PI) / 180.0)
+#define RAD2DEG(a) ((a) * (180.0f / FAST_MATH_PI))
+#define DEG2RAD(a) ((a) * (FAST_MATH_PI / 180.0f))
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,7 +27,7 @@ extern "C" {
 /// @return
 inline float periodicmod(float x, float y)
 {
-    return fmod(fmod(x, y) + y, y); // ((x % y) + y) % y
+    return x - y * fast_floorf(x / y); // ((x % y) + y) % y
 }
 
 /// @brief Map input value to the given range
@@ -51,7 +52,7 @@ inline float inrange(float x, float min, float max)
 /// @return float the mapped value
 inline float limit_angle_rad(float O)
 {
-    return inrange(O, -etl::math::pi, etl::math::pi);
+    return fast_wrap_rad(O);
 }
 
 /// @brief limit angle in degrees
@@ -59,26 +60,76 @@ inline float limit_angle_rad(float O)
 /// @return float the mapped value
 inline float limit_angle_deg(float O)
 {
-    return inrange(O, -180, 180);
+    return fast_wrap_deg(O);
 }
 
 /// @brief Continuous angular error in degrees
 ///
-/// Computes the shortest signed angular difference between target and current
-/// using atan2(sin Δ, cos Δ) to avoid discontinuities at ±180°.
+/// Computes the shortest signed angular difference between target and current,
+/// wrapped to [-180, 180) to avoid discontinuities at ±180°.
 ///
 /// @param target_deg Target angle in degrees
 /// @param current_deg Current angle in degrees
 /// @return Signed angular error in degrees, continuous
 inline float angular_error_deg(float target_deg, float current_deg)
 {
-    float delta_rad = DEG2RAD(target_deg - current_deg);
-    return RAD2DEG(std::atan2(std::sin(delta_rad), std::cos(delta_rad)));
+    return fast_wrap_deg(target_deg - current_deg);
+}
+
+/// @brief Continuous angular error in radians
+///
+/// Computes the shortest signed angular difference between target and current,
+/// wrapped to [-pi, pi) to avoid discontinuities at ±pi.
+///
+/// @param target_rad Target angle in radians
+/// @param current_rad Current angle in radians
+/// @return Signed angular error in radians, continuous
+inline float angular_error_rad(float target_rad, float current_rad)
+{
+    return fast_wrap_rad(target_rad - current_rad);
 }
 
 #ifdef __cplusplus
 } // extern "C"
 
+/// @brief Enforce angle continuity by detecting 2pi jumps
+///
+/// Applies continuity enforcement to an existing angle value to prevent
+/// 2pi discontinuities when crossing the ±pi boundary.
+///
+/// @param angle Current angle in radians
+/// @param previous_angle Previous angle in radians (updated by this function)
+/// @return Angle with continuity preserved
+inline float enforce_angle_continuity_rad(float angle, float& previous_angle)
+{
+    float corrected_angle = angle;
+
+    // Detect and correct 2pi jumps
+    if (corrected_angle - previous_angle > FAST_MATH_PI) {
+        corrected_angle -= FAST_MATH_TWO_PI;
+    } else if (corrected_angle - previous_angle < -FAST_MATH_PI) {
+        corrected_angle += FAST_MATH_TWO_PI;
+    }
+
+    previous_angle = corrected_angle;
+    return corrected_angle;
+}
+
+/// @brief Continuous angular error in radians with jump detection
+///
+/// Same as angular_error_with_continuity_deg() with angles in radians.
+///
+/// @param target_rad Target angle in radians
+/// @param current_rad Current angle in radians
+/// @param previous_error Previous angular error in radians (updated by this function)
+/// @return Signed angular error in radians with continuity preserved
+inline float angular_error_with_continuity_rad(float target_rad, float current_rad,
+                                               float& previous_error)
+{
+    float raw_error = angular_error_rad(target_rad, current_rad);
+    return enforce_angle_continuity_rad(raw_error, previous_error);
+}
+
 /// @brief Enforce angle continuity by detecting 360° jumps
 ///
 /// Applies continuity enforcement to an existing angle value to prevent
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    lib_utils
+/// @{
+/// @brief      Double-buffered sequence lock for single writer, multiple readers
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+#include <cstdint>
+
+namespace cogip {
+
+namespace utils {
+
+/// @brief Lock-free publication of a value from one writer thread to any
+///        number of reader threads.
+///
+/// The writer fills the buffer not currently published, then publishes it by
+/// bumping a sequence counter. Readers copy the last published buffer and
+/// retry only if the writer started to overwrite it in the meantime, which
+/// requires two publications during the copy. Neither side ever blocks.
+///
+/// Sequence counter is 2*n while idle, n being the number of publications,
+/// and 2*n+1 while publication n+1 is being written. Publication n lives in
+/// buffer n % 2.
+///
+/// @note Only 32-bit loads and stores are used on the counter (no
+///       read-modify-write), so this is lock-free on every Cortex-M core.
+/// @tparam T Trivially copyable published type
+template <typename T> class SeqLock
+{
+  public:
+    /// @brief Publish a new value. Must always be called from the same thread.
+    /// @param value Value to publish
+    void write(const T& value)
+    {
+        const uint32_t seq = seq_ + 1;
+        __atomic_store_n(&seq_, seq, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        buffers_[((seq + 1) >> 1) & 1] = value;
+
+        __atomic_store_n(&seq_, seq + 1, __ATOMIC_RELEASE);
+    }
+
+    /// @brief Copy the last published value.
+    /// @param value Destination of the copy
+    /// @return Number of publications so far, 0 if nothing was published yet
+    uint32_t read(T& value) const
+    {
+        uint32_t begin, end;
+        do {
+            begin = __atomic_load_n(&seq_, __ATOMIC_ACQUIRE) & ~1u;
+            value = buffers_[(begin >> 1) & 1];
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            end = __atomic_load_n(&seq_, __ATOMIC_RELAXED);
+            // Buffer is overwritten from sequence begin + 3
+        } while ((end - begin) >= 3);
+
+        return begin >> 1;
+    }
+
+  private:
+    uint32_t seq_ = 0;  ///< Sequence counter, odd while writing
+    T buffers_[2] = {}; ///< Publication n is stored in buffers_[n % 2]
+};
+
+} // namespace utils
+
+} // namespace cogip
+
+/// @}
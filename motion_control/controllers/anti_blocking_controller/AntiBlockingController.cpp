@@ -27,6 +27,14 @@ namespace cogip {
 
 namespace motion_control {
 
+void AntiBlockingController::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.speed_order);
+    linker.reads(keys_.current_speed);
+    linker.writes(keys_.speed_error);
+    linker.writes(keys_.pose_reached);
+}
+
 void AntiBlockingController::execute(ControllersIO& io)
 {
     DEBUG("Execute AntiBlockingController\n");
@@ -35,16 +43,12 @@ void AntiBlockingController::execute(ControllersIO& io)
     float speed_order = 0.0f;
     if (auto opt = io.get_as<float>(keys_.speed_order)) {
         speed_order = *opt;
-    } else {
-        LOG_WARNING("AntiBlockingController: speed_order not available\n");
     }
 
     // Read current speed (default to 0.0 if missing)
     float current_speed = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_speed)) {
         current_speed = *opt;
-    } else {
-        LOG_WARNING("AntiBlockingController: current_speed not available\n");
     }
 
     // Compute speed error: speed_order - current_speed
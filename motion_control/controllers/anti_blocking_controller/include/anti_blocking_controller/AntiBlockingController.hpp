@@ -51,6 +51,10 @@ class AntiBlockingController
         return "AntiBlockingController";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Execute the controller logic.
     /// @param io Reference to the shared ControllersIO storage.
     void execute(ControllersIO& io) override;
@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -25,11 +25,10 @@ namespace motion_control {
 /// 3. Sets pose_reached to blocked if blocking detected
 struct AntiBlockingControllerIOKeys
 {
-    etl::string_view speed_order;   ///< Input: commanded speed (e.g. "linear_speed_order")
-    etl::string_view current_speed; ///< Input: measured speed (e.g. "linear_current_speed")
-    etl::string_view
-        speed_error; ///< Output: speed_order - current_speed (e.g. "linear_speed_error")
-    etl::string_view pose_reached; ///< Output: pose reached status (written to blocked if detected)
+    IOKey speed_order;   ///< Input: commanded speed (e.g. "linear_speed_order")
+    IOKey current_speed; ///< Input: measured speed (e.g. "linear_current_speed")
+    IOKey speed_error;   ///< Output: speed_order - current_speed (e.g. "linear_speed_error")
+    IOKey pose_reached;  ///< Output: pose reached status (written to blocked if detected)
 };
 
 } // namespace motion_control
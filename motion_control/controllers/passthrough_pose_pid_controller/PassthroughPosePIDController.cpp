@@ -19,6 +19,13 @@ namespace cogip {
 
 namespace motion_control {
 
+void PassthroughPosePIDController::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.position_error);
+    linker.writes(keys_.speed_order);
+    linker.writes(keys_.target_speed);
+}
+
 void PassthroughPosePIDController::execute(ControllersIO& io)
 {
     DEBUG("Execute PassthroughPosePIDController\n");
@@ -27,9 +34,6 @@ void PassthroughPosePIDController::execute(ControllersIO& io)
     float position_error = 0.0f;
     if (auto opt_err = io.get_as<float>(keys_.position_error)) {
         position_error = *opt_err;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.position_error.data(), position_error);
     }
 
     // Determine position error sign
@@ -48,6 +48,10 @@ class PassthroughPosePIDController
         return "PassthroughPosePIDController";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Read "position_error" via keys_->position_error, compute speed
     /// order,
     ///        and write "speed_order" + "target_speed" back via
@@ -12,7 +12,7 @@
 #pragma once
 
 // System includes
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -21,10 +21,9 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a PassthroughPosePIDController.
 struct PassthroughPosePIDControllerIOKeys
 {
-    etl::string_view position_error; ///< e.g. "linear_position_error"  or
-                                     ///< "angular_position_error"
-    etl::string_view speed_order;    ///< e.g. "linear_speed_order"     or "angular_speed_order"
-    etl::string_view target_speed;   ///< e.g. "linear_target_speed"    or "angular_target_speed"
+    IOKey position_error; ///< e.g. "linear_position_error"  or "angular_position_error"
+    IOKey speed_order;    ///< e.g. "linear_speed_order"     or "angular_speed_order"
+    IOKey target_speed;   ///< e.g. "linear_target_speed"    or "angular_target_speed"
 };
 
 } // namespace motion_control
@@ -18,6 +18,14 @@ namespace cogip {
 
 namespace motion_control {
 
+void PosePIDController::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.reset);
+    linker.reads(keys_.position_error);
+    linker.writes(keys_.reset);
+    linker.writes(keys_.speed_order);
+}
+
 void PosePIDController::execute(ControllersIO& io)
 {
     DEBUG("Execute PosePIDController\n");
@@ -41,9 +49,6 @@ void PosePIDController::execute(ControllersIO& io)
     float position_error = 0.0f;
     if (auto opt_err = io.get_as<float>(keys_.position_error)) {
         position_error = *opt_err;
-    } else {
-        LOG_WARNING("PosePIDController: %s is not available, using default value %f\n",
-                    keys_.position_error.data(), position_error);
     }
 
     // Compute speed_order via PID
@@ -54,6 +54,10 @@ class PosePIDController : public Controller<PosePIDControllerIOKeys, PosePIDCont
         }
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Read position error via keys_.position_error,
     ///        compute speed order, and write it to controller IO map.
     void execute(ControllersIO& io) override;
@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,13 +20,13 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a PosePIDController.
 struct PosePIDControllerIOKeys
 {
-    etl::string_view position_error; ///< e.g. "pose_error"
-    etl::string_view current_speed;  ///< e.g. "current_speed"
-    etl::string_view target_speed;   ///< e.g. "target_speed"
-    etl::string_view disable_filter; ///< e.g. "disable_speed_filter"
-    etl::string_view pose_reached;   ///< e.g. "pose_reached"
-    etl::string_view speed_order;    ///< e.g. "speed_order"
-    etl::string_view reset;          ///< e.g. "linear_pose_pid_reset" - triggers PID reset
+    IOKey position_error; ///< e.g. "pose_error"
+    IOKey current_speed;  ///< e.g. "current_speed"
+    IOKey target_speed;   ///< e.g. "target_speed"
+    IOKey disable_filter; ///< e.g. "disable_speed_filter"
+    IOKey pose_reached;   ///< e.g. "pose_reached"
+    IOKey speed_order;    ///< e.g. "speed_order"
+    IOKey reset;          ///< e.g. "linear_pose_pid_reset" - triggers PID reset
 };
 
 } // namespace motion_control
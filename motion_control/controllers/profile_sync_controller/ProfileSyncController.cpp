@@ -0,0 +1,146 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    profile_sync_controller
+/// @{
+/// @file
+/// @brief      Profile Sync controller implementation
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+// System includes
+#include <cstdio>
+#include <inttypes.h>
+
+// ETL includes
+#include "etl/algorithm.h"
+
+// Project includes
+#include "log.h"
+#include "profile_sync_controller/ProfileSyncController.hpp"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+void ProfileSyncController::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.linear_pose_error);
+    linker.reads_optional(keys_.linear_current_speed);
+    linker.reads_optional(keys_.linear_recompute_profile);
+    linker.reads_optional(keys_.linear_target_speed);
+    linker.reads_optional(keys_.linear_final_speed);
+    linker.reads(keys_.angular_pose_error);
+    linker.reads_optional(keys_.angular_current_speed);
+    linker.reads_optional(keys_.angular_recompute_profile);
+    linker.reads_optional(keys_.angular_target_speed);
+    linker.reads_optional(keys_.replan_profile);
+    linker.writes(keys_.sync_periods);
+}
+
+uint32_t ProfileSyncController::compute_periods(const ProfileTrackerController& tracker,
+                                                float distance, float current_speed,
+                                                bool replan_profile, float target_speed,
+                                                float final_speed)
+{
+    const ProfileTrackerControllerParameters& parameters = tracker.parameters();
+
+    // Same profile as the tracker would generate, from the same initial state
+    float initial_acceleration = 0.0f;
+    const float initial_speed =
+        tracker.initial_speed(current_speed, replan_profile, initial_acceleration);
+    VelocityProfile* profile = &trapezoidal_profile_;
+    if (parameters.jerk() > 0.0f) {
+        scurve_profile_.set_jerk(parameters.jerk());
+        scurve_profile_.set_initial_acceleration(initial_acceleration);
+        profile = &scurve_profile_;
+    }
+
+    float max_speed = parameters.max_speed();
+    if (target_speed >= 0.0f) {
+        max_speed = etl::min(max_speed, target_speed);
+    }
+
+    return profile->generate_optimal_profile(initial_speed, distance, parameters.acceleration(),
+                                             parameters.deceleration(), max_speed,
+                                             parameters.must_stop_at_end(), final_speed);
+}
+
+void ProfileSyncController::execute(ControllersIO& io)
+{
+    DEBUG("Execute ProfileSyncController\n");
+
+    // Synchronize only profiles generated together
+    bool linear_recompute_profile = false;
+    if (auto opt = io.get_as<bool>(keys_.linear_recompute_profile)) {
+        linear_recompute_profile = *opt;
+    }
+    bool angular_recompute_profile = false;
+    if (auto opt = io.get_as<bool>(keys_.angular_recompute_profile)) {
+        angular_recompute_profile = *opt;
+    }
+
+    if (!linear_recompute_profile || !angular_recompute_profile || !parameters_.linear() ||
+        !parameters_.angular()) {
+        io.set(keys_.sync_periods, 0);
+        return;
+    }
+
+    // Read inputs of both trackers
+    float linear_pose_error = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.linear_pose_error)) {
+        linear_pose_error = *opt;
+    }
+    float linear_current_speed = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.linear_current_speed)) {
+        linear_current_speed = *opt;
+    }
+    float linear_target_speed = -1.0f;
+    if (auto opt = io.get_as<float>(keys_.linear_target_speed)) {
+        linear_target_speed = *opt;
+    }
+    float linear_final_speed = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.linear_final_speed)) {
+        linear_final_speed = *opt;
+    }
+    float angular_pose_error = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.angular_pose_error)) {
+        angular_pose_error = *opt;
+    }
+    float angular_current_speed = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.angular_current_speed)) {
+        angular_current_speed = *opt;
+    }
+    float angular_target_speed = -1.0f;
+    if (auto opt = io.get_as<float>(keys_.angular_target_speed)) {
+        angular_target_speed = *opt;
+    }
+    bool replan_profile = false;
+    if (auto opt = io.get_as<bool>(keys_.replan_profile)) {
+        replan_profile = *opt;
+    }
+
+    // Both axes last as long as the slower one
+    const uint32_t linear_periods =
+        compute_periods(*parameters_.linear(), linear_pose_error, linear_current_speed,
+                        replan_profile, linear_target_speed, linear_final_speed);
+    const uint32_t angular_periods =
+        compute_periods(*parameters_.angular(), angular_pose_error, angular_current_speed,
+                        replan_profile, angular_target_speed, 0.0f);
+    const uint32_t sync_periods = etl::max(linear_periods, angular_periods);
+
+    DEBUG("ProfileSync: linear=%" PRIu32 " angular=%" PRIu32 " periods\n", linear_periods,
+          angular_periods);
+
+    io.set(keys_.sync_periods, static_cast<int>(sync_periods));
+}
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
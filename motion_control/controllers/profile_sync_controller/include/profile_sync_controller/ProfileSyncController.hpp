@@ -0,0 +1,102 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    profile_sync_controller Profile Sync controller
+/// @{
+/// @file
+/// @brief      Profile Sync controller
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+// Project includes
+#include "ProfileSyncControllerIOKeys.hpp"
+#include "ProfileSyncControllerParameters.hpp"
+#include "motion_control_common/Controller.hpp"
+#include "motion_control_common/ControllersIO.hpp"
+#include "motion_control_common/SCurveProfile.hpp"
+#include "motion_control_common/TrapezoidalProfile.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Profile Sync controller
+///
+/// Linear and angular ProfileTrackerControllers generate independent
+/// profiles, so the two polar axes finish at different periods and the
+/// robot drifts off the straight line.
+///
+/// When both profiles are recomputed in the same cycle, this controller
+/// computes the duration of the fastest profile of each axis, with the
+/// same inputs and parameters as the trackers. Profiles replanned on the
+/// fly start from the commanded state of the running ones, as in the
+/// trackers (see ProfileTrackerController::initial_speed()). The longest
+/// duration is shared through sync_periods: the faster axis tracker lowers
+/// its plateau speed so that its profile lasts as long as the slower axis one.
+///
+/// **Usage in chain:**
+/// @code
+/// PoseStraightFilter → pose errors, recompute flags
+///                               ↓
+/// ProfileSyncController → sync_periods
+///                               ↓
+/// ProfileTrackerController (linear, angular) → synchronized profiles
+/// @endcode
+class ProfileSyncController
+    : public Controller<ProfileSyncControllerIOKeys, ProfileSyncControllerParameters>
+{
+  public:
+    /// @brief Constructor
+    /// @param keys       Reference to a POD containing all controller keys
+    /// @param parameters Reference to controller parameters
+    /// @param name       Optional instance name for identification
+    explicit ProfileSyncController(const ProfileSyncControllerIOKeys& keys,
+                                   const ProfileSyncControllerParameters& parameters,
+                                   etl::string_view name = "")
+        : Controller<ProfileSyncControllerIOKeys, ProfileSyncControllerParameters>(
+              keys, parameters, name)
+    {
+    }
+
+    /// @brief Get the type name of this controller
+    const char* type_name() const override
+    {
+        return "ProfileSyncController";
+    }
+
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
+    /// @brief Compute the duration shared by linear and angular profiles
+    ///        when both are recomputed, write 0 otherwise
+    /// @param io Controller IO map
+    void execute(ControllersIO& io) override;
+
+  private:
+    /// @brief Compute the duration of the fastest profile of an axis
+    /// @param tracker        Tracker of the axis
+    /// @param distance       Distance to travel (pose error)
+    /// @param current_speed  Speed read by the tracker from its current_speed key
+    /// @param replan_profile The tracker continues its running profile
+    /// @param target_speed   Speed limit from the path, negative if none
+    /// @param final_speed    Speed at the end of the profile
+    /// @return Profile duration in periods, 0 if no profile
+    uint32_t compute_periods(const ProfileTrackerController& tracker, float distance,
+                             float current_speed, bool replan_profile, float target_speed,
+                             float final_speed);
+
+    TrapezoidalProfile trapezoidal_profile_; ///< Trapezoidal profile to compute durations
+    SCurveProfile scurve_profile_;           ///< Jerk-limited profile to compute durations
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,44 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    profile_sync_controller Profile Sync controller IO keys
+/// @{
+/// @file
+/// @brief      Profile Sync controller IO keys
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include "motion_control_common/IOKey.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Bundle of ControllersIO key names for ProfileSyncController.
+///
+/// Inputs are the ones of the linear and angular ProfileTrackerControllers
+/// to synchronize, output is read by both trackers.
+struct ProfileSyncControllerIOKeys
+{
+    IOKey linear_pose_error;         ///< e.g. "linear_pose_error"
+    IOKey linear_current_speed;      ///< e.g. "linear_speed_order"
+    IOKey linear_recompute_profile;  ///< e.g. "linear_recompute_profile"
+    IOKey linear_target_speed;       ///< e.g. "linear_target_speed" (optional)
+    IOKey linear_final_speed;        ///< e.g. "linear_final_speed" (optional)
+    IOKey angular_pose_error;        ///< e.g. "angular_pose_error"
+    IOKey angular_current_speed;     ///< e.g. "angular_speed_order"
+    IOKey angular_recompute_profile; ///< e.g. "angular_recompute_profile"
+    IOKey angular_target_speed;      ///< e.g. "angular_target_speed" (optional)
+    IOKey replan_profile;            ///< e.g. "replan_profile" (optional)
+    IOKey sync_periods;              ///< e.g. "profile_sync_periods" (output, 0 if not
+                                     ///< synchronized)
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
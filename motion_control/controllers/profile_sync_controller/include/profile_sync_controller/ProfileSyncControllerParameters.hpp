@@ -0,0 +1,57 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    profile_sync_controller Profile Sync controller parameters
+/// @{
+/// @file
+/// @brief      Profile Sync controller parameters
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include "profile_tracker_controller/ProfileTrackerController.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// Profile Sync controller parameters
+class ProfileSyncControllerParameters
+{
+  public:
+    /// Constructor
+    explicit ProfileSyncControllerParameters(
+        const ProfileTrackerController* linear = nullptr, ///< [in] Linear tracker
+        const ProfileTrackerController* angular = nullptr ///< [in] Angular tracker
+        )
+        : linear_(linear), angular_(angular)
+    {
+    }
+
+    /// Get linear tracker
+    const ProfileTrackerController* linear() const
+    {
+        return linear_;
+    }
+
+    /// Get angular tracker
+    const ProfileTrackerController* angular() const
+    {
+        return angular_;
+    }
+
+  private:
+    /// Linear ProfileTrackerController to synchronize
+    const ProfileTrackerController* linear_;
+
+    /// Angular ProfileTrackerController to synchronize
+    const ProfileTrackerController* angular_;
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
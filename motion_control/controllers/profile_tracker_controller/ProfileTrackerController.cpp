@@ -27,30 +27,106 @@ namespace cogip {
 
 namespace motion_control {
 
+/// Bisection iterations to find the plateau speed of a synchronized profile
+constexpr int sync_speed_iterations = 24;
+
 ProfileTrackerController::ProfileTrackerController(
     const ProfileTrackerControllerIOKeys& keys,
     const ProfileTrackerControllerParameters& parameters, etl::string_view name)
     : Controller<ProfileTrackerControllerIOKeys, ProfileTrackerControllerParameters>(
           keys, parameters, name),
-      profile_(), period_(0)
+      profile_(&trapezoidal_profile_)
+{
+    cursor_.start(*profile_);
+}
+
+float ProfileTrackerController::compute_speed_for_duration(float distance, float max_speed,
+                                                           uint32_t periods, bool must_stop) const
+{
+    // Distance covered in the duration grows with the plateau speed
+    float low = 0.0f;
+    float high = max_speed;
+    for (int i = 0; i < sync_speed_iterations; i++) {
+        const float middle = 0.5f * (low + high);
+        const float middle_distance =
+            (parameters_.jerk() > 0.0f)
+                ? SCurveProfile::compute_distance_for_duration(
+                      middle, parameters_.acceleration(), parameters_.deceleration(),
+                      parameters_.jerk(), periods, must_stop)
+                : TrapezoidalProfile::compute_distance_for_duration(
+                      middle, parameters_.acceleration(), parameters_.deceleration(), periods,
+                      must_stop);
+        if (middle_distance >= distance) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+    return high;
+}
+
+float ProfileTrackerController::initial_speed(float current_speed, bool replan_profile,
+                                              float& initial_acceleration) const
 {
+    // Splice at the current period: the new profile starts from the commanded velocity and
+    // acceleration the running profile would have output this cycle
+    if (replan_profile && profile_->is_initialized()) {
+        initial_acceleration = cursor_.acceleration();
+        return cursor_.velocity();
+    }
+
+    initial_acceleration = 0.0f;
+    return current_speed;
 }
 
 bool ProfileTrackerController::generate_profile(float target_distance, float initial_speed,
-                                                float max_speed, bool must_stop)
+                                                float max_speed, bool must_stop, float final_speed,
+                                                uint32_t sync_periods, float initial_acceleration)
 {
-    uint32_t total_periods = profile_.generate_optimal_profile(
+    // Select the profile type, kept until next generation
+    if (parameters_.jerk() > 0.0f) {
+        scurve_profile_.set_jerk(parameters_.jerk());
+        scurve_profile_.set_initial_acceleration(initial_acceleration);
+        profile_ = &scurve_profile_;
+    } else {
+        profile_ = &trapezoidal_profile_;
+    }
+
+    uint32_t total_periods = profile_->generate_optimal_profile(
         initial_speed, target_distance, parameters_.acceleration(), parameters_.deceleration(),
-        max_speed, must_stop);
+        max_speed, must_stop, final_speed);
+
+    // Stretch the profile to the duration of the slower axis, by lowering its plateau speed
+    if (total_periods > 0 && sync_periods > total_periods) {
+        const float sync_speed =
+            etl::max(compute_speed_for_duration(etl::absolute(target_distance), max_speed,
+                                                sync_periods, must_stop),
+                     etl::absolute(initial_speed));
+        if (sync_speed < max_speed) {
+            DEBUG("[%s] Synchronized profile: %" PRIu32 " -> %" PRIu32 " periods, speed=%.2f\n",
+                  keys_.pose_error.data(), total_periods, sync_periods,
+                  static_cast<double>(sync_speed));
+            total_periods = profile_->generate_optimal_profile(
+                initial_speed, target_distance, parameters_.acceleration(),
+                parameters_.deceleration(), sync_speed, must_stop, final_speed);
+            if (total_periods == 0) {
+                // Keep the fastest profile
+                total_periods = profile_->generate_optimal_profile(
+                    initial_speed, target_distance, parameters_.acceleration(),
+                    parameters_.deceleration(), max_speed, must_stop, final_speed);
+            }
+        }
+    }
 
     if (total_periods == 0) {
         LOG_WARNING("ProfileTrackerController: No profile generated (distance=%.2f)\n",
                     target_distance);
-        profile_.reset();
+        profile_->reset();
+        cursor_.start(*profile_);
         return false;
     }
 
-    period_ = 0;
+    cursor_.start(*profile_, parameters_.period_increment());
     return true;
 }
 
@@ -81,7 +157,8 @@ void ProfileTrackerController::execute_speed_mode(ControllersIO& io)
             DEBUG("[speed_mode] No profile: duration=%" PRIu32 " speed=%.2f\n", duration,
                   target_speed_signed);
             io.set(keys_.tracker_velocity, 0.0f);
-            profile_.reset();
+            profile_->reset();
+            cursor_.start(*profile_);
             return;
         }
 
@@ -89,9 +166,15 @@ void ProfileTrackerController::execute_speed_mode(ControllersIO& io)
         float direction = (target_speed_signed >= 0.0f) ? 1.0f : -1.0f;
 
         // Compute distance from speed + duration (accounts for accel/decel ramps)
-        float target_distance = direction * TrapezoidalProfile::compute_distance_for_duration(
-                                                max_speed, parameters_.acceleration(),
-                                                parameters_.deceleration(), duration, true);
+        float distance =
+            (parameters_.jerk() > 0.0f)
+                ? SCurveProfile::compute_distance_for_duration(
+                      max_speed, parameters_.acceleration(), parameters_.deceleration(),
+                      parameters_.jerk(), duration, true)
+                : TrapezoidalProfile::compute_distance_for_duration(
+                      max_speed, parameters_.acceleration(), parameters_.deceleration(), duration,
+                      true);
+        float target_distance = direction * distance;
 
         DEBUG("[speed_mode] RECOMPUTE: speed=%.2f duration=%" PRIu32 " distance=%.2f\n", max_speed,
               duration, target_distance);
@@ -101,28 +184,50 @@ void ProfileTrackerController::execute_speed_mode(ControllersIO& io)
             return;
         }
 
-        DEBUG("[speed_mode] Generated profile: %" PRIu32 " periods\n", profile_.total_periods());
+        DEBUG("[speed_mode] Generated profile: %" PRIu32 " periods\n", profile_->total_periods());
     }
 
-    if (!profile_.is_initialized()) {
+    if (!profile_->is_initialized()) {
         io.set(keys_.tracker_velocity, 0.0f);
         return;
     }
 
     // Profile complete
-    if (period_ >= profile_.total_periods()) {
+    if (cursor_.done()) {
         io.set(keys_.tracker_velocity, 0.0f);
         DEBUG("[speed_mode] Profile complete\n");
         return;
     }
 
-    // Compute velocity from trapezoidal profile
-    float velocity = profile_.compute_theoretical_velocity(period_);
+    // Velocity from trapezoidal profile
+    float velocity = cursor_.velocity();
 
-    DEBUG("[speed_mode] Period %" PRIu32 ": velocity=%.2f\n", period_, velocity);
+    DEBUG("[speed_mode] Period %" PRIu32 ": velocity=%.2f\n", cursor_.period(), velocity);
 
     io.set(keys_.tracker_velocity, velocity);
-    period_ += parameters_.period_increment();
+    cursor_.advance();
+}
+
+void ProfileTrackerController::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.recompute_profile);
+
+    if (parameters_.speed_mode()) {
+        linker.reads_optional(keys_.target_speed);
+        linker.reads_optional(keys_.duration_periods);
+        linker.writes(keys_.tracker_velocity);
+        return;
+    }
+
+    linker.reads(keys_.pose_error);
+    linker.reads_optional(keys_.current_speed);
+    linker.reads_optional(keys_.target_speed);
+    linker.reads_optional(keys_.final_speed);
+    linker.reads_optional(keys_.sync_periods);
+    linker.reads_optional(keys_.replan_profile);
+    linker.writes(keys_.tracker_velocity);
+    linker.writes(keys_.tracking_error);
+    linker.writes(keys_.profile_complete);
 }
 
 void ProfileTrackerController::execute(ControllersIO& io)
@@ -143,7 +248,7 @@ void ProfileTrackerController::execute(ControllersIO& io)
     // If profile is not initialized, output pose_error as tracking_error
     // This allows position control without tracker when no profile is running
     // Skip this if recompute is requested (recompute takes priority)
-    if (!recompute_profile && !profile_.is_initialized()) {
+    if (!recompute_profile && !profile_->is_initialized()) {
         // Read pose error for tracking
         float pose_error = 0.0f;
         if (auto opt = io.get_as<float>(keys_.pose_error)) {
@@ -167,7 +272,6 @@ void ProfileTrackerController::execute(ControllersIO& io)
     if (auto opt = io.get_as<float>(keys_.pose_error)) {
         pose_error = *opt;
     } else {
-        LOG_ERROR("ProfileTrackerController: pose_error not available\n");
         io.set(keys_.tracker_velocity, 0.0f);
         io.set(keys_.tracking_error, 0.0f);
         if (!keys_.profile_complete.empty()) {
@@ -192,14 +296,42 @@ void ProfileTrackerController::execute(ControllersIO& io)
         }
     }
 
+    // Get speed at the end of the profile: non-zero when flowing through a path waypoint
+    float final_speed = 0.0f;
+    if (!keys_.final_speed.empty()) {
+        if (auto opt = io.get_as<float>(keys_.final_speed)) {
+            final_speed = *opt;
+        }
+    }
+
+    // Get duration shared with the other axis profile, 0 if not synchronized
+    uint32_t sync_periods = 0;
+    if (!keys_.sync_periods.empty()) {
+        if (auto opt = io.get_as<int>(keys_.sync_periods)) {
+            sync_periods = static_cast<uint32_t>(etl::max(*opt, 0));
+        }
+    }
+
+    // Replanning on the fly: continue the running profile instead of restarting from current_speed
+    bool replan_profile = false;
+    if (!keys_.replan_profile.empty()) {
+        if (auto opt = io.get_as<bool>(keys_.replan_profile)) {
+            replan_profile = *opt;
+        }
+    }
+
     // Generate new profile if requested (triggered by PoseStraightFilter state transitions)
     if (recompute_profile) {
-        DEBUG("[ProfileFF %s] RECOMPUTE pose_error=%.2f current_speed=%.2f\n",
+        float initial_acceleration = 0.0f;
+        const float start_speed =
+            initial_speed(current_speed, replan_profile, initial_acceleration);
+
+        DEBUG("[ProfileFF %s] RECOMPUTE pose_error=%.2f initial_speed=%.2f replan=%d\n",
               keys_.pose_error.data(), static_cast<double>(pose_error),
-              static_cast<double>(current_speed));
+              static_cast<double>(start_speed), replan_profile);
 
-        if (!generate_profile(pose_error, current_speed, max_speed,
-                              parameters_.must_stop_at_end())) {
+        if (!generate_profile(pose_error, start_speed, max_speed, parameters_.must_stop_at_end(),
+                              final_speed, sync_periods, initial_acceleration)) {
             io.set(keys_.tracker_velocity, 0.0f);
             io.set(keys_.tracking_error, 0.0f);
             if (!keys_.profile_complete.empty()) {
@@ -209,19 +341,19 @@ void ProfileTrackerController::execute(ControllersIO& io)
         }
 
         DEBUG("[%s] Generated profile: %" PRIu32 " periods, distance=%.2f\n",
-              keys_.pose_error.data(), profile_.total_periods(), pose_error);
+              keys_.pose_error.data(), profile_->total_periods(), pose_error);
     }
 
     // Check if pose_error sign changed vs profile target (e.g., motion_dir changed between cycles)
     // If signs are opposite, regenerate profile for the new direction
-    float profile_target = profile_.target_distance();
+    float profile_target = profile_->target_distance();
     if ((pose_error > 0.0f && profile_target < 0.0f) ||
         (pose_error < 0.0f && profile_target > 0.0f)) {
         DEBUG("[%s] Sign mismatch: pose_error=%.2f vs profile_target=%.2f, regenerating profile\n",
               keys_.pose_error.data(), pose_error, profile_target);
 
-        if (!generate_profile(pose_error, current_speed, max_speed,
-                              parameters_.must_stop_at_end())) {
+        if (!generate_profile(pose_error, current_speed, max_speed, parameters_.must_stop_at_end(),
+                              final_speed)) {
             // Can't generate profile - fall back to PID-only
             io.set(keys_.tracker_velocity, 0.0f);
             io.set(keys_.tracking_error, pose_error);
@@ -232,11 +364,11 @@ void ProfileTrackerController::execute(ControllersIO& io)
         }
 
         DEBUG("[%s] Regenerated profile: %" PRIu32 " periods, distance=%.2f\n",
-              keys_.pose_error.data(), profile_.total_periods(), pose_error);
+              keys_.pose_error.data(), profile_->total_periods(), pose_error);
     }
 
     // Check if profile is complete
-    bool profile_complete = (period_ >= profile_.total_periods());
+    bool profile_complete = cursor_.done();
 
     // Output profile_complete flag if key is configured
     if (!keys_.profile_complete.empty()) {
@@ -245,23 +377,24 @@ void ProfileTrackerController::execute(ControllersIO& io)
 
     // When profile is complete, continue with PID-only control using pose_error
     // Don't invalidate - let the state machine handle the transition
-    // The tracker velocity is 0 (profile done), but tracking_error = pose_error
+    // The tracker velocity is the profile final velocity: 0 when stopping, the junction speed
+    // until the state machine passes the waypoint otherwise. tracking_error = pose_error
     // allows the PID to finish bringing the robot to target
     // NOTE: Use pose_error directly WITHOUT direction_sign_ because pose_error
     // from PoseStraightFilter is already properly signed (negative for backward motion)
     if (profile_complete) {
-        io.set(keys_.tracker_velocity, 0.0f);
+        io.set(keys_.tracker_velocity, cursor_.velocity());
         io.set(keys_.tracking_error, pose_error);
         DEBUG("[%s] Profile complete: PID-only control with tracking_error=%.2f\n",
               keys_.pose_error.data(), pose_error);
         return;
     }
 
-    // Compute tracker velocity from profile (signed - negative for backward movement)
-    float tracker_velocity = profile_.compute_theoretical_velocity(period_);
+    // Tracker velocity from profile (signed - negative for backward movement)
+    float tracker_velocity = cursor_.velocity();
 
-    // Compute theoretical remaining distance from profile (signed)
-    float theoretical_remaining = profile_.compute_theoretical_remaining_distance(period_);
+    // Theoretical remaining distance from profile (signed)
+    float theoretical_remaining = cursor_.remaining_distance();
 
     // Compute tracking error: actual - theoretical (both signed, same direction)
     // If actual > theoretical: we are behind schedule (positive error for forward, negative for
@@ -270,15 +403,15 @@ void ProfileTrackerController::execute(ControllersIO& io)
 
     DEBUG("[%s] Period %" PRIu32 ": tracker_velocity=%.2f, pose_error=%.2f, "
           "theoretical_remaining=%.2f, tracking_error=%.2f\n",
-          keys_.pose_error.data(), period_, tracker_velocity, pose_error, theoretical_remaining,
-          tracking_error);
+          keys_.pose_error.data(), cursor_.period(), tracker_velocity, pose_error,
+          theoretical_remaining, tracking_error);
 
     // Write outputs
     io.set(keys_.tracker_velocity, tracker_velocity);
     io.set(keys_.tracking_error, tracking_error);
 
-    // Increment period counter (by period_increment for throttled controllers)
-    period_ += parameters_.period_increment();
+    // Move to next period (by period_increment for throttled controllers)
+    cursor_.advance();
 }
 
 } // namespace motion_control
@@ -17,6 +17,8 @@
 #include "log.h"
 #include "motion_control_common/Controller.hpp"
 #include "motion_control_common/ControllersIO.hpp"
+#include "motion_control_common/ProfileCursor.hpp"
+#include "motion_control_common/SCurveProfile.hpp"
 #include "motion_control_common/TrapezoidalProfile.hpp"
 
 namespace cogip {
@@ -25,13 +27,13 @@ namespace motion_control {
 
 /// @brief Profile Tracker controller
 ///
-/// This controller generates an optimal trapezoidal velocity profile and outputs:
+/// This controller generates an optimal velocity profile and outputs:
 /// 1. **Tracker velocity**: theoretical velocity from the profile
 /// 2. **Tracking error**: difference between actual and theoretical remaining distance
 ///
 /// **Workflow:**
 /// - When `new_target` flag is set:
-///   - Generate trapezoidal profile with initial `pose_error` (total distance)
+///   - Generate velocity profile with initial `pose_error` (total distance)
 ///   - Reset period counter
 /// - Every cycle:
 ///   - Compute tracker velocity from profile
@@ -39,6 +41,9 @@ namespace motion_control {
 ///   - Read actual remaining distance (pose_error updated by odometry)
 ///   - Compute tracking error = actual_remaining - theoretical_remaining
 ///
+/// The profile is trapezoidal, or jerk-limited (S-curve) if the `jerk` parameter
+/// is positive.
+///
 /// **Usage:**
 /// The tracking error output should be fed to a PosePIDController for correction.
 /// The tracker velocity should be combined with PID output (addition).
@@ -73,14 +78,29 @@ class ProfileTrackerController
     /// Called when changing target to reinitialize profile and period counter.
     void reset() override
     {
-        profile_.reset();
-        period_ = 0;
+        profile_->reset();
+        cursor_.start(*profile_);
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
+    /// @brief Get the state a profile recomputed this cycle starts from
+    /// @param current_speed             Speed read from the current_speed key
+    /// @param replan_profile            The recomputed profile continues the running one
+    /// @param[out] initial_acceleration Acceleration at the start of the profile
+    /// @return Speed at the start of the profile: the commanded velocity of the running profile
+    ///         when replanning it, current_speed otherwise
+    float initial_speed(float current_speed, bool replan_profile,
+                        float& initial_acceleration) const;
+
     /// @brief Execute profile tracker computation
     ///
     /// 1. Check if new_target flag is set
-    ///    - If yes: generate new trapezoidal profile with pose_error as target distance
+    ///    - If yes: generate new velocity profile with pose_error as target distance,
+    ///      from current_speed, or from the commanded velocity and acceleration of the
+    ///      running profile if replan_profile is also set
     /// 2. Compute tracker velocity from profile
     /// 3. Compute theoretical remaining distance from profile
     /// 4. Read actual remaining distance (pose_error)
@@ -95,13 +115,30 @@ class ProfileTrackerController
     /// @brief Execute speed mode (target_speed + duration_periods)
     void execute_speed_mode(ControllersIO& io);
 
-    /// @brief Generate a trapezoidal profile and reset period counter
+    /// @brief Generate a velocity profile of the type selected by parameters and restart the
+    ///        cursor
+    /// @param sync_periods Duration to stretch the profile to, if longer than the fastest
+    ///                     profile (0 to disable)
+    /// @param initial_acceleration Acceleration at the start of the profile, only continued
+    ///                             by jerk-limited profiles
     /// @return true if profile was generated, false if generation failed
     bool generate_profile(float target_distance, float initial_speed, float max_speed,
-                          bool must_stop);
+                          bool must_stop, float final_speed = 0.0f, uint32_t sync_periods = 0,
+                          float initial_acceleration = 0.0f);
+
+    /// @brief Compute the plateau speed of a profile covering a distance in a duration
+    /// @param distance  Distance to cover (positive magnitude)
+    /// @param max_speed Maximum plateau speed
+    /// @param periods   Duration of the profile
+    /// @param must_stop If true, the profile stops at the end
+    /// @return Lowest plateau speed covering the distance, from rest, in the duration
+    float compute_speed_for_duration(float distance, float max_speed, uint32_t periods,
+                                     bool must_stop) const;
 
-    TrapezoidalProfile profile_; ///< Trapezoidal velocity profile generator
-    uint32_t period_;            ///< Current period counter
+    TrapezoidalProfile trapezoidal_profile_; ///< Trapezoidal velocity profile generator
+    SCurveProfile scurve_profile_;           ///< Jerk-limited velocity profile generator
+    VelocityProfile* profile_;               ///< Profile of the current target
+    ProfileCursor cursor_;                   ///< Current period of the profile
 };
 
 } // namespace motion_control
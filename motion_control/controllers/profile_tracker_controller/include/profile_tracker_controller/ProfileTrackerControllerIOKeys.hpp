@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -25,18 +25,25 @@ namespace motion_control {
 ///
 /// Profile lifecycle is controlled by:
 /// - recompute_profile: triggers generation of a new profile
+/// - replan_profile: with recompute_profile, the new profile continues the running one
 struct ProfileTrackerControllerIOKeys
 {
-    etl::string_view pose_error;    ///< e.g. "linear_pose_error" (distance remaining, input from
-                                    ///< PoseStraightFilter)
-    etl::string_view current_speed; ///< e.g. "current_linear_speed"
-    etl::string_view recompute_profile; ///< e.g. "linear_recompute_profile" (flag to regenerate
-                                        ///< profile, from PoseStraightFilter)
-    etl::string_view tracker_velocity;  ///< e.g. "linear_tracker_velocity" (output)
-    etl::string_view tracking_error;    ///< e.g. "linear_tracking_error" (output)
-    etl::string_view profile_complete;  ///< e.g. "linear_profile_complete" (output, optional)
-    etl::string_view target_speed;      ///< e.g. "linear_target_speed" (optional, from path)
-    etl::string_view duration_periods;  ///< e.g. "timeout_duration_period" (speed_mode only)
+    IOKey pose_error;        ///< e.g. "linear_pose_error" (distance remaining, input from
+                             ///< PoseStraightFilter)
+    IOKey current_speed;     ///< e.g. "current_linear_speed"
+    IOKey recompute_profile; ///< e.g. "linear_recompute_profile" (flag to regenerate profile, from
+                             ///< PoseStraightFilter)
+    IOKey tracker_velocity;  ///< e.g. "linear_tracker_velocity" (output)
+    IOKey tracking_error;    ///< e.g. "linear_tracking_error" (output)
+    IOKey profile_complete;  ///< e.g. "linear_profile_complete" (output, optional)
+    IOKey target_speed;      ///< e.g. "linear_target_speed" (optional, from path)
+    IOKey final_speed;       ///< e.g. "linear_final_speed" (optional, from path: speed at the
+                             ///< end of the profile when must_stop_at_end, 0 to stop)
+    IOKey duration_periods;  ///< e.g. "timeout_duration_period" (speed_mode only)
+    IOKey sync_periods;      ///< e.g. "profile_sync_periods" (optional, from ProfileSyncController:
+                             ///< duration shared by linear and angular profiles)
+    IOKey replan_profile;    ///< e.g. "replan_profile" (optional, from PoseStraightFilter: splice
+                             ///< the recomputed profile onto the running one)
 };
 
 } // namespace motion_control
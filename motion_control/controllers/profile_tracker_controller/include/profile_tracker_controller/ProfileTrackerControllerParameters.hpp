@@ -28,11 +28,12 @@ class ProfileTrackerControllerParameters
         uint16_t period_increment =
             1, ///< [in] Period increment per execute (for throttled controllers)
         bool speed_mode =
-            false ///< [in] Speed mode: use target_speed + duration_periods instead of pose_error
+            false, ///< [in] Speed mode: use target_speed + duration_periods instead of pose_error
+        float jerk = 0.0f ///< [in] Jerk (mm/period³ or rad/period³), 0 for trapezoidal profiles
         )
         : max_speed_(max_speed), acceleration_(acceleration), deceleration_(deceleration),
           must_stop_at_end_(must_stop_at_end), period_increment_(period_increment),
-          speed_mode_(speed_mode)
+          speed_mode_(speed_mode), jerk_(jerk)
     {
     }
 
@@ -108,6 +109,18 @@ class ProfileTrackerControllerParameters
         speed_mode_ = speed_mode;
     }
 
+    /// Get jerk. A positive jerk selects jerk-limited (S-curve) profiles.
+    float jerk() const
+    {
+        return jerk_;
+    }
+
+    /// Set jerk, 0 for trapezoidal profiles
+    void set_jerk(float jerk)
+    {
+        jerk_ = jerk;
+    }
+
   private:
     float max_speed_;           ///< Maximum velocity limit
     float acceleration_;        ///< Maximum acceleration
@@ -115,6 +128,7 @@ class ProfileTrackerControllerParameters
     bool must_stop_at_end_;     ///< Stop at end or continue
     uint16_t period_increment_; ///< Period increment per execute (for throttling)
     bool speed_mode_;           ///< Use target_speed + duration instead of pose_error
+    float jerk_;                ///< Maximum jerk, 0 for trapezoidal profiles
 };
 
 } // namespace motion_control
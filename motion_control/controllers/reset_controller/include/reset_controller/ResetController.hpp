@@ -18,6 +18,7 @@
 // Project includes
 #include "motion_control_common/BaseController.hpp"
 #include "motion_control_common/ControllersIO.hpp"
+#include "motion_control_common/IOKey.hpp"
 
 #include "log.h"
 
@@ -31,8 +32,8 @@ static constexpr size_t RESET_CONTROLLER_MAX_KEYS = 8;
 /// @brief Pair of key name and initial value to reset
 struct ResetKeyValue
 {
-    etl::string_view key; ///< IO key name to reset
-    float value;          ///< Initial value to set
+    IOKey key;   ///< IO key to reset
+    float value; ///< Initial value to set
 };
 
 /// @brief Controller that resets specified IO keys to their initial values.
@@ -60,6 +61,15 @@ class ResetController : public BaseController
         return "ResetController";
     }
 
+    /// @brief Declare the IO keys written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override
+    {
+        for (const auto& kv : keys_values_) {
+            linker.writes(kv.key);
+        }
+    }
+
     /// @brief Reset all configured IO keys to their initial values.
     /// @param io Shared ControllersIO to reset values in
     void execute(ControllersIO& io) override
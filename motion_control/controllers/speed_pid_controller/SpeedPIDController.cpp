@@ -8,6 +8,43 @@ namespace cogip {
 
 namespace motion_control {
 
+void SpeedPIDController::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.reset);
+    linker.reads(keys_.speed_order);
+    linker.reads(keys_.current_speed);
+    linker.writes(keys_.reset);
+    linker.writes(keys_.speed_command);
+}
+
+void SpeedPIDController::handoff(const ControllersIO& io)
+{
+    if (!this->parameters_.pid()) {
+        return;
+    }
+
+    // Nothing to continue from if no speed command was computed yet
+    auto speed_command = io.get_as<float>(keys_.speed_command);
+    if (!speed_command) {
+        return;
+    }
+
+    float speed_order = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.speed_order)) {
+        speed_order = *opt;
+    }
+
+    float current_speed = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.current_speed)) {
+        current_speed = *opt;
+    }
+
+    this->parameters_.pid()->warm_start(speed_order - current_speed, *speed_command);
+
+    DEBUG("SpeedPID: handoff cmd=%.2f integral=%.2f\n", static_cast<double>(*speed_command),
+          static_cast<double>(this->parameters_.pid()->integral_term()));
+}
+
 void SpeedPIDController::execute(ControllersIO& io)
 {
     DEBUG("Start SpeedPIDController\n");
@@ -27,18 +64,12 @@ void SpeedPIDController::execute(ControllersIO& io)
     float speed_order = 0.0f;
     if (auto opt = io.get_as<float>(keys_.speed_order)) {
         speed_order = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.speed_order.data(), speed_order);
     }
 
     // Read current speed (default to 0.0f if missing)
     float current_speed = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_speed)) {
         current_speed = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_speed.data(), current_speed);
     }
 
     // Compute speed error
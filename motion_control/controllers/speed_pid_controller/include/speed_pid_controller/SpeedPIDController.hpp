@@ -54,6 +54,17 @@ class SpeedPIDController : public Controller<SpeedPIDControllerIOKeys, SpeedPIDC
         }
     }
 
+    /// @brief Continue from the speed command of the previous chain.
+    /// The PID integral term is back-calculated from the speed command, speed
+    /// order and current speed found in the IO, so the first command computed
+    /// by this controller matches the last one applied to the motors.
+    /// @param io Shared ControllersIO still holding the previous chain outputs.
+    void handoff(const ControllersIO& io) override;
+
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Read speed error, compute speed command.
     void execute(ControllersIO& io) override;
 };
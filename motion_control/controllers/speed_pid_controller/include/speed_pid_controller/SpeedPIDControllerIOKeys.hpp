@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,10 +20,10 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a SpeedPIDController.
 struct SpeedPIDControllerIOKeys
 {
-    etl::string_view speed_order;   ///< e.g. "speed_order"
-    etl::string_view current_speed; ///< e.g. "current_speed"
-    etl::string_view speed_command; ///< e.g. "speed_command"
-    etl::string_view reset;         ///< e.g. "reset" - triggers PID reset when true
+    IOKey speed_order;   ///< e.g. "speed_order"
+    IOKey current_speed; ///< e.g. "current_speed"
+    IOKey speed_command; ///< e.g. "speed_command"
+    IOKey reset;         ///< e.g. "reset" - triggers PID reset when true
 };
 
 } // namespace motion_control
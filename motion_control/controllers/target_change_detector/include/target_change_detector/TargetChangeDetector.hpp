@@ -80,6 +80,16 @@ class TargetChangeDetector
     /// Only a real change in watched keys should trigger new_target.
     void reset() override {}
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override
+    {
+        for (size_t i = 0; i < MAX_KEYS; i++) {
+            linker.reads(this->keys_.watched_keys[i]);
+        }
+        linker.writes(this->keys_.new_target);
+    }
+
     /// @brief Execute target change detection
     void execute(ControllersIO& io) override
     {
@@ -97,9 +107,6 @@ class TargetChangeDetector
             if (auto opt = io.get(this->keys_.watched_keys[i])) {
                 current_values[i] = *opt;
             } else {
-                LOG_WARNING("TargetChangeDetector: key %.*s not available\n",
-                            static_cast<int>(this->keys_.watched_keys[i].size()),
-                            this->keys_.watched_keys[i].data());
                 io.set(this->keys_.new_target, false);
                 return;
             }
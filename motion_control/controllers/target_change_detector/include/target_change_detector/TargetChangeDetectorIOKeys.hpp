@@ -11,8 +11,8 @@
 
 #pragma once
 
+#include "motion_control_common/IOKey.hpp"
 #include <etl/array.h>
-#include <etl/string_view.h>
 
 namespace cogip {
 
@@ -27,8 +27,8 @@ namespace motion_control {
 /// @tparam MAX_KEYS Maximum number of IO keys to watch (default 4)
 template <size_t MAX_KEYS = 4> struct TargetChangeDetectorIOKeys
 {
-    etl::array<etl::string_view, MAX_KEYS> watched_keys = {}; ///< IO keys to watch (empty to skip)
-    etl::string_view new_target;                              ///< e.g. "new_target" (output flag)
+    etl::array<IOKey, MAX_KEYS> watched_keys = {}; ///< IO keys to watch (empty to skip)
+    IOKey new_target;                              ///< e.g. "new_target" (output flag)
 };
 
 } // namespace motion_control
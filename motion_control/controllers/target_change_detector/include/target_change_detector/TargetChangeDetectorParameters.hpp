@@ -25,7 +25,7 @@ class TargetChangeDetectorParameters
   public:
     /// @brief Constructor
     /// @param epsilon Tolerance for float comparison (default 1e-3).
-    ///                For mm/deg targets this filters serialisation noise
+    ///                For mm/rad targets this filters serialisation noise
     ///                (e.g. -400.00000000000006 vs -400.0) while staying
     ///                well below any meaningful motion.
     explicit TargetChangeDetectorParameters(float epsilon = 1e-3f) : epsilon_(epsilon) {}
@@ -9,26 +9,31 @@ namespace cogip {
 
 namespace motion_control {
 
+void TelemetryController::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.speed_order);
+    linker.reads_optional(keys_.tracker_velocity);
+    linker.reads_optional(keys_.current_speed);
+    linker.reads_optional(keys_.pose_error);
+}
+
 void TelemetryController::execute(ControllersIO& io)
 {
     DEBUG("Start TelemetryController\n");
 
-    const float period_to_sec = 1000.0f / parameters_.loop_period_ms;
+    const float period_to_sec = parameters_.unit_scale * 1000.0f / parameters_.loop_period_ms;
 
     if (auto opt = io.get_as<float>(keys_.speed_order)) {
-        telemetry::Telemetry::send<float>(cogip::utils::hash_key(keys_.speed_order),
-                                          *opt * period_to_sec);
+        telemetry::Telemetry::send<float>(keys_.speed_order.hash(), *opt * period_to_sec);
     }
     if (auto opt = io.get_as<float>(keys_.tracker_velocity)) {
-        telemetry::Telemetry::send<float>(cogip::utils::hash_key(keys_.tracker_velocity),
-                                          *opt * period_to_sec);
+        telemetry::Telemetry::send<float>(keys_.tracker_velocity.hash(), *opt * period_to_sec);
     }
     if (auto opt = io.get_as<float>(keys_.current_speed)) {
-        telemetry::Telemetry::send<float>(cogip::utils::hash_key(keys_.current_speed),
-                                          *opt * period_to_sec);
+        telemetry::Telemetry::send<float>(keys_.current_speed.hash(), *opt * period_to_sec);
     }
     if (auto opt = io.get_as<float>(keys_.pose_error)) {
-        telemetry::Telemetry::send<float>(cogip::utils::hash_key(keys_.pose_error), *opt);
+        telemetry::Telemetry::send<float>(keys_.pose_error.hash(), *opt * parameters_.unit_scale);
     }
 
     DEBUG("End TelemetryController\n");
@@ -45,6 +45,10 @@ class TelemetryController
         return "TelemetryController";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Execute telemetry controller operations.
     void execute(ControllersIO& io) override;
 };
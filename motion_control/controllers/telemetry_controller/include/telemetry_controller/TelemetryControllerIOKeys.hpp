@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,10 +20,10 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a TelemetryController.
 struct TelemetryControllerIOKeys
 {
-    etl::string_view speed_order;      ///< e.g. "speed_order"
-    etl::string_view current_speed;    ///< e.g. "current_speed"
-    etl::string_view tracker_velocity; ///< e.g. "tracker_velocity"
-    etl::string_view pose_error;       ///< e.g. "linear_pose_error"
+    IOKey speed_order;      ///< e.g. "speed_order"
+    IOKey current_speed;    ///< e.g. "current_speed"
+    IOKey tracker_velocity; ///< e.g. "tracker_velocity"
+    IOKey pose_error;       ///< e.g. "linear_pose_error"
 };
 
 } // namespace motion_control
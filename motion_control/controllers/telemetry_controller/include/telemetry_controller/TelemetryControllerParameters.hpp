@@ -21,6 +21,7 @@ namespace motion_control {
 struct TelemetryControllerParameters
 {
     uint32_t loop_period_ms; ///< Motion control loop period (ms), for unit conversion
+    float unit_scale = 1.0f; ///< Scale from internal to reported units (e.g. rad to deg)
 };
 
 } // namespace motion_control
@@ -23,6 +23,14 @@ namespace cogip {
 
 namespace motion_control {
 
+void TrackerCombinerController::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.tracker_velocity);
+    linker.reads(keys_.feedback_correction);
+    linker.writes(keys_.speed_order);
+    linker.writes(keys_.speed_command);
+}
+
 void TrackerCombinerController::execute(ControllersIO& io)
 {
     DEBUG("Execute TrackerCombinerController");
@@ -31,16 +39,12 @@ void TrackerCombinerController::execute(ControllersIO& io)
     float tracker_velocity = 0.0f;
     if (auto opt = io.get_as<float>(keys_.tracker_velocity)) {
         tracker_velocity = *opt;
-    } else {
-        LOG_WARNING("TrackerCombinerController: tracker_velocity not available, using 0.0\n");
     }
 
     // Read feedback correction (default to 0.0 if missing)
     float feedback_correction = 0.0f;
     if (auto opt = io.get_as<float>(keys_.feedback_correction)) {
         feedback_correction = *opt;
-    } else {
-        LOG_WARNING("TrackerCombinerController: feedback_correction not available, using 0.0\n");
     }
 
     // Combine: speed_order = tracker + feedback
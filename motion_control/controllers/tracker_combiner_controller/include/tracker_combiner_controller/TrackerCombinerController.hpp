@@ -56,6 +56,10 @@ class TrackerCombinerController
         return "TrackerCombinerController";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Read tracker_velocity and feedback_correction,
     ///        add them, and write to speed_order
     /// @param io Controller IO map
@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -22,10 +22,10 @@ namespace motion_control {
 /// This controller simply adds tracker velocity and feedback correction.
 struct TrackerCombinerControllerIOKeys
 {
-    etl::string_view tracker_velocity;    ///< e.g. "linear_tracker_velocity"
-    etl::string_view feedback_correction; ///< e.g. "linear_feedback_correction"
-    etl::string_view speed_order;         ///< e.g. "linear_speed_order" (output for telemetry)
-    etl::string_view speed_command;       ///< e.g. "linear_speed_command" (output for motors)
+    IOKey tracker_velocity;    ///< e.g. "linear_tracker_velocity"
+    IOKey feedback_correction; ///< e.g. "linear_feedback_correction"
+    IOKey speed_order;         ///< e.g. "linear_speed_order" (output for telemetry)
+    IOKey speed_command;       ///< e.g. "linear_speed_command" (output for motors)
 };
 
 } // namespace motion_control
@@ -8,7 +8,6 @@
 
 #include "etl/absolute.h"
 #include "etl/algorithm.h"
-#include "etl/math_constants.h"
 
 #include "cogip_defs/Polar.hpp"
 #include "trigonometry.h"
@@ -34,9 +33,9 @@ int DifferentialDriveController::set_polar_velocity(cogip_defs::Polar& command)
 {
     // Compute wheel speed in mm/period from polar speed
     const float left_wheel_speed_mm_per_period =
-        command.distance() - (DEG2RAD(command.angle()) * parameters_.track_width_mm() / 2);
+        command.distance() - (command.angle() * parameters_.track_width_mm() / 2);
     const float right_wheel_speed_mm_per_period =
-        command.distance() + (DEG2RAD(command.angle()) * parameters_.track_width_mm() / 2);
+        command.distance() + (command.angle() * parameters_.track_width_mm() / 2);
 
     // Compute wheel speed in mm/s and rad/s from mm/period and rad/period speeds
     const float left_wheel_speed_mm_per_s =
@@ -48,10 +47,10 @@ int DifferentialDriveController::set_polar_velocity(cogip_defs::Polar& command)
     // The motor constant allow convert a speed in mm/s into a speed ratio (% of
     // nominal motor voltage).
     float left_motor_speed_percent =
-        (left_wheel_speed_mm_per_s / (etl::math::pi * parameters_.left_wheel_diameter_mm())) *
+        (left_wheel_speed_mm_per_s / (FAST_MATH_PI * parameters_.left_wheel_diameter_mm())) *
         parameters_.left_motor_constant();
     float right_motor_speed_percent =
-        (right_wheel_speed_mm_per_s / (etl::math::pi * parameters_.right_wheel_diameter_mm())) *
+        (right_wheel_speed_mm_per_s / (FAST_MATH_PI * parameters_.right_wheel_diameter_mm())) *
         parameters_.right_motor_constant();
 
     if (etl::absolute(left_motor_speed_percent) < parameters_.min_speed_percentage()) {
@@ -20,6 +20,15 @@ namespace cogip {
 
 namespace motion_control {
 
+/// Engine IO keys, hashed at compile time and resolved at link time
+static const IOKey current_pose_key("current_pose");
+static const IOKey target_pose_key("target_pose");
+static const IOKey current_speed_key("current_speed");
+static const IOKey target_speed_key("target_speed");
+static const IOKey pose_reached_key("pose_reached");
+static const IOKey new_target_key("new_target");
+static const IOKey speed_command_key("speed_command");
+
 MotorEngine::MotorEngine(motor::MotorInterface& motor, localization::OdometerInterface& odometer,
                          uint32_t engine_thread_period_ms)
     : BaseControllerEngine(engine_thread_period_ms), target_speed_(0), target_distance_(0),
@@ -63,22 +72,22 @@ void MotorEngine::prepare_inputs()
 
     if (controller_) {
         // Current distance
-        io_.set("current_pose", current_distance);
+        io_.set(current_pose_key, current_distance);
 
         // Target distance
-        io_.set("target_pose", target_distance_);
+        io_.set(target_pose_key, target_distance_);
 
         // Current speed
-        io_.set("current_speed", current_speed);
+        io_.set(current_speed_key, current_speed);
 
         // Target speed
-        io_.set("target_speed", target_speed_);
+        io_.set(target_speed_key, target_speed_);
 
         // Position reached flag
-        io_.set("pose_reached", target_pose_status_t::moving);
+        io_.set(pose_reached_key, target_pose_status_t::moving);
 
         // New target flag for profile tracker recomputation
-        io_.set("new_target", new_target_);
+        io_.set(new_target_key, new_target_);
         // Clear the flag after writing to IO (one-shot)
         new_target_ = false;
 
@@ -87,6 +96,18 @@ void MotorEngine::prepare_inputs()
     }
 };
 
+void MotorEngine::link_inputs(ChainLinker& linker) const
+{
+    BaseControllerEngine::link_inputs(linker);
+
+    linker.provides(current_pose_key);
+    linker.provides(target_pose_key);
+    linker.provides(current_speed_key);
+    linker.provides(target_speed_key);
+    linker.provides(pose_reached_key);
+    linker.provides(new_target_key);
+}
+
 void MotorEngine::process_outputs()
 {
     // Continuously clear motor driver overload fault if pin is configured
@@ -97,7 +118,7 @@ void MotorEngine::process_outputs()
     // If timeout is enabled, pose_reached_ has been set by the engine itself, do
     // not override it.
     if (pose_reached_ != target_pose_status_t::timeout) {
-        pose_reached_ = io_.get_as<target_pose_status_t>("pose_reached").value();
+        pose_reached_ = io_.get_as<target_pose_status_t>(pose_reached_key).value();
     } else {
         LOG_ERROR("MotorEngine timed out, hold. current=%.2f target=%.2f\n",
                   static_cast<double>(odometer_.distance_mm()),
@@ -147,7 +168,7 @@ void MotorEngine::process_outputs()
         timeout_enable_ = false;
     }
 
-    float command = io_.get_as<float>("speed_command").value();
+    float command = io_.get_as<float>(speed_command_key).value();
 
     DEBUG("MotorEngine output: speed_command=%.2f\n", static_cast<double>(command));
 
@@ -98,6 +98,9 @@ class MotorEngine : public BaseControllerEngine
     /// Process controller output for motor restitution.
     void process_outputs();
 
+    /// Declare the keys written by prepare_inputs() for the link phase.
+    void link_inputs(ChainLinker& linker) const override;
+
     /// Motor polar target speed
     float target_speed_;
 
@@ -2,6 +2,7 @@
 #include <ztimer.h>
 
 // System includes
+#include <cinttypes>
 #include <cstdio>
 
 // Project includes
@@ -19,35 +20,78 @@ namespace cogip {
 
 namespace motion_control {
 
+/// Engine IO keys, hashed at compile time and resolved at link time
+static const IOKey current_pose_x_key("current_pose_x");
+static const IOKey current_pose_y_key("current_pose_y");
+static const IOKey current_pose_O_key("current_pose_O");
+static const IOKey linear_current_speed_key("linear_current_speed");
+static const IOKey angular_current_speed_key("angular_current_speed");
+static const IOKey linear_target_speed_key("linear_target_speed");
+static const IOKey angular_target_speed_key("angular_target_speed");
+static const IOKey path_complete_key("path_complete");
+static const IOKey pose_reached_key("pose_reached");
+static const IOKey linear_speed_command_key("linear_speed_command");
+static const IOKey angular_speed_command_key("angular_speed_command");
+static const IOKey linear_speed_order_key("linear_speed_order");
+static const IOKey angular_speed_order_key("angular_speed_order");
+static const IOKey new_target_key("new_target");
+static const IOKey current_pose_covariance_xx_key("current_pose_covariance_xx");
+static const IOKey current_pose_covariance_yy_key("current_pose_covariance_yy");
+static const IOKey current_pose_covariance_OO_key("current_pose_covariance_OO");
+
+/// Consecutive failed localization updates tolerated before stopping the motors
+constexpr uint32_t localization_failures_max = 3;
+
 PlatformEngine::PlatformEngine(localization::LocalizationInterface& localization,
                                drive_controller::DriveControllerInterface& drive_contoller,
                                path::Path& path, pose_reached_cb_t pose_reached_cb,
                                uint32_t engine_thread_period_ms)
     : BaseControllerEngine(engine_thread_period_ms), localization_(localization),
-      drive_contoller_(drive_contoller), path_(path), pose_reached_cb_(pose_reached_cb)
+      drive_contoller_(drive_contoller), path_(path), pose_reached_cb_(pose_reached_cb),
+      localization_failures_(0)
 {
 }
 
 void PlatformEngine::prepare_inputs()
 {
-    // Update current pose and speed
-    localization_.update();
+    // Update current pose and speed. On failure, the previous pose and speed
+    // are kept, and process_outputs() stops the motors if it lasts.
+    const int localization_status = localization_.update();
+    if (localization_status) {
+        if (localization_failures_ == 0) {
+            LOG_WARNING("Engine: localization update failed, error=%d\n", localization_status);
+        }
+        localization_failures_++;
+    } else if (localization_failures_) {
+        LOG_INFO("Engine: localization recovered after %" PRIu32 " cycles\n",
+                 localization_failures_);
+        localization_failures_ = 0;
+    }
 
     // Reset read-only markers to allow engine updates
     io_.reset_readonly_markers();
 
     // Current pose
-    io_.set("current_pose_x", localization_.pose().x());
-    io_.set("current_pose_y", localization_.pose().y());
-    io_.set("current_pose_O", localization_.pose().O());
+    io_.set(current_pose_x_key, localization_.pose().x());
+    io_.set(current_pose_y_key, localization_.pose().y());
+    io_.set(current_pose_O_key, localization_.pose().O());
 
     // Current speed
-    io_.set("linear_current_speed", localization_.delta_polar_pose().distance());
-    io_.set("angular_current_speed", localization_.delta_polar_pose().angle());
+    io_.set(linear_current_speed_key, localization_.delta_polar_pose().distance());
+    io_.set(angular_current_speed_key, localization_.delta_polar_pose().angle());
+
+    // Current pose uncertainty, only the variances to spare IO slots
+    localization::PoseCovariance covariance;
+    const bool has_covariance = localization_.pose_covariance(covariance);
+    if (has_covariance) {
+        io_.set(current_pose_covariance_xx_key, covariance.xx);
+        io_.set(current_pose_covariance_yy_key, covariance.yy);
+        io_.set(current_pose_covariance_OO_key, covariance.OO);
+    }
 
     // Target speed
-    io_.set("linear_target_speed", target_speed_.distance());
-    io_.set("angular_target_speed", target_speed_.angle());
+    io_.set(linear_target_speed_key, target_speed_.distance());
+    io_.set(angular_target_speed_key, target_speed_.angle());
 
     // target_pose_x/y/O, motion_direction, is_intermediate and
     // bypass_final_orientation are all written by PathManagerFilter from the
@@ -56,30 +100,72 @@ void PlatformEngine::prepare_inputs()
     // there is no "single-target mode" where we would need a fallback.
 
     // Initialize path_complete to false (will be set by PathManagerFilter or PurePursuit)
-    io_.set("path_complete", false);
+    io_.set(path_complete_key, false);
 
     // Set pose_reached from engine state (will be updated by PoseStraightFilter)
     // Always write to propagate reset_pose_reached() and process_outputs() updates
-    io_.set("pose_reached", pose_reached_);
+    io_.set(pose_reached_key, pose_reached_);
 
     // Initialize speed commands to 0 (will be updated by SpeedPIDController)
-    io_.set("linear_speed_command", 0.0f);
-    io_.set("angular_speed_command", 0.0f);
+    io_.set(linear_speed_command_key, 0.0f);
+    io_.set(angular_speed_command_key, 0.0f);
 
     // Initialize speed orders to 0 (will be updated by PosePIDController or TrackerCombiner)
-    io_.set("linear_speed_order", 0.0f);
-    io_.set("angular_speed_order", 0.0f);
+    io_.set(linear_speed_order_key, 0.0f);
+    io_.set(angular_speed_order_key, 0.0f);
 
     // Mark measured values read‑only:
-    io_.mark_readonly("current_pose_x");
-    io_.mark_readonly("current_pose_y");
-    io_.mark_readonly("current_pose_O");
-    io_.mark_readonly("linear_current_speed");
-    io_.mark_readonly("angular_current_speed");
+    io_.mark_readonly(current_pose_x_key);
+    io_.mark_readonly(current_pose_y_key);
+    io_.mark_readonly(current_pose_O_key);
+    io_.mark_readonly(linear_current_speed_key);
+    io_.mark_readonly(angular_current_speed_key);
+    if (has_covariance) {
+        io_.mark_readonly(current_pose_covariance_xx_key);
+        io_.mark_readonly(current_pose_covariance_yy_key);
+        io_.mark_readonly(current_pose_covariance_OO_key);
+    }
 };
 
+void PlatformEngine::link_inputs(ChainLinker& linker) const
+{
+    BaseControllerEngine::link_inputs(linker);
+
+    linker.provides(current_pose_x_key);
+    linker.provides(current_pose_y_key);
+    linker.provides(current_pose_O_key);
+    linker.provides(linear_current_speed_key);
+    linker.provides(angular_current_speed_key);
+    linker.provides(linear_target_speed_key);
+    linker.provides(angular_target_speed_key);
+    linker.provides(path_complete_key);
+    linker.provides(pose_reached_key);
+    linker.provides(linear_speed_command_key);
+    linker.provides(angular_speed_command_key);
+    linker.provides(linear_speed_order_key);
+    linker.provides(angular_speed_order_key);
+
+    // Pose covariance only for localizations estimating it
+    localization::PoseCovariance covariance;
+    if (localization_.pose_covariance(covariance)) {
+        linker.provides(current_pose_covariance_xx_key);
+        linker.provides(current_pose_covariance_yy_key);
+        linker.provides(current_pose_covariance_OO_key);
+    }
+}
+
 void PlatformEngine::process_outputs()
 {
+    // Localization lost: stop rather than drive on outdated pose and speeds
+    if (localization_failures_ >= localization_failures_max) {
+        if (localization_failures_ == localization_failures_max) {
+            LOG_ERROR("Engine: localization lost, motors stopped\n");
+        }
+        cogip_defs::Polar zero_command(0, 0);
+        drive_contoller_.set_polar_velocity(zero_command);
+        return;
+    }
+
     // On timeout, stop motors immediately and notify platform
     if (pose_reached_ == target_pose_status_t::timeout) {
         cogip_defs::Polar zero_command(0, 0);
@@ -99,7 +185,7 @@ void PlatformEngine::process_outputs()
     if (!brake_) {
         // Check pose_reached from IO (set by controllers like PoseErrorFilter or
         // PoseStraightFilter)
-        auto io_pose_reached = io_.get_as<target_pose_status_t>("pose_reached");
+        auto io_pose_reached = io_.get_as<target_pose_status_t>(pose_reached_key);
         auto prev_pose_reached = pose_reached_;
 
         if (io_pose_reached && (*io_pose_reached == target_pose_status_t::reached ||
@@ -146,7 +232,7 @@ void PlatformEngine::process_outputs()
         if (pose_reached_ == prev_pose_reached &&
             (pose_reached_ == target_pose_status_t::reached ||
              pose_reached_ == target_pose_status_t::intermediate_reached)) {
-            auto new_target = io_.get_as<bool>("new_target");
+            auto new_target = io_.get_as<bool>(new_target_key);
             if (new_target && *new_target) {
                 force_moving_transition = true;
             }
@@ -159,7 +245,7 @@ void PlatformEngine::process_outputs()
             const float tx = wp ? wp->x() : 0.0f;
             const float ty = wp ? wp->y() : 0.0f;
             const float tO = wp ? wp->O() : 0.0f;
-            LOG_INFO("pose_reached=%d cur=(%.1f,%.1f,%.1f) tgt=(%.1f,%.1f,%.1f)\n",
+            LOG_INFO("pose_reached=%d cur=(%.1f,%.1f,%.3f) tgt=(%.1f,%.1f,%.3f)\n",
                      static_cast<int>(pose_reached_), static_cast<double>(cur.x()),
                      static_cast<double>(cur.y()), static_cast<double>(cur.O()),
                      static_cast<double>(tx), static_cast<double>(ty), static_cast<double>(tO));
@@ -191,8 +277,8 @@ void PlatformEngine::process_outputs()
         cogip_defs::Polar command(0, 0);
 
         DEBUG("Start process_outputs()\n");
-        command.set_distance(io_.get_as<float>("linear_speed_command").value());
-        command.set_angle(io_.get_as<float>("angular_speed_command").value());
+        command.set_distance(io_.get_as<float>(linear_speed_command_key).value());
+        command.set_angle(io_.get_as<float>(angular_speed_command_key).value());
         DEBUG("End process_outputs()\n");
 
         // Set robot polar velocity order
@@ -209,8 +295,8 @@ void PlatformEngine::process_outputs()
         // Brake-only path: still drive the motors with the brake chain's
         // speed command so the closed-loop hold actually runs.
         cogip_defs::Polar command(0, 0);
-        command.set_distance(io_.get_as<float>("linear_speed_command").value());
-        command.set_angle(io_.get_as<float>("angular_speed_command").value());
+        command.set_distance(io_.get_as<float>(linear_speed_command_key).value());
+        command.set_angle(io_.get_as<float>(angular_speed_command_key).value());
         drive_contoller_.set_polar_velocity(command);
     }
 };
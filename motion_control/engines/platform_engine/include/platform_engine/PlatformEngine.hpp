@@ -87,6 +87,9 @@ class PlatformEngine : public BaseControllerEngine
     /// Process controller output for platform restitution.
     void process_outputs();
 
+    /// Declare the keys written by prepare_inputs() for the link phase.
+    void link_inputs(ChainLinker& linker) const override;
+
     /// Robot polar target speed
     cogip_defs::Polar target_speed_;
 
@@ -101,6 +104,9 @@ class PlatformEngine : public BaseControllerEngine
 
     /// Pose reached callback
     pose_reached_cb_t pose_reached_cb_;
+
+    /// Consecutive failed localization updates
+    uint32_t localization_failures_;
 };
 
 } // namespace motion_control
@@ -27,6 +27,12 @@ namespace cogip {
 
 namespace motion_control {
 
+void AccelerationFilter::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.target_speed);
+    linker.writes(keys_.target_speed);
+}
+
 void AccelerationFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute AccelerationFilter\n");
@@ -36,7 +42,6 @@ void AccelerationFilter::execute(ControllersIO& io)
     if (auto opt = io.get_as<float>(keys_.target_speed)) {
         speed_order = *opt;
     } else {
-        LOG_WARNING("AccelerationFilter: speed_order not available\n");
         return;
     }
 
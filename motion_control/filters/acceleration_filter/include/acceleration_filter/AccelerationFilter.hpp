@@ -50,6 +50,10 @@ class AccelerationFilter : public Controller<AccelerationFilterIOKeys, Accelerat
         return "AccelerationFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// Execute the acceleration filter.
     void execute(ControllersIO& io) override;
 
@@ -59,6 +63,16 @@ class AccelerationFilter : public Controller<AccelerationFilterIOKeys, Accelerat
         previous_speed_order_ = 0.0f;
     }
 
+    /// @brief Continue from the speed order of the previous chain, so that
+    /// acceleration is limited from the speed actually commanded.
+    /// @param io Shared ControllersIO still holding the previous chain outputs.
+    void handoff(const ControllersIO& io) override
+    {
+        if (auto opt = io.get_as<float>(keys_.target_speed)) {
+            previous_speed_order_ = *opt;
+        }
+    }
+
   private:
     float previous_speed_order_; ///< Previous cycle's speed order for acceleration calculation
 };
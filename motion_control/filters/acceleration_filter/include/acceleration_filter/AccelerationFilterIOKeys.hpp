@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,9 +20,9 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for an AccelerationFilter.
 struct AccelerationFilterIOKeys
 {
-    etl::string_view target_speed; ///< key for target speed input
-    etl::string_view
-        output_speed; ///< key for output speed (optional, if empty modifies target_speed in-place)
+    IOKey target_speed; ///< key for target speed input
+    IOKey output_speed; ///< key for output speed (optional, if empty modifies target_speed
+                        ///< in-place)
 };
 
 } // namespace motion_control
@@ -9,14 +9,12 @@
 /// @brief      Deceleration filter implementation
 /// @author     Gilles DOFFE <g.doffe@gmail.com>
 
-// System includes
-#include <cmath>
-
 // ETL includes
 #include "etl/absolute.h"
 
 // Project includes
 #include "deceleration_filter/DecelerationFilter.hpp"
+#include "fast_math.h"
 #include "log.h"
 
 #define ENABLE_DEBUG 0
@@ -26,6 +24,14 @@ namespace cogip {
 
 namespace motion_control {
 
+void DecelerationFilter::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.pose_error);
+    linker.reads(keys_.current_speed);
+    linker.reads(keys_.target_speed);
+    linker.writes(keys_.target_speed);
+}
+
 void DecelerationFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute DecelerationFilter\n");
@@ -35,7 +41,6 @@ void DecelerationFilter::execute(ControllersIO& io)
     if (auto opt = io.get_as<float>(keys_.pose_error)) {
         pose_error = *opt;
     } else {
-        LOG_WARNING("DecelerationFilter: pose_error not available\n");
         return;
     }
 
@@ -43,17 +48,12 @@ void DecelerationFilter::execute(ControllersIO& io)
     float current_speed = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_speed)) {
         current_speed = *opt;
-    } else {
-        LOG_WARNING("DecelerationFilter: current_speed not available\n");
     }
 
     // Read speed order (default to 0.0 if missing)
     float speed_order = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_speed)) {
         speed_order = *opt;
-    } else {
-        LOG_WARNING("DecelerationFilter: speed_order '%.*s' not available\n",
-                    static_cast<int>(keys_.target_speed.size()), keys_.target_speed.data());
     }
 
     float deceleration = parameters_.deceleration();
@@ -74,7 +74,7 @@ void DecelerationFilter::execute(ControllersIO& io)
     // If remaining distance is less than braking distance, we need to decelerate
     if (abs_pose_error <= braking_distance) {
         // Compute deceleration speed: v = sqrt(2 * a * d)
-        float decel_speed = std::sqrt(2.0f * deceleration * abs_pose_error);
+        float decel_speed = fast_sqrtf(2.0f * deceleration * abs_pose_error);
 
         // Limit speed order to deceleration speed (only if it's lower)
         if (decel_speed < abs_speed_order) {
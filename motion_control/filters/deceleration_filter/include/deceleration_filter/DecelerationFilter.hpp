@@ -50,6 +50,10 @@ class DecelerationFilter : public Controller<DecelerationFilterIOKeys, Decelerat
         return "DecelerationFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// Execute the deceleration filter.
     void execute(ControllersIO& io) override;
 };
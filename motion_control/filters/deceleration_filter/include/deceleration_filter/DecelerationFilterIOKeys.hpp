@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,11 +20,10 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a DecelerationFilter.
 struct DecelerationFilterIOKeys
 {
-    etl::string_view pose_error;    ///< key for position error (distance to target)
-    etl::string_view current_speed; ///< key for measured current speed
-    etl::string_view target_speed;  ///< key for target speed (will be modified)
-    etl::string_view
-        output_speed; ///< key for output speed (optional, if set writes final value here)
+    IOKey pose_error;    ///< key for position error (distance to target)
+    IOKey current_speed; ///< key for measured current speed
+    IOKey target_speed;  ///< key for target speed (will be modified)
+    IOKey output_speed;  ///< key for output speed (optional, if set writes final value here)
 };
 
 } // namespace motion_control
@@ -9,6 +9,7 @@
 #include "etl/list.h"
 #include "etl/vector.h"
 
+#include "fast_math.h"
 #include "log.h"
 #include "motor_pose_filter/MotorPoseFilter.hpp"
 
@@ -19,6 +20,20 @@ namespace cogip {
 
 namespace motion_control {
 
+void MotorPoseFilter::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.current_pose);
+    linker.reads(keys_.target_pose);
+    linker.reads(keys_.current_speed);
+    linker.reads(keys_.target_speed);
+    linker.reads(keys_.pose_reached);
+    linker.writes(keys_.position_error);
+    linker.writes(keys_.current_speed);
+    linker.writes(keys_.filtered_speed);
+    linker.writes(keys_.speed_filter_flag);
+    linker.writes(keys_.pose_reached_out);
+}
+
 void MotorPoseFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute MotorPoseFilter\n");
@@ -27,45 +42,30 @@ void MotorPoseFilter::execute(ControllersIO& io)
     float current_pose = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_pose)) {
         current_pose = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_pose.data(), current_pose);
     }
 
     // Read target pose (default to zero if missing)
     float target_pose = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_pose)) {
         target_pose = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_pose.data(), target_pose);
     }
 
     // Read current speed (default to zero if missing)
     float current_speed = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_speed)) {
         current_speed = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_speed.data(), current_speed);
     }
 
     // Read target speed (default to zero if missing)
     float target_speed = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_speed)) {
         target_speed = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_speed.data(), target_speed);
     }
 
     // Read pose reached status (default to moving if missing)
     target_pose_status_t pose_reached = target_pose_status_t::moving;
     if (auto opt = io.get_as<target_pose_status_t>(keys_.pose_reached)) {
         pose_reached = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %d\n",
-                    keys_.pose_reached.data(), static_cast<int>(pose_reached));
     }
 
     // Compute pose difference
@@ -85,7 +85,7 @@ void MotorPoseFilter::execute(ControllersIO& io)
         // compute deceleration if needed
         float stopping_distance = (current_speed * current_speed) / (2.0f * decel);
         if (abs_error <= stopping_distance) {
-            target_speed = std::sqrt(2.0f * decel * abs_error);
+            target_speed = fast_sqrtf(2.0f * decel * abs_error);
         }
     }
 
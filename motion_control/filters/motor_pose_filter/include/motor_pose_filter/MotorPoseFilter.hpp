@@ -42,6 +42,10 @@ class MotorPoseFilter : public Controller<MotorPoseFilterIOKeys, MotorPoseFilter
         return "MotorPoseFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Compute pose error and decide filtered speed and pose reached
     /// status.
     /// @param io Shared controllers IOs.
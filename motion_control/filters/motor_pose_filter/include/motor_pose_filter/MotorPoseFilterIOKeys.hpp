@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 namespace motion_control {
@@ -20,16 +20,16 @@ namespace motion_control {
 ///        The application must supply the correct literals at runtime.
 struct MotorPoseFilterIOKeys
 {
-    etl::string_view current_pose;  ///< key for current pose input
-    etl::string_view target_pose;   ///< key for target pose input
-    etl::string_view current_speed; ///< key for current speed input
-    etl::string_view target_speed;  ///< key for target speed input
-    etl::string_view pose_reached;  ///< key for pose reached status input
-
-    etl::string_view position_error;    ///< key for pose error output
-    etl::string_view filtered_speed;    ///< key for filtered target speed output
-    etl::string_view speed_filter_flag; ///< key for speed filter flag output
-    etl::string_view pose_reached_out;  ///< key for updated pose reached status output
+    IOKey current_pose;  ///< key for current pose input
+    IOKey target_pose;   ///< key for target pose input
+    IOKey current_speed; ///< key for current speed input
+    IOKey target_speed;  ///< key for target speed input
+    IOKey pose_reached;  ///< key for pose reached status input
+
+    IOKey position_error;    ///< key for pose error output
+    IOKey filtered_speed;    ///< key for filtered target speed output
+    IOKey speed_filter_flag; ///< key for speed filter flag output
+    IOKey pose_reached_out;  ///< key for updated pose reached status output
 };
 
 } // namespace motion_control
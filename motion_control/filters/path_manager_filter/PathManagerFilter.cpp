@@ -20,6 +20,23 @@ namespace cogip {
 
 namespace motion_control {
 
+void PathManagerFilter::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.pose_reached);
+    linker.reads_optional(keys_.current_pose_x);
+    linker.reads_optional(keys_.current_pose_y);
+    linker.writes(keys_.new_target);
+    linker.writes(keys_.path_complete);
+    linker.writes(keys_.target_pose_x);
+    linker.writes(keys_.target_pose_y);
+    linker.writes(keys_.target_pose_O);
+    linker.writes(keys_.bypass_final_orientation);
+    linker.writes(keys_.motion_direction);
+    linker.writes(keys_.is_intermediate);
+    linker.writes(keys_.path_index);
+    linker.writes(keys_.final_speed);
+}
+
 void PathManagerFilter::execute(ControllersIO& io)
 {
     DEBUG("PathManagerFilter::execute\n");
@@ -39,11 +56,28 @@ void PathManagerFilter::execute(ControllersIO& io)
         return;
     }
 
-    // Check pose_reached from PoseStraightFilter
+    // Plan junction speeds once per path start, from the robot position
+    if (path.revision() != planned_revision_) {
+        float start_x = path.waypoints().front().x();
+        float start_y = path.waypoints().front().y();
+        if (!keys_.current_pose_x.empty() && !keys_.current_pose_y.empty()) {
+            if (auto opt = io.get_as<float>(keys_.current_pose_x)) {
+                start_x = *opt;
+            }
+            if (auto opt = io.get_as<float>(keys_.current_pose_y)) {
+                start_y = *opt;
+            }
+        }
+        planner_.plan(path, start_x, start_y, parameters_);
+        planned_revision_ = path.revision();
+    }
+
+    // Check pose_reached from PoseStraightFilter, intermediate_reached when flowing through
     bool pose_reached = false;
     if (!keys_.pose_reached.empty()) {
         if (auto opt = io.get_as<target_pose_status_t>(keys_.pose_reached)) {
-            pose_reached = (*opt == target_pose_status_t::reached);
+            pose_reached = (*opt == target_pose_status_t::reached) ||
+                           (*opt == target_pose_status_t::intermediate_reached);
         }
     }
 
@@ -54,12 +88,16 @@ void PathManagerFilter::execute(ControllersIO& io)
     // If current pose was reached
     if (pose_reached) {
         DEBUG("PathManagerFilter: pose reached! is_intermediate=%d\n", current->is_intermediate());
+        const bool flow_through = (planner_.junction_speed(path.current_index()) > 0.0f);
         if (current->is_intermediate() && path.advance()) {
             // Intermediate waypoint reached and advanced to next
             DEBUG("PathManagerFilter: intermediate pose reached, advancing\n");
 
-            // Reset all downstream controllers (state machines, profiles, etc.)
-            if (meta_) {
+            // Reset all downstream controllers (state machines, profiles, etc.),
+            // unless the waypoint is passed at junction speed: motion goes on
+            if (flow_through) {
+                DEBUG("PathManagerFilter: flowing through waypoint\n");
+            } else if (meta_) {
                 meta_->reset();
             } else {
                 LOG_WARNING("PathManagerFilter: meta_ is null, cannot reset!\n");
@@ -118,6 +156,11 @@ void PathManagerFilter::execute(ControllersIO& io)
         io.set(keys_.path_index, static_cast<float>(path.current_index()));
     }
 
+    // Emit speed at which to pass the current waypoint
+    if (!keys_.final_speed.empty()) {
+        io.set(keys_.final_speed, planner_.junction_speed(path.current_index()));
+    }
+
     DEBUG("PathManagerFilter: emitting waypoint %u/%u (x=%.1f, y=%.1f, O=%.1f, intermediate=%d)\n",
           static_cast<unsigned>(path.current_index() + 1), static_cast<unsigned>(path.size()),
           current->x(), current->y(), current->O(), current->is_intermediate());
@@ -0,0 +1,110 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    path_manager_filter
+/// @{
+/// @file
+/// @brief      Path velocity planner implementation
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#include "path_manager_filter/PathVelocityPlanner.hpp"
+
+#include "etl/algorithm.h"
+#include "trigonometry.h"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+void PathVelocityPlanner::plan(const path::Path& path, float start_x, float start_y,
+                               const PathManagerFilterParameters& parameters)
+{
+    junction_speeds_.clear();
+
+    const path::Path::PathContainer& waypoints = path.waypoints();
+    const size_t count = waypoints.size();
+    if (count == 0) {
+        return;
+    }
+
+    // Segment i goes from waypoint i - 1 (or start position) to waypoint i
+    etl::vector<float, path::Path::MAX_WAYPOINTS> lengths;
+    etl::vector<float, path::Path::MAX_WAYPOINTS> headings;
+    float previous_x = start_x;
+    float previous_y = start_y;
+    for (const path::Pose& waypoint : waypoints) {
+        const float dx = waypoint.x() - previous_x;
+        const float dy = waypoint.y() - previous_y;
+        lengths.push_back(fast_sqrtf(dx * dx + dy * dy));
+        headings.push_back(fast_atan2f(dy, dx));
+        previous_x = waypoint.x();
+        previous_y = waypoint.y();
+    }
+
+    junction_speeds_.resize(count, 0.0f);
+
+    const bool enabled = (parameters.junction_deviation() > 0.0f) &&
+                         (parameters.max_speed() > 0.0f) && (parameters.acceleration() > 0.0f) &&
+                         (parameters.deceleration() > 0.0f);
+    if (!enabled) {
+        return;
+    }
+
+    const float max_junction_angle = parameters.max_junction_angle();
+
+    // Junction speeds bounded by the turn angle, the last waypoint is a stop
+    for (size_t i = 0; i + 1 < count; i++) {
+        const path::Pose& waypoint = waypoints[i];
+        if (!waypoint.is_intermediate() || !waypoint.bypass_final_orientation() ||
+            (waypoint.get_motion_direction() != waypoints[i + 1].get_motion_direction()) ||
+            (lengths[i] <= 0.0f) || (lengths[i + 1] <= 0.0f)) {
+            continue;
+        }
+
+        const float turn = etl::absolute(limit_angle_rad(headings[i + 1] - headings[i]));
+        if (turn > max_junction_angle) {
+            continue;
+        }
+
+        // Largest speed keeping centripetal acceleration on the junction arc below the limit
+        const float cos_half_turn = fast_cosf(turn / 2.0f);
+        float speed = parameters.max_speed();
+        if (cos_half_turn < 1.0f) {
+            const float radius =
+                parameters.junction_deviation() * cos_half_turn / (1.0f - cos_half_turn);
+            speed = etl::min(speed, fast_sqrtf(parameters.acceleration() * radius));
+        }
+        junction_speeds_[i] = speed;
+    }
+
+    // Backward pass: junction speed must allow slowing down to the next one
+    for (size_t i = count - 1; i-- > 0;) {
+        const float next = junction_speeds_[i + 1];
+        junction_speeds_[i] =
+            etl::min(junction_speeds_[i],
+                     fast_sqrtf(next * next + 2.0f * parameters.deceleration() * lengths[i + 1]));
+    }
+
+    // Forward pass: junction speed must be reachable from the previous one, starting at rest
+    float previous = 0.0f;
+    for (size_t i = 0; i < count; i++) {
+        junction_speeds_[i] = etl::min(
+            junction_speeds_[i],
+            fast_sqrtf(previous * previous + 2.0f * parameters.acceleration() * lengths[i]));
+        previous = junction_speeds_[i];
+
+        DEBUG("PathVelocityPlanner: waypoint %u, junction speed %.2f\n", static_cast<unsigned>(i),
+              static_cast<double>(junction_speeds_[i]));
+    }
+}
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
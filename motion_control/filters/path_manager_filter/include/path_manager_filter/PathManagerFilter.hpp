@@ -17,6 +17,7 @@
 
 #include "PathManagerFilterIOKeys.hpp"
 #include "PathManagerFilterParameters.hpp"
+#include "PathVelocityPlanner.hpp"
 
 namespace cogip {
 
@@ -36,6 +37,11 @@ namespace motion_control {
 /// The filter emits target_pose coordinates for downstream filters
 /// (PoseStraightFilter) and signals path_complete when the final waypoint
 /// is reached.
+///
+/// When a path starts, a PathVelocityPlanner computes the speed at which
+/// each waypoint can be passed. It is emitted as final_speed for the linear
+/// profile of the segment. Waypoints passed at a non-zero speed do not reset
+/// the downstream controllers, so that motion continues on the next segment.
 class PathManagerFilter : public Controller<PathManagerFilterIOKeys, PathManagerFilterParameters>
 {
   public:
@@ -54,11 +60,17 @@ class PathManagerFilter : public Controller<PathManagerFilterIOKeys, PathManager
         return "PathManagerFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// Execute the path manager filter.
     void execute(ControllersIO& io) override;
 
   private:
-    path::Path& path_; ///< Path reference for waypoint navigation
+    path::Path& path_;              ///< Path reference for waypoint navigation
+    PathVelocityPlanner planner_;   ///< Junction speeds of the path
+    uint32_t planned_revision_ = 0; ///< Path revision of the planned junction speeds
 };
 
 } // namespace motion_control
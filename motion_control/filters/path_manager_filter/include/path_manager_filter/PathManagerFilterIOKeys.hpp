@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,16 +20,21 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a PathManagerFilter.
 struct PathManagerFilterIOKeys
 {
-    etl::string_view pose_reached;  ///< key for pose reached input (from PoseStraightFilter)
-    etl::string_view target_pose_x; ///< key for target X coordinate output
-    etl::string_view target_pose_y; ///< key for target Y coordinate output
-    etl::string_view target_pose_O; ///< key for target orientation output
-    etl::string_view new_target;    ///< key for new target flag output (triggers profile recompute)
-    etl::string_view path_complete; ///< key for path complete flag output
-    etl::string_view path_index;    ///< key for current path index output (debug)
-    etl::string_view bypass_final_orientation; ///< key for bypass final orientation output
-    etl::string_view motion_direction;         ///< key for motion direction output
-    etl::string_view is_intermediate;          ///< key for intermediate waypoint flag output
+    IOKey pose_reached;             ///< key for pose reached input (from PoseStraightFilter)
+    IOKey target_pose_x;            ///< key for target X coordinate output
+    IOKey target_pose_y;            ///< key for target Y coordinate output
+    IOKey target_pose_O;            ///< key for target orientation output
+    IOKey new_target;               ///< key for new target flag output (triggers profile recompute)
+    IOKey path_complete;            ///< key for path complete flag output
+    IOKey path_index;               ///< key for current path index output (debug)
+    IOKey bypass_final_orientation; ///< key for bypass final orientation output
+    IOKey motion_direction;         ///< key for motion direction output
+    IOKey is_intermediate;          ///< key for intermediate waypoint flag output
+    IOKey current_pose_x;           ///< key for current X coordinate input (optional, to plan
+                                    ///< junction speeds from the robot position)
+    IOKey current_pose_y;           ///< key for current Y coordinate input (optional)
+    IOKey final_speed;              ///< key for linear speed at the current waypoint output
+                                    ///< (0 to stop, junction speed to flow through)
 };
 
 } // namespace motion_control
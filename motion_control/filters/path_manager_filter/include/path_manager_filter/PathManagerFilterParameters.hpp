@@ -22,7 +22,19 @@ class PathManagerFilterParameters
 {
   public:
     /// Constructor.
-    explicit PathManagerFilterParameters(size_t max_waypoints = 32) : max_waypoints_(max_waypoints)
+    explicit PathManagerFilterParameters(
+        size_t max_waypoints = 32,       ///< [in] Maximum number of waypoints in path
+        float max_speed = 0.0f,          ///< [in] Maximum linear speed (mm/period)
+        float acceleration = 0.0f,       ///< [in] Maximum linear acceleration (mm/period²)
+        float deceleration = 0.0f,       ///< [in] Maximum linear deceleration (mm/period²)
+        float junction_deviation = 0.0f, ///< [in] Junction deviation (mm), 0 to stop at each
+                                         ///< waypoint
+        float max_junction_angle = 0.0f  ///< [in] Maximum turn angle to flow through a
+                                         ///< waypoint (rad)
+        )
+        : max_waypoints_(max_waypoints), max_speed_(max_speed), acceleration_(acceleration),
+          deceleration_(deceleration), junction_deviation_(junction_deviation),
+          max_junction_angle_(max_junction_angle)
     {
     }
 
@@ -32,8 +44,52 @@ class PathManagerFilterParameters
         return max_waypoints_;
     }
 
+    /// Get maximum linear speed (mm/period).
+    float max_speed() const
+    {
+        return max_speed_;
+    }
+
+    /// Get maximum linear acceleration (mm/period²).
+    float acceleration() const
+    {
+        return acceleration_;
+    }
+
+    /// Get maximum linear deceleration (mm/period²).
+    float deceleration() const
+    {
+        return deceleration_;
+    }
+
+    /// Get junction deviation (mm).
+    /// Distance between a waypoint and the arc on which it would be passed at
+    /// junction speed: the larger, the faster turns are passed. 0 disables the
+    /// velocity look-ahead.
+    float junction_deviation() const
+    {
+        return junction_deviation_;
+    }
+
+    /// Set junction deviation (mm).
+    void set_junction_deviation(float junction_deviation)
+    {
+        junction_deviation_ = junction_deviation;
+    }
+
+    /// Get maximum turn angle to flow through a waypoint (rad).
+    float max_junction_angle() const
+    {
+        return max_junction_angle_;
+    }
+
   private:
-    size_t max_waypoints_; ///< Maximum number of waypoints in path
+    size_t max_waypoints_;     ///< Maximum number of waypoints in path
+    float max_speed_;          ///< Maximum linear speed (mm/period)
+    float acceleration_;       ///< Maximum linear acceleration (mm/period²)
+    float deceleration_;       ///< Maximum linear deceleration (mm/period²)
+    float junction_deviation_; ///< Junction deviation (mm)
+    float max_junction_angle_; ///< Maximum turn angle to flow through a waypoint (rad)
 };
 
 } // namespace motion_control
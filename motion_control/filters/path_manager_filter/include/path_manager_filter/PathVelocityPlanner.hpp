@@ -0,0 +1,77 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    path_manager_filter
+/// @{
+/// @file
+/// @brief      Path velocity planner class declaration
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+
+#include <etl/vector.h>
+
+#include "path/Path.hpp"
+
+#include "PathManagerFilterParameters.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Velocity look-ahead over the waypoints of a path.
+///
+/// Computes the linear speed at which the robot can pass each waypoint
+/// (the junction speed), so that segment profiles chain without stopping:
+/// - a junction speed is bounded by the turn angle between the two
+///   segments: speed v is allowed if the centripetal acceleration v² / r
+///   on a circle deviating from the waypoint by junction_deviation does not
+///   exceed the acceleration limit,
+/// - a backward pass lowers each junction speed so that the robot can still
+///   slow down to the next junction speed on the following segment,
+/// - a forward pass lowers each junction speed to the speed reachable from
+///   the previous one on the segment.
+///
+/// Only waypoints the robot can flow through get a non-zero junction speed:
+/// intermediate waypoints bypassing their final orientation, with the same
+/// motion direction as the next one and a turn angle below
+/// max_junction_angle. The last waypoint speed is always 0.
+class PathVelocityPlanner
+{
+  public:
+    /// @brief Plan the junction speeds of a path.
+    /// @param path       Path to plan, from its first waypoint
+    /// @param start_x    Robot X coordinate at path start (mm)
+    /// @param start_y    Robot Y coordinate at path start (mm)
+    /// @param parameters Speed and acceleration limits
+    void plan(const path::Path& path, float start_x, float start_y,
+              const PathManagerFilterParameters& parameters);
+
+    /// @brief Get the speed at which to pass a waypoint.
+    /// @param index Waypoint index in the path
+    /// @return Junction speed (mm/period), 0 if the robot stops at this waypoint
+    float junction_speed(size_t index) const
+    {
+        return (index < junction_speeds_.size()) ? junction_speeds_[index] : 0.0f;
+    }
+
+    /// @brief Forget planned speeds: stop at every waypoint.
+    void reset()
+    {
+        junction_speeds_.clear();
+    }
+
+  private:
+    /// Junction speed of each waypoint (mm/period)
+    etl::vector<float, path::Path::MAX_WAYPOINTS> junction_speeds_;
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
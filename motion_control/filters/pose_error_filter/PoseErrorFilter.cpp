@@ -9,9 +9,6 @@
 /// @brief      Pose error filter implementation
 /// @author     Gilles DOFFE <g.doffe@gmail.com>
 
-// System includes
-#include <cmath>
-
 #include "etl/absolute.h"
 
 // Project includes
@@ -55,22 +52,22 @@ void PoseErrorFilter::execute_linear(ControllersIO& io, float& pose_error)
     // Compute Euclidean distance
     float dx = target_x - current_x;
     float dy = target_y - current_y;
-    float distance = std::sqrt(dx * dx + dy * dy);
+    float distance = fast_sqrtf(dx * dx + dy * dy);
 
     // Determine direction (bidirectional: choose optimal direction)
     // Compute angle from robot to target
-    float angle_to_target = std::atan2(dy, dx) * 180.0f / etl::math::pi;
+    float angle_to_target = fast_atan2f(dy, dx);
     // Compute angle difference with current heading
-    float angle_diff = limit_angle_deg(angle_to_target - current_O);
+    float angle_diff = limit_angle_rad(angle_to_target - current_O);
 
-    // If target is behind (|angle_diff| > 90°), go backward (negative distance)
-    if (etl::absolute(angle_diff) > 90.0f) {
+    // If target is behind (|angle_diff| > pi/2), go backward (negative distance)
+    if (etl::absolute(angle_diff) > FAST_MATH_HALF_PI) {
         pose_error = -distance;
     } else {
         pose_error = distance;
     }
 
-    DEBUG("PoseErrorFilter LINEAR: target=(%.1f, %.1f) current=(%.1f, %.1f, %.1f) error=%.1f\n",
+    DEBUG("PoseErrorFilter LINEAR: target=(%.1f, %.1f) current=(%.1f, %.1f, %.3f) error=%.1f\n",
           static_cast<double>(target_x), static_cast<double>(target_y),
           static_cast<double>(current_x), static_cast<double>(current_y),
           static_cast<double>(current_O), static_cast<double>(pose_error));
@@ -90,14 +87,30 @@ void PoseErrorFilter::execute_angular(ControllersIO& io, float& pose_error)
         current_O = *opt;
     }
 
-    // Compute angle difference (limited to [-180, 180])
-    pose_error = limit_angle_deg(target_O - current_O);
+    // Compute angle difference (limited to [-pi, pi])
+    pose_error = limit_angle_rad(target_O - current_O);
 
-    DEBUG("PoseErrorFilter ANGULAR: target_O=%.1f current_O=%.1f error=%.1f\n",
+    DEBUG("PoseErrorFilter ANGULAR: target_O=%.3f current_O=%.3f error=%.3f\n",
           static_cast<double>(target_O), static_cast<double>(current_O),
           static_cast<double>(pose_error));
 }
 
+void PoseErrorFilter::link(ChainLinker& linker) const
+{
+    if (parameters_.mode() == PoseErrorFilterMode::LINEAR) {
+        linker.reads(keys_.target_x);
+        linker.reads(keys_.target_y);
+        linker.reads(keys_.current_x);
+        linker.reads(keys_.current_y);
+        linker.reads(keys_.current_O);
+    } else {
+        linker.reads(keys_.target_O);
+        linker.reads(keys_.current_O);
+    }
+    linker.reads_optional(keys_.new_target);
+    linker.writes(keys_.pose_error);
+}
+
 void PoseErrorFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute PoseErrorFilter\n");
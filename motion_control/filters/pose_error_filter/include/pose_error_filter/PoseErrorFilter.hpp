@@ -45,6 +45,10 @@ class PoseErrorFilter : public Controller<PoseErrorFilterIOKeys, PoseErrorFilter
         return "PoseErrorFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// Execute the pose error filter.
     void execute(ControllersIO& io) override;
 
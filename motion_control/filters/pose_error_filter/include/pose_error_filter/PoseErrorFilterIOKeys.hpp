@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,15 +20,15 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a PoseErrorFilter.
 struct PoseErrorFilterIOKeys
 {
-    etl::string_view target_x;  ///< key for target X coordinate (linear mode)
-    etl::string_view target_y;  ///< key for target Y coordinate (linear mode)
-    etl::string_view target_O;  ///< key for target orientation (angular mode)
-    etl::string_view current_x; ///< key for current X coordinate (linear mode)
-    etl::string_view current_y; ///< key for current Y coordinate (linear mode)
-    etl::string_view current_O; ///< key for current orientation (linear mode for direction, angular
-                                ///< mode for error)
-    etl::string_view pose_error; ///< key for computed pose error output
-    etl::string_view new_target; ///< key for new target flag (read from TargetChangeDetector)
+    IOKey target_x;   ///< key for target X coordinate (linear mode)
+    IOKey target_y;   ///< key for target Y coordinate (linear mode)
+    IOKey target_O;   ///< key for target orientation (angular mode)
+    IOKey current_x;  ///< key for current X coordinate (linear mode)
+    IOKey current_y;  ///< key for current Y coordinate (linear mode)
+    IOKey current_O;  ///< key for current orientation (linear mode for direction, angular mode for
+                      ///< error)
+    IOKey pose_error; ///< key for computed pose error output
+    IOKey new_target; ///< key for new target flag (read from TargetChangeDetector)
 };
 
 } // namespace motion_control
@@ -19,6 +19,41 @@ namespace cogip {
 
 namespace motion_control {
 
+void PoseStraightFilter::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.current_pose_x);
+    linker.reads(keys_.current_pose_y);
+    linker.reads(keys_.current_pose_O);
+    linker.reads(keys_.target_pose_x);
+    linker.reads(keys_.target_pose_y);
+    linker.reads(keys_.target_pose_O);
+    linker.reads(keys_.current_linear_speed);
+    linker.reads(keys_.current_angular_speed);
+    linker.reads(keys_.target_linear_speed);
+    linker.reads(keys_.target_angular_speed);
+    linker.reads(keys_.motion_direction);
+    linker.reads_optional(keys_.bypass_final_orientation);
+    linker.reads_optional(keys_.new_target);
+    linker.reads_optional(keys_.final_speed);
+
+    linker.writes(keys_.linear_pose_error);
+    linker.writes(keys_.linear_target_speed);
+    linker.writes(keys_.linear_final_speed);
+    linker.writes(keys_.linear_speed_filter_flag);
+    linker.writes(keys_.angular_pose_error);
+    linker.writes(keys_.angular_target_speed);
+    linker.writes(keys_.angular_speed_filter_flag);
+    linker.writes(keys_.pose_reached);
+    linker.writes(keys_.current_state);
+    linker.writes(keys_.linear_recompute_profile);
+    linker.writes(keys_.angular_recompute_profile);
+    linker.writes(keys_.replan_profile);
+    linker.writes(keys_.linear_speed_pid_reset);
+    linker.writes(keys_.angular_speed_pid_reset);
+    linker.writes(keys_.linear_pose_pid_reset);
+    linker.writes(keys_.angular_pose_pid_reset);
+}
+
 void PoseStraightFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute PoseStraightFilter\n");
@@ -27,23 +62,14 @@ void PoseStraightFilter::execute(ControllersIO& io)
     float current_pose_x = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_pose_x)) {
         current_pose_x = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_pose_x.data(), current_pose_x);
     }
     float current_pose_y = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_pose_y)) {
         current_pose_y = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_pose_y.data(), current_pose_y);
     }
     float current_pose_O = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_pose_O)) {
         current_pose_O = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_pose_O.data(), current_pose_O);
     }
     cogip_defs::Pose current_pose(current_pose_x, current_pose_y, current_pose_O);
 
@@ -51,23 +77,14 @@ void PoseStraightFilter::execute(ControllersIO& io)
     float target_pose_x = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_pose_x)) {
         target_pose_x = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_pose_x.data(), target_pose_x);
     }
     float target_pose_y = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_pose_y)) {
         target_pose_y = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_pose_y.data(), target_pose_y);
     }
     float target_pose_O = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_pose_O)) {
         target_pose_O = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_pose_O.data(), target_pose_O);
     }
     cogip_defs::Pose target_pose(target_pose_x, target_pose_y, target_pose_O);
 
@@ -75,16 +92,10 @@ void PoseStraightFilter::execute(ControllersIO& io)
     float curr_lin = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_linear_speed)) {
         curr_lin = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_linear_speed.data(), curr_lin);
     }
     float curr_ang = 0.0f;
     if (auto opt = io.get_as<float>(keys_.current_angular_speed)) {
         curr_ang = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.current_angular_speed.data(), curr_ang);
     }
     const cogip_defs::Polar current_speed(curr_lin, curr_ang);
 
@@ -92,16 +103,10 @@ void PoseStraightFilter::execute(ControllersIO& io)
     float target_pose_lin = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_linear_speed)) {
         target_pose_lin = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_linear_speed.data(), target_pose_lin);
     }
     float target_pose_ang = 0.0f;
     if (auto opt = io.get_as<float>(keys_.target_angular_speed)) {
         target_pose_ang = *opt;
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value %f\n",
-                    keys_.target_angular_speed.data(), target_pose_ang);
     }
     cogip_defs::Polar target_speed(target_pose_lin, target_pose_ang);
 
@@ -109,9 +114,6 @@ void PoseStraightFilter::execute(ControllersIO& io)
     cogip::path::motion_direction motion_dir = cogip::path::motion_direction::bidirectional;
     if (auto opt = io.get_as<int>(keys_.motion_direction)) {
         motion_dir = static_cast<cogip::path::motion_direction>(*opt);
-    } else {
-        LOG_WARNING("WARNING: %s is not available, using default value bidirectional\n",
-                    keys_.motion_direction.data());
     }
 
     // Read bypass_final_orientation fresh from IO every tick so the state
@@ -141,7 +143,22 @@ void PoseStraightFilter::execute(ControllersIO& io)
         }
     }
 
+    // Linear speed at which to pass the target, 0 to stop on it
+    float final_speed = 0.0f;
+    if (!keys_.final_speed.empty()) {
+        if (auto opt = io.get_as<float>(keys_.final_speed)) {
+            final_speed = *opt;
+        }
+    }
+
+    // Recomputed profiles continue the running ones instead of restarting
+    bool replan_profile = false;
+
     if (new_target) {
+        const bool was_moving_to_position =
+            (current_state_ == PoseStraightFilterState::MOVE_TO_POSITION);
+        const bool previous_reverse = locked_reverse_;
+
         start_pose_ = current_pose;
         // Reset state machine to initial state on new target
         current_state_ = PoseStraightFilterState::ROTATE_TO_DIRECTION;
@@ -155,14 +172,8 @@ void PoseStraightFilter::execute(ControllersIO& io)
         // Invalidate linear profile - will be recomputed when entering MOVE_TO_POSITION
         linear_recompute_profile = true;
 
-        // Reset speed PIDs on new target
-        io.set(keys_.linear_speed_pid_reset, true);
-        io.set(keys_.angular_speed_pid_reset, true);
-        io.set(keys_.linear_pose_pid_reset, true);
-        io.set(keys_.angular_pose_pid_reset, true);
-
         // Lock reverse decision for this waypoint based on motion direction and initial angle
-        // This prevents instability when angle is close to 90°
+        // This prevents instability when angle is close to pi/2
         cogip_defs::Polar initial_err = target_pose - current_pose;
         switch (motion_dir) {
         case cogip::path::motion_direction::forward_only:
@@ -175,13 +186,39 @@ void PoseStraightFilter::execute(ControllersIO& io)
             break;
         case cogip::path::motion_direction::bidirectional:
         default:
-            // Optimal choice: reverse if |angle| > 90° (decided once, locked for this waypoint)
-            locked_reverse_ = (etl::absolute(initial_err.angle()) > 90.0f);
+            // Optimal choice: reverse if |angle| > pi/2 (decided once, locked for this waypoint)
+            locked_reverse_ = (etl::absolute(initial_err.angle()) > FAST_MATH_HALF_PI);
             break;
         }
         DEBUG("New waypoint: locked_reverse_=%d (initial_angle=%.2f, motion_dir=%d)\n",
               locked_reverse_, static_cast<double>(initial_err.angle()),
               static_cast<int>(motion_dir));
+
+        // Target moved while driving towards it, still ahead in the same travel direction:
+        // keep moving and splice new profiles at the current cycle (e.g. chasing a moving goal)
+        if (parameters_.continuous_replanning() && was_moving_to_position &&
+            (locked_reverse_ == previous_reverse)) {
+            cogip_defs::Polar heading_err = initial_err;
+            if (locked_reverse_) {
+                heading_err.reverse();
+            }
+            const float angular_intermediate_threshold =
+                parameters_.angular_intermediate_threshold();
+            replan_profile =
+                (etl::absolute(heading_err.angle()) <= angular_intermediate_threshold) &&
+                (etl::absolute(heading_err.distance()) > parameters_.linear_threshold());
+        }
+
+        if (replan_profile) {
+            current_state_ = PoseStraightFilterState::MOVE_TO_POSITION;
+            DEBUG("Replanning towards new target without stopping\n");
+        } else if (!flowing_through_) {
+            // Reset speed PIDs on new target, unless motion continues from previous waypoint
+            io.set(keys_.linear_speed_pid_reset, true);
+            io.set(keys_.angular_speed_pid_reset, true);
+            io.set(keys_.linear_pose_pid_reset, true);
+            io.set(keys_.angular_pose_pid_reset, true);
+        }
     }
 
     // Compute pose error as polar difference
@@ -214,6 +251,7 @@ void PoseStraightFilter::execute(ControllersIO& io)
         current_state_ = PoseStraightFilterState::ROTATE_TO_FINAL_ANGLE;
         angular_recompute_profile = true;
         linear_recompute_profile = true;
+        flowing_through_ = false;
         DEBUG("Early transition to ROTATE_TO_FINAL_ANGLE (already at position, linear_err=%.2f "
               "<= threshold %.2f)\n",
               static_cast<double>(absolute_linear_pose_error),
@@ -227,7 +265,7 @@ void PoseStraightFilter::execute(ControllersIO& io)
 
     if (current_state_ == PoseStraightFilterState::MOVE_TO_POSITION) {
         move_to_position(io, pos_err, current_pose, target_pose, linear_recompute_profile,
-                         angular_recompute_profile);
+                         angular_recompute_profile, current_speed.distance(), final_speed);
     }
 
     if (current_state_ == PoseStraightFilterState::ROTATE_TO_FINAL_ANGLE) {
@@ -235,7 +273,8 @@ void PoseStraightFilter::execute(ControllersIO& io)
                               angular_recompute_profile, bypass_final_orientation);
     }
 
-    if (current_state_ == PoseStraightFilterState::FINISHED) {
+    // Passed at junction speed: keep MOVE_TO_POSITION errors, next target takes over
+    if (current_state_ == PoseStraightFilterState::FINISHED && !flowing_through_) {
         finished(pos_err, current_pose, target_pose, bypass_final_orientation);
     }
 
@@ -245,6 +284,12 @@ void PoseStraightFilter::execute(ControllersIO& io)
     // Write linear target speed as absolute
     io.set(keys_.linear_target_speed, etl::absolute(target_speed.distance()));
 
+    // Write linear final speed: only the move to position can end at junction speed
+    if (!keys_.linear_final_speed.empty()) {
+        io.set(keys_.linear_final_speed,
+               (current_state_ == PoseStraightFilterState::MOVE_TO_POSITION) ? final_speed : 0.0f);
+    }
+
     // Write linear speed filter flag
     io.set(keys_.linear_speed_filter_flag, no_linear_limit_flag);
 
@@ -265,7 +310,9 @@ void PoseStraightFilter::execute(ControllersIO& io)
     // Write updated pose reached status
     target_pose_status_t reached;
     if (current_state_ == PoseStraightFilterState::FINISHED) {
-        reached = target_pose_status_t::reached;
+        // Intermediate status does not engage the brake of the engine
+        reached = flowing_through_ ? target_pose_status_t::intermediate_reached
+                                   : target_pose_status_t::reached;
     } else {
         reached = target_pose_status_t::moving;
     }
@@ -287,6 +334,9 @@ void PoseStraightFilter::execute(ControllersIO& io)
             DEBUG("Emitting angular_recompute_profile=true\n");
         }
     }
+    if (!keys_.replan_profile.empty()) {
+        io.set(keys_.replan_profile, replan_profile);
+    }
 }
 
 void PoseStraightFilter::rotate_to_direction(ControllersIO& io, cogip_defs::Polar& pos_err,
@@ -309,12 +359,12 @@ void PoseStraightFilter::rotate_to_direction(ControllersIO& io, cogip_defs::Pola
         if (angular_recompute_profile) {
             prev_angular_error_rotate_ = pos_err.angle();
         }
-        // Apply continuity enforcement (avoids 360° jumps at ±180° boundary for ProfileTracker)
+        // Apply continuity enforcement (avoids 2pi jumps at ±pi boundary for ProfileTracker)
         raw_angular_error =
-            enforce_angle_continuity_deg(pos_err.angle(), prev_angular_error_rotate_);
+            enforce_angle_continuity_rad(pos_err.angle(), prev_angular_error_rotate_);
     } else {
-        // Simple limit to [-180, 180] (for direct PID control)
-        raw_angular_error = limit_angle_deg(pos_err.angle());
+        // Simple limit to [-pi, pi] (for direct PID control)
+        raw_angular_error = limit_angle_rad(pos_err.angle());
     }
     pos_err.set_angle(raw_angular_error);
 
@@ -327,11 +377,15 @@ void PoseStraightFilter::rotate_to_direction(ControllersIO& io, cogip_defs::Pola
         pos_err.set_distance(-pos_error_longitudinal);
     } else {
         current_state_ = PoseStraightFilterState::MOVE_TO_POSITION;
-        // Reset speed PIDs on transition to MOVE_TO_POSITION
-        io.set(keys_.linear_speed_pid_reset, true);
-        io.set(keys_.angular_speed_pid_reset, true);
-        io.set(keys_.linear_pose_pid_reset, true);
-        io.set(keys_.angular_pose_pid_reset, true);
+        // Reset speed PIDs on transition to MOVE_TO_POSITION, unless motion continues from
+        // previous waypoint
+        if (!flowing_through_) {
+            io.set(keys_.linear_speed_pid_reset, true);
+            io.set(keys_.angular_speed_pid_reset, true);
+            io.set(keys_.linear_pose_pid_reset, true);
+            io.set(keys_.angular_pose_pid_reset, true);
+        }
+        flowing_through_ = false;
         // Transition to MOVE_TO_POSITION -> recompute profiles
         linear_recompute_profile = true;
         angular_recompute_profile = true;
@@ -345,7 +399,8 @@ void PoseStraightFilter::move_to_position(ControllersIO& io, cogip_defs::Polar&
                                           const cogip_defs::Pose& current_pose,
                                           cogip_defs::Pose& target_pose,
                                           bool& linear_recompute_profile,
-                                          bool& angular_recompute_profile)
+                                          bool& angular_recompute_profile,
+                                          float current_linear_speed, float final_speed)
 {
     if (previous_logged_state_ != PoseStraightFilterState::MOVE_TO_POSITION) {
         LOG_INFO("PoseStraightFilter: MOVE_TO_POSITION\n");
@@ -359,8 +414,8 @@ void PoseStraightFilter::move_to_position(ControllersIO& io, cogip_defs::Polar&
     float raw_distance = raw_pos_err.distance();
     float raw_angle = raw_pos_err.angle();
 
-    // Target is in front if |angle| < 90°, behind otherwise
-    bool target_is_in_front = (etl::absolute(raw_angle) < 90.0f);
+    // Target is in front if |angle| < pi/2, behind otherwise
+    bool target_is_in_front = (etl::absolute(raw_angle) < FAST_MATH_HALF_PI);
 
     // Set linear error sign: positive if going forward, negative if going backward
     float linear_error = target_is_in_front ? raw_distance : -raw_distance;
@@ -371,10 +426,26 @@ void PoseStraightFilter::move_to_position(ControllersIO& io, cogip_defs::Polar&
     if (target_is_in_front) {
         heading_error = raw_angle;
     } else {
-        heading_error = limit_angle_deg(raw_angle + 180.0f);
+        heading_error = limit_angle_rad(raw_angle + FAST_MATH_PI);
     }
     pos_err.set_angle(heading_error);
 
+    // Waypoint passed at junction speed: finish as soon as it is reached within the next period,
+    // or overshot, without stopping nor resetting anything. Next target continues the motion.
+    if (final_speed > 0.0f) {
+        const float start_dx = target_pose.x() - start_pose_.x();
+        const float start_dy = target_pose.y() - start_pose_.y();
+        const float target_dx = target_pose.x() - current_pose.x();
+        const float target_dy = target_pose.y() - current_pose.y();
+        const bool passed = (start_dx * target_dx + start_dy * target_dy) <= 0.0f;
+        if (passed || (raw_distance <= linear_threshold + etl::absolute(current_linear_speed))) {
+            current_state_ = PoseStraightFilterState::FINISHED;
+            flowing_through_ = true;
+            DEBUG("Waypoint passed at junction speed %.2f\n", static_cast<double>(final_speed));
+            return;
+        }
+    }
+
     // Transition when close enough to target
     if (raw_distance <= linear_threshold) {
         current_state_ = PoseStraightFilterState::ROTATE_TO_FINAL_ANGLE;
@@ -409,13 +480,13 @@ void PoseStraightFilter::rotate_to_final_angle(ControllersIO& io, cogip_defs::Po
     // Compute final angle error (to target orientation, not travel direction)
     float final_angle_error;
     if (!bypass_final_orientation) {
-        float raw_error = limit_angle_deg(target_pose.O() - current_pose.O());
+        float raw_error = limit_angle_rad(target_pose.O() - current_pose.O());
         if (parameters_.use_angle_continuity()) {
-            // Use continuity enforcement to avoid 360° jumps (for ProfileTracker)
+            // Use continuity enforcement to avoid 2pi jumps (for ProfileTracker)
             if (angular_recompute_profile) {
                 prev_angular_error_final_ = raw_error;
             }
-            final_angle_error = enforce_angle_continuity_deg(raw_error, prev_angular_error_final_);
+            final_angle_error = enforce_angle_continuity_rad(raw_error, prev_angular_error_final_);
         } else {
             // Simple limit (for direct PID control)
             final_angle_error = raw_error;
@@ -461,7 +532,7 @@ void PoseStraightFilter::finished(cogip_defs::Polar& pos_err, const cogip_defs::
     // Maintain final orientation
     float final_angle_error;
     if (!bypass_final_orientation) {
-        final_angle_error = limit_angle_deg(target_pose.O() - current_pose.O());
+        final_angle_error = limit_angle_rad(target_pose.O() - current_pose.O());
     } else {
         final_angle_error = 0.0f;
     }
@@ -474,7 +545,7 @@ void PoseStraightFilter::finished(cogip_defs::Polar& pos_err, const cogip_defs::
               "%.1f,%.1f,%.1f -> tgt: "
               "%.1f,%.1f,%.1f)\n",
               static_cast<double>(final_err.distance()), static_cast<double>(final_err.angle()),
-              static_cast<double>(limit_angle_deg(target_pose.O() - current_pose.O())),
+              static_cast<double>(limit_angle_rad(target_pose.O() - current_pose.O())),
               static_cast<double>(current_pose.x()), static_cast<double>(current_pose.y()),
               static_cast<double>(current_pose.O()), static_cast<double>(target_pose.x()),
               static_cast<double>(target_pose.y()), static_cast<double>(target_pose.O()));
@@ -66,6 +66,10 @@ class PoseStraightFilter : public Controller<PoseStraightFilterIOKeys, PoseStrai
         return "PoseStraightFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Evaluate state machine and compute errors, filtered speeds, and
     /// reached status.
     /// @param io Shared ControllersIO containing inputs and receiving outputs.
@@ -94,6 +98,7 @@ class PoseStraightFilter : public Controller<PoseStraightFilterIOKeys, PoseStrai
         prev_angular_error_rotate_ = 0.0f;
         prev_angular_error_final_ = 0.0f;
         locked_reverse_ = false;
+        flowing_through_ = false;
     }
 
     /// @brief Reset internal state machine to initial rotation state.
@@ -108,6 +113,12 @@ class PoseStraightFilter : public Controller<PoseStraightFilterIOKeys, PoseStrai
         current_state_ = PoseStraightFilterState::FINISHED;
     }
 
+    /// @brief Get current state of the state machine.
+    PoseStraightFilterState current_state() const
+    {
+        return current_state_;
+    }
+
   private:
     PoseStraightFilterState current_state_;
     PoseStraightFilterState previous_logged_state_ = PoseStraightFilterState::FINISHED;
@@ -116,6 +127,7 @@ class PoseStraightFilter : public Controller<PoseStraightFilterIOKeys, PoseStrai
     float prev_angular_error_rotate_; ///< Previous angular error in ROTATE_TO_DIRECTION
     float prev_angular_error_final_;  ///< Previous angular error in ROTATE_TO_FINAL_ANGLE
     bool locked_reverse_ = false;     ///< Locked reverse decision for current waypoint
+    bool flowing_through_ = false;    ///< Previous waypoint passed at junction speed: keep PIDs
 
     /// @brief Handle ROTATE_TO_DIRECTION state
     void rotate_to_direction(ControllersIO& io, cogip_defs::Polar& pos_err,
@@ -126,7 +138,8 @@ class PoseStraightFilter : public Controller<PoseStraightFilterIOKeys, PoseStrai
     /// @brief Handle MOVE_TO_POSITION state
     void move_to_position(ControllersIO& io, cogip_defs::Polar& pos_err,
                           const cogip_defs::Pose& current_pose, cogip_defs::Pose& target_pose,
-                          bool& linear_recompute_profile, bool& angular_recompute_profile);
+                          bool& linear_recompute_profile, bool& angular_recompute_profile,
+                          float current_linear_speed, float final_speed);
 
     /// @brief Handle ROTATE_TO_FINAL_ANGLE state
     void rotate_to_final_angle(ControllersIO& io, cogip_defs::Polar& pos_err,
@@ -141,18 +154,16 @@ class PoseStraightFilter : public Controller<PoseStraightFilterIOKeys, PoseStrai
     /// @brief Calculate longitudinal position error projected onto robot's axis
     /// @param current_x Current X position
     /// @param current_y Current Y position
-    /// @param current_angle_deg Current orientation in degrees
+    /// @param current_angle Current orientation in radians
     /// @param target_x Target X position
     /// @param target_y Target Y position
     /// @return Longitudinal error (positive = robot is ahead of target)
-    inline float compute_longitudinal_error(float current_x, float current_y,
-                                            float current_angle_deg, float target_x,
-                                            float target_y) const
+    inline float compute_longitudinal_error(float current_x, float current_y, float current_angle,
+                                            float target_x, float target_y) const
     {
         float dx = current_x - target_x;
         float dy = current_y - target_y;
-        float current_angle_rad = DEG2RAD(current_angle_deg);
-        return dx * std::cos(current_angle_rad) + dy * std::sin(current_angle_rad);
+        return dx * fast_cosf(current_angle) + dy * fast_sinf(current_angle);
     }
 };
 
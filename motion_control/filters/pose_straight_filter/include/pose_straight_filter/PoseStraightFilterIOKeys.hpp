@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 namespace motion_control {
@@ -21,47 +21,50 @@ namespace motion_control {
 struct PoseStraightFilterIOKeys
 {
     // Input keys
-    etl::string_view current_pose_x;           ///< key for first coordinate of current pose
-    etl::string_view current_pose_y;           ///< key for second coordinate of current pose
-    etl::string_view current_pose_O;           ///< key for orientation of current pose
-    etl::string_view target_pose_x;            ///< key for first coordinate of target pose
-    etl::string_view target_pose_y;            ///< key for second coordinate of target pose
-    etl::string_view target_pose_O;            ///< key for orientation of target pose
-    etl::string_view current_linear_speed;     ///< key for linear component of current speed
-    etl::string_view current_angular_speed;    ///< key for angular component of current speed
-    etl::string_view target_linear_speed;      ///< key for linear component of target speed
-    etl::string_view target_angular_speed;     ///< key for angular component of target speed
-    etl::string_view motion_direction;         ///< key for motion direction mode
-    etl::string_view bypass_final_orientation; ///< key for bypass final orientation flag (from
-                                               ///< PathManagerFilter)
-    etl::string_view new_target;               ///< key emitted by TargetChangeDetector when any
-                                               ///< pose-order component changes (x/y/O,
-                                               ///< motion_direction, bypass_final_orientation…).
-                                               ///< Consumed here to reset the state machine.
+    IOKey current_pose_x;           ///< key for first coordinate of current pose
+    IOKey current_pose_y;           ///< key for second coordinate of current pose
+    IOKey current_pose_O;           ///< key for orientation of current pose
+    IOKey target_pose_x;            ///< key for first coordinate of target pose
+    IOKey target_pose_y;            ///< key for second coordinate of target pose
+    IOKey target_pose_O;            ///< key for orientation of target pose
+    IOKey current_linear_speed;     ///< key for linear component of current speed
+    IOKey current_angular_speed;    ///< key for angular component of current speed
+    IOKey target_linear_speed;      ///< key for linear component of target speed
+    IOKey target_angular_speed;     ///< key for angular component of target speed
+    IOKey motion_direction;         ///< key for motion direction mode
+    IOKey bypass_final_orientation; ///< key for bypass final orientation flag (from
+                                    ///< PathManagerFilter)
+    IOKey new_target;               ///< key emitted by TargetChangeDetector when any pose-order
+                                    ///< component changes (x/y/O, motion_direction,
+                                    ///< bypass_final_orientation…). Consumed here to reset the
+                                    ///< state machine.
+    IOKey final_speed;              ///< key for linear speed at which to pass the target (from
+                                    ///< PathManagerFilter, optional, 0 to stop on it)
 
     // Output keys
-    etl::string_view linear_pose_error;         ///< key for linear distance to target
-    etl::string_view linear_current_speed;      ///< key for linear component of
-                                                ///< current speed output
-    etl::string_view linear_target_speed;       ///< key for filtered linear speed output
-    etl::string_view linear_speed_filter_flag;  ///< key for linear speed filter indicator
-    etl::string_view angular_pose_error;        ///< key for angular difference to target
-    etl::string_view angular_current_speed;     ///< key for angular component of
-                                                ///< current speed output
-    etl::string_view angular_target_speed;      ///< key for filtered angular speed output
-    etl::string_view angular_speed_filter_flag; ///< key for angular speed filter indicator
-    etl::string_view pose_reached;              ///< key for updated pose reached status
-    etl::string_view current_state;             ///< key for current state machine state
-    etl::string_view linear_recompute_profile;  ///< key to signal linear profile recomputation
-    etl::string_view
-        linear_invalidate_profile; ///< key to signal linear profile invalidation (on new target)
-    etl::string_view angular_recompute_profile;  ///< key to signal angular profile recomputation
-    etl::string_view angular_invalidate_profile; ///< key to signal angular profile invalidation (on
-                                                 ///< MOVE_TO_POSITION entry)
-    etl::string_view linear_speed_pid_reset;     ///< key to trigger linear speed PID reset
-    etl::string_view angular_speed_pid_reset;    ///< key to trigger angular speed PID reset
-    etl::string_view linear_pose_pid_reset;      ///< key to trigger linear pose PID reset
-    etl::string_view angular_pose_pid_reset;     ///< key to trigger angular pose PID reset
+    IOKey linear_pose_error;          ///< key for linear distance to target
+    IOKey linear_current_speed;       ///< key for linear component of current speed output
+    IOKey linear_target_speed;        ///< key for filtered linear speed output
+    IOKey linear_final_speed;         ///< key for linear speed at the end of the linear profile
+                                      ///< output: final_speed in MOVE_TO_POSITION, 0 otherwise
+    IOKey linear_speed_filter_flag;   ///< key for linear speed filter indicator
+    IOKey angular_pose_error;         ///< key for angular difference to target
+    IOKey angular_current_speed;      ///< key for angular component of current speed output
+    IOKey angular_target_speed;       ///< key for filtered angular speed output
+    IOKey angular_speed_filter_flag;  ///< key for angular speed filter indicator
+    IOKey pose_reached;               ///< key for updated pose reached status
+    IOKey current_state;              ///< key for current state machine state
+    IOKey linear_recompute_profile;   ///< key to signal linear profile recomputation
+    IOKey linear_invalidate_profile;  ///< key to signal linear profile invalidation (on new target)
+    IOKey angular_recompute_profile;  ///< key to signal angular profile recomputation
+    IOKey angular_invalidate_profile; ///< key to signal angular profile invalidation (on
+                                      ///< MOVE_TO_POSITION entry)
+    IOKey replan_profile;             ///< key to signal that recomputed profiles continue the
+                                      ///< running ones (new target while moving, optional)
+    IOKey linear_speed_pid_reset;     ///< key to trigger linear speed PID reset
+    IOKey angular_speed_pid_reset;    ///< key to trigger angular speed PID reset
+    IOKey linear_pose_pid_reset;      ///< key to trigger linear pose PID reset
+    IOKey angular_pose_pid_reset;     ///< key to trigger angular pose PID reset
 };
 
 } // namespace motion_control
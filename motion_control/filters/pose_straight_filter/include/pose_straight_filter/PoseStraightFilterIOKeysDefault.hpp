@@ -34,11 +34,13 @@ static const PoseStraightFilterIOKeys pose_straight_filter_io_keys_default = {
     .motion_direction = "motion_direction",
     .bypass_final_orientation = "bypass_final_orientation",
     .new_target = "new_target",
+    .final_speed = "final_speed",
 
     // Output keys
     .linear_pose_error = "linear_pose_error",
     .linear_current_speed = "linear_current_speed",
     .linear_target_speed = "linear_target_speed",
+    .linear_final_speed = "linear_final_speed",
     .linear_speed_filter_flag = "linear_speed_filter_flag",
     .angular_pose_error = "angular_pose_error",
     .angular_current_speed = "angular_current_speed",
@@ -50,6 +52,7 @@ static const PoseStraightFilterIOKeys pose_straight_filter_io_keys_default = {
     .linear_invalidate_profile = "linear_invalidate_profile",
     .angular_recompute_profile = "angular_recompute_profile",
     .angular_invalidate_profile = "angular_invalidate_profile",
+    .replan_profile = "replan_profile",
     .linear_speed_pid_reset = "linear_speed_pid_reset",
     .angular_speed_pid_reset = "angular_speed_pid_reset",
     .linear_pose_pid_reset = "linear_pose_pid_reset",
@@ -28,13 +28,15 @@ class PoseStraightFilterParameters
         float angular_deceleration = 0.0,           ///< [in]  see angular_deceleration_threshold_
         float linear_deceleration = 0.0,            ///< [in]  see linear_deceleration_threshold_
         bool bypass_final_orientation = false,      ///< [in] bypass final orientation
-        bool use_angle_continuity = false           ///< [in] use angle continuity enforcement
+        bool use_angle_continuity = false,          ///< [in] use angle continuity enforcement
+        bool continuous_replanning = false          ///< [in] see continuous_replanning_
         )
         : angular_threshold_(angular_threshold), linear_threshold_(linear_threshold),
           angular_intermediate_threshold_(angular_intermediate_threshold),
           angular_deceleration_(angular_deceleration), linear_deceleration_(linear_deceleration),
           bypass_final_orientation_(bypass_final_orientation),
-          use_angle_continuity_(use_angle_continuity){};
+          use_angle_continuity_(use_angle_continuity),
+          continuous_replanning_(continuous_replanning){};
 
     /// Get angular threshold
     /// return angular threshold
@@ -144,6 +146,24 @@ class PoseStraightFilterParameters
         use_angle_continuity_ = false;
     };
 
+    /// Return continuous replanning mode
+    bool continuous_replanning() const
+    {
+        return continuous_replanning_;
+    };
+
+    /// Enable continuous replanning
+    void continuous_replanning_on()
+    {
+        continuous_replanning_ = true;
+    };
+
+    /// Disable continuous replanning
+    void continuous_replanning_off()
+    {
+        continuous_replanning_ = false;
+    };
+
   private:
     /// the robot turns on itself until the angle error is lower than this
     /// threshold
@@ -168,6 +188,11 @@ class PoseStraightFilterParameters
 
     /// use angle continuity enforcement (for ProfileTracker)
     bool use_angle_continuity_;
+
+    /// a new target received while moving to position, roughly in the travel
+    /// direction, is followed without stopping: profiles are spliced onto the
+    /// running ones and PIDs are not reset (for ProfileTracker)
+    bool continuous_replanning_;
 };
 
 } // namespace motion_control
@@ -56,6 +56,16 @@ void SpeedFilter::limit_speed_order(float* speed_order, float raw_target, float
     }
 }
 
+void SpeedFilter::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.speed_order);
+    linker.reads_optional(keys_.current_speed);
+    linker.reads_optional(keys_.target_speed);
+    linker.reads_optional(keys_.bypass_filter);
+    linker.writes(keys_.speed_order);
+    linker.writes(keys_.speed_error);
+}
+
 void SpeedFilter::execute(ControllersIO& io)
 {
     // Read commanded speed before filtering (default to zero if missing)
@@ -50,6 +50,20 @@ class SpeedFilter : public Controller<SpeedFilterIOKeys, SpeedFilterParameters>
         previous_speed_order_ = 0.0f;
     }
 
+    /// @brief Continue from the speed order of the previous chain, so that
+    /// acceleration is limited from the speed actually commanded.
+    /// @param io Shared ControllersIO still holding the previous chain outputs.
+    void handoff(const ControllersIO& io) override
+    {
+        if (auto opt = io.get_as<float>(keys_.speed_order)) {
+            previous_speed_order_ = *opt;
+        }
+    }
+
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Apply acceleration and speed limits, and compute speed error.
     /// @param io Shared ControllersIO containing inputs and receiving outputs.
     void execute(ControllersIO& io) override;
@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -21,11 +21,11 @@ namespace motion_control {
 ///        The application must supply the correct literals at runtime.
 struct SpeedFilterIOKeys
 {
-    etl::string_view speed_order;   ///< key for commanded speed before filtering
-    etl::string_view current_speed; ///< key for measured current speed
-    etl::string_view target_speed;  ///< key for raw speed setpoint
-    etl::string_view speed_error;   ///< key for computed speed error (filtered)
-    etl::string_view bypass_filter; ///< key for bypass flag (optional, skip accel limiting if true)
+    IOKey speed_order;   ///< key for commanded speed before filtering
+    IOKey current_speed; ///< key for measured current speed
+    IOKey target_speed;  ///< key for raw speed setpoint
+    IOKey speed_error;   ///< key for computed speed error (filtered)
+    IOKey bypass_filter; ///< key for bypass flag (optional, skip accel limiting if true)
 };
 } // namespace motion_control
 
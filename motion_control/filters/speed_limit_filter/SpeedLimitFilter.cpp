@@ -26,6 +26,13 @@ namespace cogip {
 
 namespace motion_control {
 
+void SpeedLimitFilter::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.target_speed);
+    linker.writes(keys_.target_speed);
+    linker.writes(keys_.output_speed);
+}
+
 void SpeedLimitFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute SpeedLimitFilter\n");
@@ -35,7 +42,6 @@ void SpeedLimitFilter::execute(ControllersIO& io)
     if (auto opt = io.get_as<float>(keys_.target_speed)) {
         target_speed = *opt;
     } else {
-        LOG_WARNING("SpeedLimitFilter: target_speed not available\n");
         return;
     }
 
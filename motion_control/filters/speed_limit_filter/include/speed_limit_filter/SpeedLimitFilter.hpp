@@ -49,6 +49,10 @@ class SpeedLimitFilter : public Controller<SpeedLimitFilterIOKeys, SpeedLimitFil
         return "SpeedLimitFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// Execute the speed limit filter.
     void execute(ControllersIO& io) override;
 };
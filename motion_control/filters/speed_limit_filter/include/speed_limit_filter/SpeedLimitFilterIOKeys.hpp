@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,9 +20,8 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a SpeedLimitFilter.
 struct SpeedLimitFilterIOKeys
 {
-    etl::string_view target_speed; ///< key for target speed (will be modified)
-    etl::string_view
-        output_speed; ///< key for output speed (optional, if set writes final value here)
+    IOKey target_speed; ///< key for target speed (will be modified)
+    IOKey output_speed; ///< key for output speed (optional, if set writes final value here)
 };
 
 } // namespace motion_control
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    speed_observer_filter
+/// @{
+/// @file
+/// @brief      Speed observer filter implementation
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+// System includes
+#include <cmath>
+
+// Project includes
+#include "speed_observer_filter/SpeedObserverFilter.hpp"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+void SpeedObserverFilter::link(ChainLinker& linker) const
+{
+    linker.reads(keys_.current_speed);
+    linker.writes(keys_.observed_speed);
+}
+
+void SpeedObserverFilter::update_gains(float bandwidth_hz)
+{
+    bandwidth_hz_ = bandwidth_hz;
+
+    // Critically damped alpha-beta loop, both poles at theta
+    const float theta = std::exp(-2.0f * static_cast<float>(M_PI) * bandwidth_hz *
+                                 parameters_.period_s());
+    alpha_ = 1.0f - theta * theta;
+    beta_ = (1.0f - theta) * (1.0f - theta);
+
+    DEBUG("SpeedObserverFilter[%s]: bandwidth=%.2fHz alpha=%.3f beta=%.3f\n",
+          keys_.observed_speed.data(), static_cast<double>(bandwidth_hz),
+          static_cast<double>(alpha_), static_cast<double>(beta_));
+}
+
+void SpeedObserverFilter::execute(ControllersIO& io)
+{
+    float current_speed = 0.0f;
+    if (auto opt = io.get_as<float>(keys_.current_speed)) {
+        current_speed = *opt;
+    }
+
+    // Zero bandwidth: no observer
+    const float bandwidth_hz = parameters_.bandwidth_hz();
+    if (bandwidth_hz <= 0.0f) {
+        initialized_ = false;
+        io.set(keys_.observed_speed, current_speed);
+        return;
+    }
+
+    // Gains only depend on the bandwidth parameter
+    if (bandwidth_hz != bandwidth_hz_) {
+        update_gains(bandwidth_hz);
+    }
+
+    if (!initialized_) {
+        speed_ = current_speed;
+        residual_ = 0.0f;
+        initialized_ = true;
+    } else {
+        // Positions are relative to the observed one, so that they never grow:
+        // the residual is the measured position delta minus the predicted one,
+        // plus what was left uncorrected on the previous period
+        const float residual = residual_ + current_speed - speed_;
+        speed_ += beta_ * residual;
+        residual_ = (1.0f - alpha_) * residual;
+    }
+
+    DEBUG("SpeedObserverFilter[%s]: measured=%.3f observed=%.3f\n", keys_.observed_speed.data(),
+          static_cast<double>(current_speed), static_cast<double>(speed_));
+
+    io.set(keys_.observed_speed, speed_);
+}
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,112 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    speed_observer_filter Speed observer filter
+/// @{
+/// @file
+/// @brief      Observe speed from quantized encoder pose deltas
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+// Project includes
+#include "SpeedObserverFilterIOKeys.hpp"
+#include "SpeedObserverFilterParameters.hpp"
+#include "motion_control_common/Controller.hpp"
+#include "motion_control_common/ControllersIO.hpp"
+
+namespace cogip {
+namespace motion_control {
+
+/// @brief Estimate speed with an alpha-beta tracking loop.
+/// @details
+///   The measured speed is the pose delta of the period, quantized to encoder
+///   ticks: at crawl speed it jumps between a few discrete values. The
+///   observer tracks the position accumulated from these deltas with a
+///   position and speed state:
+///
+///       predicted = position + speed
+///       residual  = measured position - predicted
+///       position  = predicted + alpha * residual
+///       speed     = speed + beta * residual
+///
+///   Gains are those of a critically damped loop of the given bandwidth:
+///   alpha = 1 - theta², beta = (1 - theta)², theta = exp(-2.pi.bandwidth.period).
+///   Constant speeds are tracked without steady state error, and the
+///   quantization noise is filtered above the bandwidth.
+///
+///   Output is in the same unit as the measured speed (per period).
+class SpeedObserverFilter
+    : public Controller<SpeedObserverFilterIOKeys, SpeedObserverFilterParameters>
+{
+  public:
+    /// @brief Constructor.
+    /// @param keys       Reference to a POD containing all input and output key names.
+    /// @param parameters Reference to observer parameters.
+    /// @param name       Optional instance name for identification.
+    explicit SpeedObserverFilter(const SpeedObserverFilterIOKeys& keys,
+                                 const SpeedObserverFilterParameters& parameters,
+                                 etl::string_view name = "")
+        : Controller<SpeedObserverFilterIOKeys, SpeedObserverFilterParameters>(keys, parameters,
+                                                                               name),
+          bandwidth_hz_(-1.0f), alpha_(1.0f), beta_(0.0f), speed_(0.0f), residual_(0.0f),
+          initialized_(false)
+    {
+    }
+
+    /// @brief Get the type name of this controller
+    const char* type_name() const override
+    {
+        return "SpeedObserverFilter";
+    }
+
+    /// @brief Reset internal state for new target
+    /// The observer restarts from the next measured speed.
+    void reset() override
+    {
+        initialized_ = false;
+    }
+
+    /// @brief Restart from the last measured speed when the chain is switched in.
+    /// The observer state is the one left when this chain last ran: it must not
+    /// be fed back to the speed loops.
+    /// @param io Shared ControllersIO still holding the previous chain values.
+    void handoff(const ControllersIO& io) override
+    {
+        if (auto opt = io.get_as<float>(keys_.current_speed)) {
+            speed_ = *opt;
+            residual_ = 0.0f;
+            initialized_ = true;
+        } else {
+            initialized_ = false;
+        }
+    }
+
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
+    /// @brief Update the observer with the measured speed and write the observed speed.
+    /// @param io Shared ControllersIO containing inputs and receiving outputs.
+    void execute(ControllersIO& io) override;
+
+  private:
+    /// @brief Compute observer gains for a new bandwidth.
+    /// @param bandwidth_hz Observer bandwidth (Hz)
+    void update_gains(float bandwidth_hz);
+
+    float bandwidth_hz_; ///< Bandwidth of the current gains (Hz)
+    float alpha_;        ///< Position gain
+    float beta_;         ///< Speed gain
+    float speed_;        ///< Observed speed (per period)
+    float residual_;     ///< Measured minus observed position, after correction
+    bool initialized_;   ///< Observer state follows the measurements
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
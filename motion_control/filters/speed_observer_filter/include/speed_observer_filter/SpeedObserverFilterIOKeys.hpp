@@ -0,0 +1,32 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    speed_observer_filter Speed observer filter IO keys
+/// @{
+/// @file
+/// @brief      Speed observer filter IO keys
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include "motion_control_common/IOKey.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Bundle of ControllersIO key names for a SpeedObserverFilter.
+///        The application must supply the correct literals at runtime.
+struct SpeedObserverFilterIOKeys
+{
+    IOKey current_speed;  ///< key for measured speed, pose delta of the period
+    IOKey observed_speed; ///< key for observed speed
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,36 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup speed_observer_filter Speed observer filter IO keys default values
+/// @{
+/// @file
+/// @brief Default values for Speed observer filter IO keys.
+/// @author Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include "SpeedObserverFilterIOKeys.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Default IO key names for linear SpeedObserverFilter.
+static const SpeedObserverFilterIOKeys linear_speed_observer_filter_io_keys_default = {
+    .current_speed = "linear_current_speed",
+    .observed_speed = "linear_observed_speed",
+};
+
+/// @brief Default IO key names for angular SpeedObserverFilter.
+static const SpeedObserverFilterIOKeys angular_speed_observer_filter_io_keys_default = {
+    .current_speed = "angular_current_speed",
+    .observed_speed = "angular_observed_speed",
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,59 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    speed_observer_filter Speed observer filter parameters
+/// @{
+/// @file
+/// @brief      Speed observer bandwidth
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include "parameter/ParameterInterface.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Parameters for SpeedObserverFilter.
+class SpeedObserverFilterParameters
+{
+  public:
+    /// @brief Constructor.
+    /// @param bandwidth_hz Observer bandwidth (Hz), 0 to forward the measured speed
+    /// @param period_ms    Period of the filter execution (ms)
+    SpeedObserverFilterParameters(
+        const cogip::parameter::ParameterInterface<float>& bandwidth_hz, float period_ms)
+        : bandwidth_hz_(bandwidth_hz), period_s_(period_ms / 1000.0f)
+    {
+    }
+
+    /// @brief Get observer bandwidth.
+    /// @return Bandwidth (Hz), 0 if the observer is bypassed.
+    float bandwidth_hz() const
+    {
+        return bandwidth_hz_.get();
+    }
+
+    /// @brief Get period of the filter execution.
+    /// @return Period (s).
+    float period_s() const
+    {
+        return period_s_;
+    }
+
+  private:
+    /// Observer bandwidth (Hz)
+    const cogip::parameter::ParameterInterface<float>& bandwidth_hz_;
+
+    /// Period of the filter execution (s)
+    float period_s_;
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -22,6 +22,13 @@ namespace cogip {
 
 namespace motion_control {
 
+void TuningPoseReachedFilter::link(ChainLinker& linker) const
+{
+    linker.reads_optional(keys_.profile_complete);
+    linker.reads_optional(keys_.pose_error);
+    linker.writes(keys_.pose_reached);
+}
+
 void TuningPoseReachedFilter::execute(ControllersIO& io)
 {
     DEBUG("Execute TuningPoseReachedFilter\n");
@@ -40,6 +40,10 @@ class TuningPoseReachedFilter : public BaseController
         return "TuningPoseReachedFilter";
     }
 
+    /// @brief Declare the IO keys read and written by the controller.
+    /// @param linker Chain linker
+    void link(ChainLinker& linker) const override;
+
     /// @brief Check profile_complete and set pose_reached accordingly.
     /// @param io Shared ControllersIO containing inputs and receiving outputs.
     void execute(ControllersIO& io) override;
@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <etl/string_view.h>
+#include "motion_control_common/IOKey.hpp"
 
 namespace cogip {
 
@@ -20,11 +20,10 @@ namespace motion_control {
 /// @brief Bundle of ControllersIO key names for a TuningPoseReachedFilter.
 struct TuningPoseReachedFilterIOKeys
 {
-    etl::string_view
-        profile_complete; ///< key for profile complete input (from ProfileTrackerController)
-    etl::string_view pose_reached; ///< key for pose reached status output
-    etl::string_view pose_error;   ///< key for pose error input (optional, for threshold mode)
-    float pose_threshold = 0.0f;   ///< threshold for pose_reached (if pose_error is configured)
+    IOKey profile_complete;      ///< key for profile complete input (from ProfileTrackerController)
+    IOKey pose_reached;          ///< key for pose reached status output
+    IOKey pose_error;            ///< key for pose error input (optional, for threshold mode)
+    float pose_threshold = 0.0f; ///< threshold for pose_reached (if pose_error is configured)
 };
 
 } // namespace motion_control
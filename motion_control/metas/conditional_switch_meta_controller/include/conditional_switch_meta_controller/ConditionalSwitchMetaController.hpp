@@ -13,8 +13,8 @@
 
 #include "motion_control_common/BaseController.hpp"
 #include "motion_control_common/ControllersIO.hpp"
+#include "motion_control_common/IOKey.hpp"
 #include <etl/string.h>
-#include <etl/string_view.h>
 
 namespace cogip {
 
@@ -42,8 +42,8 @@ class ConditionalSwitchMetaController : public BaseController
     /// @param controller_when_false Controller to execute when condition is false
     ConditionalSwitchMetaController(const char* condition_key, BaseController* controller_when_true,
                                     BaseController* controller_when_false)
-        : condition_key_(condition_key), controller_when_true_(controller_when_true),
-          controller_when_false_(controller_when_false)
+        : condition_key_(condition_key), condition_io_key_(condition_key),
+          controller_when_true_(controller_when_true), controller_when_false_(controller_when_false)
     {
     }
 
@@ -52,23 +52,47 @@ class ConditionalSwitchMetaController : public BaseController
     {
         // Read condition from IO (default to false if key not found)
         bool condition = false;
-        // Create string_view from const char* at runtime
-        // Use explicit length calculation since ETL might not have strlen constructor
-        size_t len = 0;
-        while (condition_key_[len] != '\0') {
-            ++len;
-        }
-        etl::string_view key_view(condition_key_, len);
-        if (auto opt = io.get_as<bool>(key_view)) {
+        if (auto opt = io.get_as<bool>(condition_io_key_)) {
             condition = *opt;
         }
 
         // Execute the selected controller
         if (condition) {
-            controller_when_true_->execute(io);
+            controller_when_true_->profiled_execute(io);
         } else {
-            controller_when_false_->execute(io);
+            controller_when_false_->profiled_execute(io);
+        }
+    }
+
+    /// Hand off the state of the previous chain to both branches, as the
+    /// condition may change on any cycle
+    void handoff(const ControllersIO& io) override
+    {
+        if (controller_when_true_) {
+            controller_when_true_->handoff(io);
+        }
+        if (controller_when_false_) {
+            controller_when_false_->handoff(io);
+        }
+    }
+
+    /// Link both branches from the same upstream keys, then keep the keys
+    /// written by either branch as available downstream
+    void link(ChainLinker& linker) const override
+    {
+        linker.reads_optional(condition_io_key_);
+
+        const ParamMask upstream = linker.available();
+        if (controller_when_false_) {
+            linker.link(*controller_when_false_);
+        }
+        const ParamMask after_false = linker.available();
+
+        linker.set_available(upstream);
+        if (controller_when_true_) {
+            linker.link(*controller_when_true_);
         }
+        linker.set_available(after_false | linker.available());
     }
 
     /// Get the type name of this controller
@@ -91,7 +115,9 @@ class ConditionalSwitchMetaController : public BaseController
         }
 
         // Print type and condition key (no execution number for meta controllers)
-        printf("%s [%s]\n", type_name(), condition_key_);
+        printf("%s [%s]", type_name(), condition_key_);
+        dump_execution_stats();
+        printf("\n");
 
         // Build new prefix for children
         etl::string<128> new_prefix;
@@ -119,6 +145,7 @@ class ConditionalSwitchMetaController : public BaseController
 
   private:
     const char* condition_key_;             ///< Key name to read from ControllersIO
+    IOKey condition_io_key_;                ///< Pre-hashed condition key
     BaseController* controller_when_true_;  ///< Controller executed when condition is true
     BaseController* controller_when_false_; ///< Controller executed when condition is false
 };
@@ -6,10 +6,52 @@
 #include "motion_control_common/BaseMetaController.hpp"
 #include "utils.hpp"
 
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+#include "etl/vector.h"
+#include <mutex.h>
+#endif
+
 namespace cogip {
 
 namespace motion_control {
 
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+/// Controllers with execution time statistics, in registration order
+static etl::vector<BaseController*, MOTION_CONTROL_PROFILED_CONTROLLERS_MAX>
+    profiled_controllers;
+
+/// Protect registration from several engine threads
+static mutex_t profiled_controllers_mutex = MUTEX_INIT;
+
+void BaseController::register_profiled(BaseController* controller)
+{
+    mutex_lock(&profiled_controllers_mutex);
+    if (!profiled_controllers.full()) {
+        profiled_controllers.push_back(controller);
+    }
+    mutex_unlock(&profiled_controllers_mutex);
+}
+
+size_t BaseController::profiled_controllers_count()
+{
+    return profiled_controllers.size();
+}
+
+const BaseController* BaseController::profiled_controller(size_t index)
+{
+    return (index < profiled_controllers.size()) ? profiled_controllers[index] : nullptr;
+}
+
+void BaseController::reset_profiled_execution_stats()
+{
+    mutex_lock(&profiled_controllers_mutex);
+    for (BaseController* controller : profiled_controllers) {
+        controller->reset_execution_stats();
+    }
+    mutex_unlock(&profiled_controllers_mutex);
+}
+#endif
+
 bool BaseController::set_meta(BaseMetaController* meta)
 {
     if ((meta) && (meta_)) {
@@ -1,13 +1,22 @@
 #include "motion_control_common/BaseControllerEngine.hpp"
 #include "log.h"
 #include "motion_control_common/Controller.hpp"
+#include "motion_control_common/CycleCounter.hpp"
+#include "panic.h"
 #include "thread/thread.hpp"
+#if defined(MODULE_MOTION_CONTROL_PROFILING) && defined(MODULE_SYSMON)
+#include "etl/string.h"
+#include "sysmon/ExecutionStatus.hpp"
+#include "sysmon/sysmon.hpp"
+#endif
 
 #define ENABLE_DEBUG 0
 #include <debug.h>
 
 // RIOT includes
+#include <cerrno>
 #include <cstring>
+#include <inttypes.h>
 #include <time_units.h>
 #include <ztimer.h>
 
@@ -17,10 +26,16 @@ namespace motion_control {
 
 #define CONTROLLER_PRIO (THREAD_PRIORITY_MAIN - 2)
 
+/// Engine IO keys, hashed at compile time
+static const IOKey pose_reached_key("pose_reached");
+
 BaseControllerEngine::BaseControllerEngine(uint32_t engine_thread_period_ms)
-    : enable_(true), controller_(nullptr), current_cycle_(0), pose_reached_(moving),
+    : enable_(true), controller_(nullptr), staged_controller_(nullptr),
+      staged_timeout_enable_(false), staged_at_(0), last_switch_latency_(0), switches_count_(0),
+      unrecorded_switch_(false), current_cycle_(0), pose_reached_(moving),
       timeout_cycle_counter_(0), timeout_ms_(0), timeout_enable_(false),
-      engine_thread_period_ms_(engine_thread_period_ms), brake_(false), brake_controller_(nullptr)
+      engine_thread_period_ms_(engine_thread_period_ms), brake_(false), brake_controller_(nullptr),
+      recorder_(nullptr)
 {
     memset(engine_thread_stack_, 0, sizeof(engine_thread_stack_));
     mutex_init(&mutex_);
@@ -36,12 +51,159 @@ static void* _start_thread(void* arg)
 void BaseControllerEngine::set_controller(BaseController* controller)
 {
     controller_ = controller;
+    link(controller_);
+}
+
+void BaseControllerEngine::stage_controller(BaseController* controller, bool timeout_enable)
+{
+    // Link phase, out of the engine loop
+    link(controller);
+
+    // Only wait for the end of the current cycle, if any
+    mutex_lock(&mutex_);
+    staged_controller_ = controller;
+    staged_timeout_enable_ = timeout_enable;
+    staged_at_ = cycle_counter::now();
+    mutex_unlock(&mutex_);
+}
+
+void BaseControllerEngine::switch_controller()
+{
+    // IO still holds the previous chain outputs and this cycle inputs
+    if (staged_controller_) {
+        staged_controller_->handoff(io_);
+    }
+
+    controller_ = staged_controller_;
+    staged_controller_ = nullptr;
+
+    // Avoid stale blocked/reached state and timeout from previous chain
+    current_cycle_ = 0;
+    pose_reached_ = target_pose_status_t::moving;
+    io_.set(pose_reached_key, pose_reached_);
+    set_timeout_enable(staged_timeout_enable_);
+
+    last_switch_latency_ = cycle_counter::now() - staged_at_;
+    switches_count_++;
+    unrecorded_switch_ = true;
+}
+
+void BaseControllerEngine::set_recorder(CycleRecorder* recorder)
+{
+    mutex_lock(&mutex_);
+    recorder_ = recorder;
+    mutex_unlock(&mutex_);
+}
+
+void BaseControllerEngine::record_inputs()
+{
+    uint8_t flags = 0;
+    if (brake_ && brake_controller_) {
+        flags |= cycle_record_braking;
+    }
+    if (unrecorded_switch_) {
+        flags |= cycle_record_switched;
+        unrecorded_switch_ = false;
+    }
+
+    recorder_->record_inputs(io_, current_cycle_, flags);
+}
+
+uint32_t BaseControllerEngine::last_switch_latency_ns() const
+{
+    return cycle_counter::to_ns(last_switch_latency_);
+}
+
+void BaseControllerEngine::link_inputs(ChainLinker& linker) const
+{
+    linker.provides(pose_reached_key);
+}
+
+size_t BaseControllerEngine::link(const BaseController* controller) const
+{
+    if (!controller) {
+        return 0;
+    }
+
+    ChainLinker linker;
+    link_inputs(linker);
+    linker.link(*controller);
+
+    // Keys dropped by a full registry would silently fall back to defaults
+    if (linker.overflows()) {
+        LOG_ERROR("Engine: %" PRIu32 " IO keys rejected, MAX_PARAMS=%" PRIu32 " too small\n",
+                  static_cast<uint32_t>(linker.overflows()), static_cast<uint32_t>(MAX_PARAMS));
+        core_panic(PANIC_GENERAL_ERROR, "ControllersIO keys registry full");
+    }
+
+    if (linker.unresolved()) {
+        LOG_WARNING("Engine: %" PRIu32 " IO keys read without upstream writer\n",
+                    static_cast<uint32_t>(linker.unresolved()));
+    }
+
+    return linker.unresolved();
+}
+
+int BaseControllerEngine::publish_output(const IOKey& key)
+{
+    if (published_keys_.full()) {
+        LOG_ERROR("Engine: cannot publish %.*s, too many published outputs\n",
+                  static_cast<int>(key.size()), key.data());
+        return ENOMEM;
+    }
+
+    ControllersIO::resolve(key);
+    published_keys_.push_back(key);
+
+    return 0;
+}
+
+void BaseControllerEngine::publish_outputs()
+{
+    if (published_keys_.empty()) {
+        return;
+    }
+
+    capture_.capture(io_, published_keys_.data(), published_keys_.size(), current_cycle_);
+    outputs_.write(capture_);
+}
+
+#if defined(MODULE_MOTION_CONTROL_PROFILING) && defined(MODULE_SYSMON)
+/// Send controllers execution time statistics to the system monitor
+static void _update_sysmon_execution_status()
+{
+    etl::string<SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH> name;
+
+    for (size_t i = 0; i < BaseController::profiled_controllers_count(); i++) {
+        const BaseController* controller = BaseController::profiled_controller(i);
+        const ExecutionStats& stats = controller->execution_stats();
+
+        name = controller->type_name();
+        if (!controller->name().empty()) {
+            name.append(": ");
+            name.append(controller->name().data(), controller->name().size());
+        }
+
+        sysmon::update_execution_status(
+            i, name.c_str(), stats.count(), cycle_counter::to_ns(stats.min()),
+            cycle_counter::to_ns(stats.mean()), cycle_counter::to_ns(stats.max()));
+    }
 }
+#endif
 
 void BaseControllerEngine::thread_loop()
 {
-    // Init loop iteration start time
-    ztimer_now_t loop_start_time = ztimer_now(ZTIMER_USEC);
+    const uint32_t period_us = engine_thread_period_ms_ * US_PER_MS;
+
+    // Init loop iteration start time, cycles then start on period boundaries
+    // so that threads feeding the engine can be phased ahead of them
+    ztimer_now_t loop_start_time =
+        thread::thread_align_wakeup(thread::thread_ztimer_now(ZTIMER_USEC), period_us);
+
+#if defined(MODULE_MOTION_CONTROL_PROFILING) && defined(MODULE_SYSMON)
+    // Loops since last execution time statistics update
+    uint32_t sysmon_loops = 0;
+#endif
 
     while (true) {
         // Protect engine loop
@@ -55,17 +217,26 @@ void BaseControllerEngine::thread_loop()
         // Set controller inputs
         prepare_inputs();
 
+        // Swap the staged controller on the cycle boundary
+        if (staged_controller_) {
+            switch_controller();
+        }
+
         // Clear modified flags
         io_.clear_modified();
 
+        if (recorder_ && enable_) {
+            record_inputs();
+        }
+
         if (enable_) {
             if (brake_ && brake_controller_) {
                 // Brake latched: run the minimal brake chain and let
                 // process_outputs drive the motor(s) toward zero speed.
-                brake_controller_->execute(io_);
+                brake_controller_->profiled_execute(io_);
             } else if (controller_) {
                 // Execute controller
-                controller_->execute(io_);
+                controller_->profiled_execute(io_);
 
                 // Next cycle
                 current_cycle_++;
@@ -83,21 +254,40 @@ void BaseControllerEngine::thread_loop()
                 }
             }
 
+            // Publish controllers outputs before processing them, so that
+            // callbacks triggered by process_outputs() see this cycle values
+            publish_outputs();
+
+            if (recorder_) {
+                recorder_->record_outputs(io_);
+            }
+
             // Process controller outputs
             process_outputs();
         }
 
+#if defined(MODULE_MOTION_CONTROL_PROFILING) && defined(MODULE_SYSMON)
+        // Refresh execution time statistics about once per second
+        if (++sysmon_loops >= (MS_PER_SEC / engine_thread_period_ms_)) {
+            sysmon_loops = 0;
+            _update_sysmon_execution_status();
+        }
+#endif
+
         // End of engine loop
         mutex_unlock(&mutex_);
 
-        // Wait thread period to end
-        thread::thread_ztimer_periodic_wakeup(ZTIMER_USEC, &loop_start_time,
-                                              engine_thread_period_ms_ * US_PER_MS);
+        // Wait thread period to end, back on period boundaries after an overshoot
+        thread::thread_ztimer_periodic_wakeup(ZTIMER_USEC, &loop_start_time, period_us);
+        loop_start_time = thread::thread_align_wakeup(loop_start_time, period_us);
     }
 }
 
 void BaseControllerEngine::start_thread()
 {
+    // Used by profiling and rate groups load measurement
+    cycle_counter::init();
+
     thread_create(engine_thread_stack_, sizeof(engine_thread_stack_), CONTROLLER_PRIO,
                   THREAD_CREATE_STACKTEST, _start_thread, this, "Controller thread");
 }
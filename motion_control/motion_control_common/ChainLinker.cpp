@@ -0,0 +1,84 @@
+#include "motion_control_common/ChainLinker.hpp"
+#include "log.h"
+#include "motion_control_common/BaseController.hpp"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+void ChainLinker::link(const BaseController& controller)
+{
+    const BaseController* parent = current_;
+    current_ = &controller;
+    controller.link(*this);
+    current_ = parent;
+}
+
+ParamSlot ChainLinker::resolve(const IOKey& key)
+{
+    ParamSlot slot = ControllersIO::resolve(key);
+    if (slot == INVALID_PARAM_SLOT) {
+        overflows_++;
+    }
+    return slot;
+}
+
+void ChainLinker::provides(const IOKey& key)
+{
+    if (key.empty()) {
+        return;
+    }
+
+    ParamSlot slot = resolve(key);
+    if (slot != INVALID_PARAM_SLOT) {
+        available_.set(slot);
+    }
+}
+
+void ChainLinker::reads(const IOKey& key)
+{
+    if (key.empty()) {
+        return;
+    }
+
+    ParamSlot slot = resolve(key);
+    if ((slot == INVALID_PARAM_SLOT) || !available_.test(slot)) {
+        etl::string_view type = current_ ? current_->type_name() : "";
+        etl::string_view name = current_ ? current_->name() : "";
+        LOG_WARNING("Link: %.*s %.*s reads %.*s which is not written upstream\n",
+                    static_cast<int>(type.size()), type.data(), static_cast<int>(name.size()),
+                    name.data(), static_cast<int>(key.size()), key.data());
+        unresolved_++;
+    }
+}
+
+void ChainLinker::reads_optional(const IOKey& key)
+{
+    if (key.empty()) {
+        return;
+    }
+
+    resolve(key);
+}
+
+void ChainLinker::writes(const IOKey& key)
+{
+    if (key.empty()) {
+        return;
+    }
+
+    ParamSlot slot = resolve(key);
+    if (slot != INVALID_PARAM_SLOT) {
+        available_.set(slot);
+    }
+
+    DEBUG("Link: %s writes %.*s\n", current_ ? current_->type_name() : "",
+          static_cast<int>(key.size()), key.data());
+}
+
+} // namespace motion_control
+
+} // namespace cogip
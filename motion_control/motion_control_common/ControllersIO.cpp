@@ -1,8 +1,13 @@
 #include "motion_control_common/ControllersIO.hpp"
-#include "etl/algorithm.h"
 #include "etl/fnv_1.h"
 #include "log.h"
 
+// System includes
+#include <cstring>
+
+// RIOT includes
+#include <mutex.h>
+
 #define ENABLE_DEBUG 0
 #include <debug.h>
 
@@ -10,136 +15,253 @@ namespace cogip {
 
 namespace motion_control {
 
+/// Process-wide key registry: slot index -> key hash/name. Shared by every
+/// ControllersIO instance so that a slot cached in an IOKey is valid for all of
+/// them. Plain arrays so that the registry is constant-initialized and usable
+/// from static constructors.
+static ParamKey registry_hashes[MAX_PARAMS];
+static KeyType registry_names[MAX_PARAMS];
+static size_t registry_size = 0;
+static mutex_t registry_mutex = MUTEX_INIT;
+
 /// Compute FNV-1a 32-bit hash of a string key.
 ParamKey ControllersIO::hash_key(KeyType key)
 {
     return etl::fnv_1a_32(key.begin(), key.end()).value();
 }
 
-/// Set or update a parameter value. Returns EACCES if the key is read-only.
-int ControllersIO::set(KeyType key, const ParamValue& value)
+/// Look up a key in the registry, adding it if requested, and cache its slot.
+ParamSlot ControllersIO::register_key(const IOKey& key, bool create)
 {
-    ParamKey h = hash_key(key);
-    if (readonly_keys_.contains(h)) {
-        LOG_ERROR("Cannot set read-only %.*s\n", static_cast<int>(key.size()), key.data());
-        return EACCES;
+    ParamSlot slot = INVALID_PARAM_SLOT;
+
+    mutex_lock(&registry_mutex);
+    for (size_t i = 0; i < registry_size; i++) {
+        if (registry_hashes[i] == key.hash()) {
+            slot = static_cast<ParamSlot>(i);
+            break;
+        }
     }
-    if (data_.full() && !data_.contains(h)) {
-        LOG_ERROR("Error: Cannot set %.*s - parameters storage is full\n",
-                  static_cast<int>(key.size()), key.data());
-        return ENOMEM;
+    if ((slot == INVALID_PARAM_SLOT) && create) {
+        if (registry_size < MAX_PARAMS) {
+            slot = static_cast<ParamSlot>(registry_size);
+            registry_hashes[registry_size] = key.hash();
+            registry_names[registry_size] = key.name();
+            registry_size++;
+        } else {
+            LOG_ERROR("Error: Cannot register %.*s - keys registry is full\n",
+                      static_cast<int>(key.size()), key.data());
+        }
     }
-    data_[h] = value;
-    if (_modified_keys.full() && !_modified_keys.contains(h)) {
-        LOG_WARNING("Warning: Cannot track modification for %.*s - modified keys "
-                    "storage is full\n",
-                    static_cast<int>(key.size()), key.data());
-    } else {
-        _modified_keys.insert(h);
+    if (slot != INVALID_PARAM_SLOT) {
+        key.slot_ = slot;
     }
-    return 0;
+    mutex_unlock(&registry_mutex);
+
+    return slot;
 }
 
-/// Mark a parameter key as read-only.
-void ControllersIO::mark_readonly(KeyType key)
+/// Name of the key registered at a given slot.
+KeyType ControllersIO::key_name(ParamSlot slot)
 {
-    if (readonly_keys_.full()) {
-        LOG_ERROR("Error: Cannot mark %.*s as read-only - readonly keys storage is "
-                  "full\n",
-                  static_cast<int>(key.size()), key.data());
-        return;
-    }
-    readonly_keys_.insert(hash_key(key));
+    return (slot < registry_size) ? registry_names[slot] : KeyType();
 }
 
-/// Reset read-only parameters list.
-void ControllersIO::reset_readonly_markers()
+/// Number of keys registered so far.
+size_t ControllersIO::registered_keys()
 {
-    readonly_keys_.clear();
+    return registry_size;
 }
 
-/// Retrieve the raw variant value for a key.
-OptionalValue ControllersIO::get(KeyType key) const
+/// Slot of a registered key, from its hash.
+ParamSlot ControllersIO::registered_slot(ParamKey hash)
 {
-    ParamKey h = hash_key(key);
-    auto it = data_.find(h);
-    if (it == data_.end()) {
-        DEBUG("Error key not found %.*s\n", static_cast<int>(key.size()), key.data());
+    ParamSlot slot = INVALID_PARAM_SLOT;
+
+    mutex_lock(&registry_mutex);
+    for (size_t i = 0; i < registry_size; i++) {
+        if (registry_hashes[i] == hash) {
+            slot = static_cast<ParamSlot>(i);
+            break;
+        }
     }
-    return (it != data_.end()) ? OptionalValue{it->second} : OptionalValue{};
+    mutex_unlock(&registry_mutex);
+
+    return slot;
 }
 
-/// Returns a vector of all ParamKeys that have been written since the last
-/// clear_modified().
-ParamKeyVector ControllersIO::snapshot_modified() const
+/// Resolve the slot of a key about to be written.
+int ControllersIO::writable_slot(const IOKey& key, ParamSlot& slot)
 {
-    ParamKeyVector result;
-    result.reserve(_modified_keys.size());
-    for (auto it = _modified_keys.begin(); it != _modified_keys.end(); ++it) {
-        if (result.full()) {
-            LOG_WARNING("Warning: snapshot_modified() result vector is full, some "
-                        "keys will be missing\n");
-            break;
-        }
-        result.push_back(*it);
+    slot = resolve(key);
+    if (slot == INVALID_PARAM_SLOT) {
+        LOG_ERROR("Error: Cannot set %.*s - parameters storage is full\n",
+                  static_cast<int>(key.size()), key.data());
+        return ENOMEM;
     }
-    return result;
+    if (readonly_.test(slot)) {
+        LOG_ERROR("Cannot set read-only %.*s\n", static_cast<int>(key.size()), key.data());
+        return EACCES;
+    }
+    return 0;
 }
 
-/// @brief Find which keys in `new_keys` also appear in `already_written`.
-/// @param new_keys         Vector of keys newly written by one controller
-/// subtree.
-/// @param already_written  Set of keys written so far by earlier siblings.
-/// @return A vector of ParamKey that appear in both.
-ParamKeyVector ControllersIO::find_collisions(const ParamKeyVector& new_keys,
-                                              const etl::set<ParamKey, MAX_PARAMS>& already_written)
+/// Store a double value in the side table. The entry already owned by the
+/// slot is reused, otherwise an entry free or left by a slot that changed
+/// type is taken.
+int ControllersIO::store(ParamSlot slot, double value)
 {
-    ParamKeyVector collisions;
-    collisions.reserve(new_keys.size());
-
-    for (auto h_new : new_keys) {
-        if (already_written.contains(h_new)) {
-            if (collisions.full()) {
-                LOG_WARNING("Warning: find_collisions() result vector is full, some "
-                            "collisions will be missing\n");
+    size_t index = side_index(doubles_, slot);
+    if (index == doubles_.size()) {
+        for (index = 0; index < doubles_.size(); index++) {
+            const ParamSlot owner = doubles_[index].slot;
+            if ((owner == INVALID_PARAM_SLOT) || (types_[owner] != ParamType::double_value)) {
                 break;
             }
-            collisions.push_back(h_new);
         }
+        if (index == doubles_.size()) {
+            LOG_ERROR("Error: Cannot set %.*s - double storage is full\n",
+                      static_cast<int>(key_name(slot).size()), key_name(slot).data());
+            return ENOMEM;
+        }
+        doubles_[index].slot = slot;
     }
-    return collisions;
+    doubles_[index].value = value;
+    types_[slot] = ParamType::double_value;
+    return 0;
 }
 
-/// @brief Compute the set‐difference “after \ before” for two lists of keys.
-/// @param before_ctrl All keys present before running a subtree.
-/// @param after_ctrl  All keys present after running that subtree.
-/// @return A vector containing keys in `after_ctrl` but not in `before_ctrl`.
-ParamKeyVector ControllersIO::difference(const ParamKeyVector& after_ctrl,
-                                         const ParamKeyVector& before_ctrl)
+/// Store a string value in the side table, same policy as doubles.
+int ControllersIO::store(ParamSlot slot, const ParamString& value)
 {
-    ParamKeyVector result;
-    result.reserve(after_ctrl.size());
-
-    for (auto h_new : after_ctrl) {
-        // Define predicate with explicit type to ensure correct TUnaryPredicate
-        auto predicate = [h_new](const ParamKey& h_old) -> bool { return h_new == h_old; };
-        bool in_before = etl::any_of(before_ctrl.begin(), before_ctrl.end(), predicate);
-        if (!in_before) {
-            if (result.full()) {
-                LOG_WARNING("Warning: difference() result vector is full, some keys "
-                            "will be missing\n");
+    size_t index = side_index(strings_, slot);
+    if (index == strings_.size()) {
+        for (index = 0; index < strings_.size(); index++) {
+            const ParamSlot owner = strings_[index].slot;
+            if ((owner == INVALID_PARAM_SLOT) || (types_[owner] != ParamType::string_value)) {
                 break;
             }
-            result.push_back(h_new);
         }
+        if (index == strings_.size()) {
+            LOG_ERROR("Error: Cannot set %.*s - string storage is full\n",
+                      static_cast<int>(key_name(slot).size()), key_name(slot).data());
+            return ENOMEM;
+        }
+        strings_[index].slot = slot;
     }
-    return result;
+    strings_[index].value = value;
+    types_[slot] = ParamType::string_value;
+    return 0;
 }
 
-/// Clears the internal “dirty” set, so subsequent sets will be newly recorded.
-void ControllersIO::clear_modified()
+/// Set or update a parameter value from a variant.
+int ControllersIO::set(const IOKey& key, const ParamValue& value)
+{
+    if (etl::holds_alternative<float>(value)) {
+        return set(key, etl::get<float>(value));
+    }
+    if (etl::holds_alternative<double>(value)) {
+        return set(key, etl::get<double>(value));
+    }
+    if (etl::holds_alternative<int>(value)) {
+        return set(key, etl::get<int>(value));
+    }
+    if (etl::holds_alternative<bool>(value)) {
+        return set(key, etl::get<bool>(value));
+    }
+    return set(key, etl::get<ParamString>(value));
+}
+
+/// Retrieve the raw variant value for a key.
+OptionalValue ControllersIO::get(const IOKey& key) const
+{
+    const ParamSlot slot = find(key);
+    if (slot == INVALID_PARAM_SLOT) {
+        return {};
+    }
+    switch (types_[slot]) {
+    case ParamType::float_value:
+        return OptionalValue{ParamValue(load<float>(slot))};
+    case ParamType::double_value:
+        return OptionalValue{ParamValue(load<double>(slot))};
+    case ParamType::int_value:
+        return OptionalValue{ParamValue(load<int>(slot))};
+    case ParamType::bool_value:
+        return OptionalValue{ParamValue(load<bool>(slot))};
+    case ParamType::string_value:
+        return OptionalValue{ParamValue(load<ParamString>(slot))};
+    default:
+        return {};
+    }
+}
+
+/// Read the bits of a float, int or bool slot.
+bool ControllersIO::read_slot(ParamSlot slot, ParamType& type, uint32_t& bits) const
+{
+    if (slot >= MAX_PARAMS) {
+        return false;
+    }
+
+    type = types_[slot];
+    switch (type) {
+    case ParamType::float_value:
+        memcpy(&bits, &floats_[slot], sizeof(bits));
+        return true;
+    case ParamType::int_value:
+        bits = static_cast<uint32_t>(ints_[slot]);
+        return true;
+    case ParamType::bool_value:
+        bits = bools_[slot] ? 1 : 0;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Write the bits of a float, int or bool slot.
+int ControllersIO::write_slot(ParamSlot slot, ParamType type, uint32_t bits)
+{
+    if (slot >= MAX_PARAMS) {
+        return EINVAL;
+    }
+
+    switch (type) {
+    case ParamType::float_value: {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        store(slot, value);
+        break;
+    }
+    case ParamType::int_value:
+        store(slot, static_cast<int>(bits));
+        break;
+    case ParamType::bool_value:
+        store(slot, bits != 0);
+        break;
+    default:
+        return EINVAL;
+    }
+    modified_.set(slot);
+
+    return 0;
+}
+
+/// Mark a parameter key as read-only.
+void ControllersIO::mark_readonly(const IOKey& key)
+{
+    ParamSlot slot = resolve(key);
+    if (slot == INVALID_PARAM_SLOT) {
+        LOG_ERROR("Error: Cannot mark %.*s as read-only - parameters storage is full\n",
+                  static_cast<int>(key.size()), key.data());
+        return;
+    }
+    readonly_.set(slot);
+}
+
+/// Reset read-only parameters list.
+void ControllersIO::reset_readonly_markers()
 {
-    _modified_keys.clear();
+    readonly_.clear();
 }
 
 } // namespace motion_control
@@ -0,0 +1,212 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+#include "motion_control_common/CycleRecorder.hpp"
+#include "log.h"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+#include <cstdio>
+#include <inttypes.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+/// Encode a 16-bit value, little endian
+static void _put_u16(uint8_t* out, uint16_t value)
+{
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+/// Encode a 32-bit value, little endian
+static void _put_u32(uint8_t* out, uint32_t value)
+{
+    for (size_t i = 0; i < 4; i++) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+CycleRecorder::CycleRecorder(uint8_t* buffer, size_t size)
+    : buffer_(buffer), size_(size), head_(0), tail_(0), used_(0), records_(0), dropped_(0),
+      keyframe_(0), record_size_(0), count_index_(0)
+{
+    clear();
+}
+
+void CycleRecorder::clear()
+{
+    head_ = 0;
+    tail_ = 0;
+    used_ = 0;
+    records_ = 0;
+    dropped_ = 0;
+    keyframe_ = 0;
+    record_size_ = 0;
+    last_types_.fill(ParamType::none);
+    last_bits_.fill(0);
+}
+
+void CycleRecorder::append_entry(ParamSlot slot, ParamType type, uint32_t bits)
+{
+    uint8_t* entry = &record_[record_size_];
+    entry[0] = slot;
+    entry[1] = static_cast<uint8_t>(type);
+    _put_u32(&entry[2], bits);
+    record_size_ += CYCLE_RECORD_ENTRY_SIZE;
+    record_[count_index_]++;
+}
+
+void CycleRecorder::record_inputs(const ControllersIO& io, uint32_t cycle, uint8_t flags)
+{
+    const bool keyframe = (keyframe_ == 0);
+    keyframe_ = keyframe ? MOTION_CONTROL_RECORDER_KEYFRAME_INTERVAL - 1 : keyframe_ - 1;
+
+    // Header, size is set once outputs are recorded
+    _put_u32(&record_[2], cycle);
+    record_[6] = flags | (keyframe ? cycle_record_keyframe : 0);
+    record_size_ = CYCLE_RECORD_HEADER_SIZE;
+
+    // Inputs: values changed since the end of the previous record
+    count_index_ = record_size_++;
+    record_[count_index_] = 0;
+    for (size_t slot = 0; slot < ControllersIO::registered_keys(); slot++) {
+        ParamType type;
+        uint32_t bits;
+        if (!io.read_slot(static_cast<ParamSlot>(slot), type, bits)) {
+            continue;
+        }
+        if (keyframe || (type != last_types_[slot]) || (bits != last_bits_[slot])) {
+            append_entry(static_cast<ParamSlot>(slot), type, bits);
+            last_types_[slot] = type;
+            last_bits_[slot] = bits;
+        }
+    }
+}
+
+void CycleRecorder::record_outputs(const ControllersIO& io)
+{
+    if (record_size_ == 0) {
+        return;
+    }
+
+    // Outputs: values written by the chain
+    count_index_ = record_size_++;
+    record_[count_index_] = 0;
+    io.snapshot_modified().for_each([&](ParamSlot slot) {
+        ParamType type;
+        uint32_t bits;
+        if (io.read_slot(slot, type, bits)) {
+            append_entry(slot, type, bits);
+            last_types_[slot] = type;
+            last_bits_[slot] = bits;
+        }
+    });
+
+    _put_u16(&record_[0], static_cast<uint16_t>(record_size_));
+
+    if (record_size_ > size_) {
+        // Values of this record are lost, restart from a full IO state
+        dropped_++;
+        keyframe_ = 0;
+    } else {
+        while ((size_ - used_) < record_size_) {
+            drop_oldest();
+        }
+        write(record_.data(), record_size_);
+        records_++;
+    }
+
+    record_size_ = 0;
+}
+
+void CycleRecorder::drop_oldest()
+{
+    const size_t size = buffer_[tail_] | (buffer_[(tail_ + 1) % size_] << 8);
+
+    tail_ = (tail_ + size) % size_;
+    used_ -= size;
+    records_--;
+    dropped_++;
+}
+
+void CycleRecorder::write(const uint8_t* data, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        buffer_[head_] = data[i];
+        head_ = (head_ + 1) % size_;
+    }
+    used_ += size;
+}
+
+size_t CycleRecorder::export_size() const
+{
+    return 4 + 1 + 1 + (4 * ControllersIO::registered_keys()) + 4 + used_;
+}
+
+size_t CycleRecorder::export_recording(sink_t sink, void* arg) const
+{
+    uint8_t header[6];
+    _put_u32(&header[0], CYCLE_RECORDING_MAGIC);
+    header[4] = CYCLE_RECORDING_VERSION;
+    header[5] = static_cast<uint8_t>(ControllersIO::registered_keys());
+    sink(header, sizeof(header), arg);
+
+    // Keys dictionary, in slot order
+    for (size_t slot = 0; slot < ControllersIO::registered_keys(); slot++) {
+        const KeyType name = ControllersIO::key_name(static_cast<ParamSlot>(slot));
+        uint8_t hash[4];
+        _put_u32(hash, static_cast<uint32_t>(ControllersIO::hash_key(name)));
+        sink(hash, sizeof(hash), arg);
+    }
+
+    uint8_t records_size[4];
+    _put_u32(records_size, static_cast<uint32_t>(used_));
+    sink(records_size, sizeof(records_size), arg);
+
+    // Records, oldest first, in at most two contiguous parts
+    const size_t first_part = (tail_ + used_ > size_) ? size_ - tail_ : used_;
+    if (first_part) {
+        sink(&buffer_[tail_], first_part, arg);
+    }
+    if (used_ > first_part) {
+        sink(buffer_, used_ - first_part, arg);
+    }
+
+    return export_size();
+}
+
+/// Print bytes as hexadecimal, 32 bytes per line
+static void _print_hex(const uint8_t* data, size_t size, void* arg)
+{
+    size_t* column = static_cast<size_t*>(arg);
+
+    for (size_t i = 0; i < size; i++) {
+        printf("%02x", data[i]);
+        if (++(*column) == 32) {
+            printf("\n");
+            *column = 0;
+        }
+    }
+}
+
+void CycleRecorder::print() const
+{
+    size_t column = 0;
+
+    export_recording(_print_hex, &column);
+    if (column) {
+        printf("\n");
+    }
+
+    DEBUG("CycleRecorder: %u records, %" PRIu32 " dropped\n", static_cast<unsigned>(records_),
+          dropped_);
+}
+
+} // namespace motion_control
+
+} // namespace cogip
@@ -0,0 +1,242 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+#include "motion_control_common/CycleReplayer.hpp"
+#include "log.h"
+#include "motion_control_common/ChainLinker.hpp"
+#include "motion_control_common/CycleCounter.hpp"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <inttypes.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+/// Decode a 16-bit value, little endian
+static uint16_t _get_u16(const uint8_t* in)
+{
+    return static_cast<uint16_t>(in[0] | (in[1] << 8));
+}
+
+/// Decode a 32-bit value, little endian
+static uint32_t _get_u32(const uint8_t* in)
+{
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; i++) {
+        value |= static_cast<uint32_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+/// Print a recorded value according to its type
+static void _print_value(ParamType type, uint32_t bits)
+{
+    switch (type) {
+    case ParamType::float_value: {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        printf("%f", static_cast<double>(value));
+        break;
+    }
+    case ParamType::int_value:
+        printf("%" PRId32, static_cast<int32_t>(bits));
+        break;
+    case ParamType::bool_value:
+        printf("%s", bits ? "true" : "false");
+        break;
+    default:
+        printf("(none)");
+        break;
+    }
+}
+
+int CycleReplayer::load(const uint8_t* data, size_t size)
+{
+    if ((size < 6) || (_get_u32(data) != CYCLE_RECORDING_MAGIC) ||
+        (data[4] != CYCLE_RECORDING_VERSION)) {
+        LOG_ERROR("CycleReplayer: not a recording\n");
+        return EINVAL;
+    }
+
+    nb_keys_ = data[5];
+    const size_t header_size = 6 + (4 * nb_keys_) + 4;
+    if ((nb_keys_ > MAX_PARAMS) || (size < header_size)) {
+        LOG_ERROR("CycleReplayer: invalid keys dictionary\n");
+        return EINVAL;
+    }
+    keys_ = &data[6];
+
+    records_size_ = _get_u32(&data[header_size - 4]);
+    if (size < header_size + records_size_) {
+        LOG_ERROR("CycleReplayer: truncated recording\n");
+        return EINVAL;
+    }
+    records_ = &data[header_size];
+
+    return 0;
+}
+
+ReplayResult CycleReplayer::replay(ControllersIO& io, BaseController& controller,
+                                   BaseController* brake_controller, bool verbose)
+{
+    ReplayResult result;
+    printed_ = 0;
+
+    // Register the keys of the chains, then map recorded slots to them
+    ChainLinker linker;
+    linker.link(controller);
+    if (brake_controller) {
+        linker.link(*brake_controller);
+    }
+    for (size_t i = 0; i < nb_keys_; i++) {
+        slots_map_[i] = ControllersIO::registered_slot(_get_u32(&keys_[4 * i]));
+    }
+
+    controller.reset();
+    if (brake_controller) {
+        brake_controller->reset();
+    }
+
+    bool started = false;
+    size_t offset = 0;
+    while (offset < records_size_) {
+        const uint8_t* record = &records_[offset];
+        if (records_size_ - offset < CYCLE_RECORD_HEADER_SIZE + 2) {
+            LOG_ERROR("CycleReplayer: truncated record at offset %u\n",
+                      static_cast<unsigned>(offset));
+            break;
+        }
+        const size_t size = _get_u16(record);
+
+        // Check the record is consistent with its entries count
+        const size_t inputs_size = CYCLE_RECORD_ENTRY_SIZE * record[CYCLE_RECORD_HEADER_SIZE];
+        const size_t outputs_index = CYCLE_RECORD_HEADER_SIZE + 1 + inputs_size;
+        if ((size <= outputs_index) || (offset + size > records_size_) ||
+            (size != outputs_index + 1 + CYCLE_RECORD_ENTRY_SIZE * record[outputs_index])) {
+            LOG_ERROR("CycleReplayer: corrupted record at offset %u\n",
+                      static_cast<unsigned>(offset));
+            break;
+        }
+        offset += size;
+
+        const uint32_t cycle = _get_u32(&record[2]);
+        const uint8_t flags = record[6];
+
+        // Inputs deltas are meaningless before a full IO state
+        if ((!started) && (!(flags & cycle_record_keyframe))) {
+            result.skipped++;
+            continue;
+        }
+        started = true;
+
+        io.reset_readonly_markers();
+        apply_inputs(io, &record[CYCLE_RECORD_HEADER_SIZE], result);
+        io.clear_modified();
+
+        if (flags & cycle_record_switched) {
+            controller.handoff(io);
+        }
+
+        const uint32_t start = cycle_counter::now();
+        if ((flags & cycle_record_braking) && brake_controller) {
+            brake_controller->profiled_execute(io);
+        } else {
+            controller.profiled_execute(io);
+        }
+        result.execution_ns += cycle_counter::to_ns(cycle_counter::now() - start);
+
+        if (compare_outputs(io, &record[outputs_index], cycle, verbose, result)) {
+            result.mismatched_cycles++;
+        }
+        result.cycles++;
+    }
+
+    return result;
+}
+
+void CycleReplayer::apply_inputs(ControllersIO& io, const uint8_t* entries, ReplayResult& result)
+{
+    const uint8_t nb_entries = entries[0];
+
+    for (size_t i = 0; i < nb_entries; i++) {
+        const uint8_t* entry = &entries[1 + i * CYCLE_RECORD_ENTRY_SIZE];
+        const ParamSlot slot = map_slot(entry[0]);
+        if (slot == INVALID_PARAM_SLOT) {
+            result.unmapped++;
+            continue;
+        }
+        io.write_slot(slot, static_cast<ParamType>(entry[1]), _get_u32(&entry[2]));
+    }
+}
+
+uint32_t CycleReplayer::compare_outputs(const ControllersIO& io, const uint8_t* outputs,
+                                        uint32_t cycle, bool verbose, ReplayResult& result)
+{
+    const ParamMask& written = io.snapshot_modified();
+    const uint8_t nb_entries = outputs[0];
+    ParamMask recorded;
+    uint32_t mismatches = 0;
+
+    auto report = [&](ParamSlot slot, ParamType expected_type, uint32_t expected_bits,
+                      ParamType type, uint32_t bits) {
+        mismatches++;
+        if ((!verbose) || (printed_ >= MOTION_CONTROL_REPLAY_MISMATCHES_PRINTED)) {
+            return;
+        }
+        printed_++;
+        const KeyType name = ControllersIO::key_name(slot);
+        printf("cycle %" PRIu32 ": %.*s expected ", cycle, static_cast<int>(name.size()),
+               name.data());
+        _print_value(expected_type, expected_bits);
+        printf(", got ");
+        _print_value(type, bits);
+        printf("\n");
+    };
+
+    // Recorded outputs must have been written with the same value
+    for (size_t i = 0; i < nb_entries; i++) {
+        const uint8_t* entry = &outputs[1 + i * CYCLE_RECORD_ENTRY_SIZE];
+        const ParamSlot slot = map_slot(entry[0]);
+        if (slot == INVALID_PARAM_SLOT) {
+            result.unmapped++;
+            continue;
+        }
+        recorded.set(slot);
+
+        const ParamType expected_type = static_cast<ParamType>(entry[1]);
+        const uint32_t expected_bits = _get_u32(&entry[2]);
+        ParamType type = ParamType::none;
+        uint32_t bits = 0;
+        if ((!written.test(slot)) || (!io.read_slot(slot, type, bits))) {
+            type = ParamType::none;
+            bits = 0;
+        }
+        if ((type != expected_type) || (bits != expected_bits)) {
+            report(slot, expected_type, expected_bits, type, bits);
+        }
+    }
+
+    // Values written by the chain must have been recorded
+    written.without(recorded).for_each([&](ParamSlot slot) {
+        ParamType type;
+        uint32_t bits;
+        if (io.read_slot(slot, type, bits)) {
+            report(slot, ParamType::none, 0, type, bits);
+        }
+    });
+
+    result.mismatches += mismatches;
+    return mismatches;
+}
+
+} // namespace motion_control
+
+} // namespace cogip
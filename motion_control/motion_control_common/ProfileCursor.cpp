@@ -0,0 +1,49 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Incremental evaluation of a velocity profile
+/// @author     Gilles Doffe <g.doffe@gmail.com>
+
+#include "motion_control_common/ProfileCursor.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+void ProfileCursor::seek(uint32_t period)
+{
+    period_ = period;
+    total_periods_ = profile_->total_periods();
+    velocity_ = profile_->compute_theoretical_velocity(period);
+    remaining_distance_ = profile_->compute_theoretical_remaining_distance(period);
+
+    float jerk = 0.0f;
+    if (!profile_->phase_at(period, phase_end_, acceleration_, jerk)) {
+        // Trajectory complete: velocity is held, remaining distance no longer changes
+        acceleration_ = 0.0f;
+        step_ = 0.0f;
+        half_step_squared_ = 0.0f;
+        distance_jerk_ = 0.0f;
+        velocity_jerk_ = 0.0f;
+        acceleration_jerk_ = 0.0f;
+        return;
+    }
+
+    // Over n periods: d = n*v + n²/2*a + n³/6*j, v' = v + n*a + n²/2*j, a' = a + n*j
+    step_ = static_cast<float>(steps_);
+    half_step_squared_ = 0.5f * step_ * step_;
+    distance_jerk_ = half_step_squared_ * step_ * jerk / 3.0f;
+    velocity_jerk_ = half_step_squared_ * jerk;
+    acceleration_jerk_ = step_ * jerk;
+}
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
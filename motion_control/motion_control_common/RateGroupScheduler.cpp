@@ -0,0 +1,232 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+#include "motion_control_common/RateGroupScheduler.hpp"
+#include "log.h"
+#include "motion_control_common/CycleCounter.hpp"
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+#include <cerrno>
+#include <inttypes.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+/// Greatest common divisor
+static uint32_t _gcd(uint32_t a, uint32_t b)
+{
+    while (b) {
+        const uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+int RateGroupScheduler::add_controller(BaseController* controller, uint16_t divider,
+                                       uint16_t phase)
+{
+    if ((!controller) || (divider < 1) || (phase >= divider)) {
+        LOG_ERROR("RateGroupScheduler: invalid divider %" PRIu16 " or phase %" PRIu16 "\n",
+                  divider, phase);
+        return EINVAL;
+    }
+
+    for (auto& group : groups_) {
+        if ((group.divider == divider) && (group.phase == phase)) {
+            if (group.controllers.full()) {
+                LOG_ERROR("RateGroupScheduler: rate group %" PRIu16 "/%" PRIu16 " is full\n",
+                          divider, phase);
+                return ENOMEM;
+            }
+            group.controllers.push_back(controller);
+            return 0;
+        }
+    }
+
+    if (groups_.full()) {
+        LOG_ERROR("RateGroupScheduler: too many rate groups\n");
+        return ENOMEM;
+    }
+
+    groups_.push_back(RateGroup{divider, phase, {}, {}});
+    groups_.back().controllers.push_back(controller);
+
+    return 0;
+}
+
+int RateGroupScheduler::add_controller(BaseController* controller, uint16_t divider)
+{
+    if (divider < 1) {
+        LOG_ERROR("RateGroupScheduler: divider must be >= 1\n");
+        return EINVAL;
+    }
+
+    const uint32_t window = hyperperiod(divider);
+    uint16_t best_phase = 0;
+    size_t best_peak = SIZE_MAX;
+    size_t best_total = SIZE_MAX;
+
+    for (uint16_t phase = 0; phase < divider; phase++) {
+        size_t peak = 0;
+        size_t total = 0;
+        for (uint32_t cycle = phase; cycle < window; cycle += divider) {
+            const size_t nb = controllers_on_cycle(cycle);
+            peak = (nb > peak) ? nb : peak;
+            total += nb;
+        }
+        if ((peak < best_peak) || ((peak == best_peak) && (total < best_total))) {
+            best_phase = phase;
+            best_peak = peak;
+            best_total = total;
+        }
+    }
+
+    return add_controller(controller, divider, best_phase);
+}
+
+void RateGroupScheduler::execute(ControllersIO& io)
+{
+    for (auto& group : groups_) {
+        if ((cycle_ % group.divider) != group.phase) {
+            continue;
+        }
+
+        DEBUG("RateGroupScheduler: executing rate group %" PRIu16 "/%" PRIu16 "\n",
+              group.divider, group.phase);
+
+        const uint32_t start = cycle_counter::now();
+        for (auto controller : group.controllers) {
+            controller->profiled_execute(io);
+        }
+        group.load.add(cycle_counter::now() - start);
+    }
+
+    cycle_++;
+}
+
+void RateGroupScheduler::reset()
+{
+    for (auto& group : groups_) {
+        for (auto controller : group.controllers) {
+            controller->reset();
+        }
+    }
+}
+
+void RateGroupScheduler::handoff(const ControllersIO& io)
+{
+    for (auto& group : groups_) {
+        for (auto controller : group.controllers) {
+            controller->handoff(io);
+        }
+    }
+}
+
+void RateGroupScheduler::link(ChainLinker& linker) const
+{
+    for (const auto& group : groups_) {
+        for (const auto controller : group.controllers) {
+            linker.link(*controller);
+        }
+    }
+}
+
+void RateGroupScheduler::dump(int indent, bool is_last, const char* prefix, int* counter) const
+{
+    // Print tree branch for this controller
+    if (indent > 0) {
+        printf("%s%s", prefix, is_last ? "└── " : "├── ");
+    }
+
+    // Print type and name (no execution number for scheduler)
+    if (name_.empty()) {
+        printf("%s", type_name());
+    } else {
+        printf("%s: %.*s", type_name(), static_cast<int>(name_.size()), name_.data());
+    }
+    printf(" (worst cycle: %" PRIu32 " ns)\n", cycle_counter::to_ns(worst_cycle_load()));
+
+    etl::string<128> new_prefix;
+    new_prefix.append(prefix);
+    new_prefix.append(is_last ? "    " : "│   ");
+
+    for (size_t i = 0; i < groups_.size(); i++) {
+        const RateGroup& group = groups_[i];
+        const bool last_group = (i == groups_.size() - 1);
+
+        printf("%s%s[every %" PRIu16 " cycles, phase %" PRIu16 "]", new_prefix.c_str(),
+               last_group ? "└── " : "├── ", group.divider, group.phase);
+        if (group.load.count()) {
+            printf(" (min/mean/max: %" PRIu32 "/%" PRIu32 "/%" PRIu32 " ns)",
+                   cycle_counter::to_ns(group.load.min()), cycle_counter::to_ns(group.load.mean()),
+                   cycle_counter::to_ns(group.load.max()));
+        }
+        printf("\n");
+
+        etl::string<128> group_prefix;
+        group_prefix.append(new_prefix.c_str());
+        group_prefix.append(last_group ? "    " : "│   ");
+        for (size_t j = 0; j < group.controllers.size(); j++) {
+            group.controllers[j]->dump(indent + 2, j == group.controllers.size() - 1,
+                                       group_prefix.c_str(), counter);
+        }
+    }
+}
+
+uint32_t RateGroupScheduler::worst_cycle_load() const
+{
+    const uint32_t window = hyperperiod();
+    uint32_t worst = 0;
+
+    for (uint32_t cycle = 0; cycle < window; cycle++) {
+        uint32_t load = 0;
+        for (const auto& group : groups_) {
+            if ((cycle % group.divider) == group.phase) {
+                load += group.load.max();
+            }
+        }
+        worst = (load > worst) ? load : worst;
+    }
+
+    return worst;
+}
+
+void RateGroupScheduler::reset_loads()
+{
+    for (auto& group : groups_) {
+        group.load.reset();
+    }
+}
+
+size_t RateGroupScheduler::controllers_on_cycle(uint32_t cycle) const
+{
+    size_t nb = 0;
+    for (const auto& group : groups_) {
+        if ((cycle % group.divider) == group.phase) {
+            nb += group.controllers.size();
+        }
+    }
+    return nb;
+}
+
+uint32_t RateGroupScheduler::hyperperiod(uint16_t divider) const
+{
+    uint32_t window = divider;
+    for (const auto& group : groups_) {
+        window = window / _gcd(window, group.divider) * group.divider;
+        if (window >= MOTION_CONTROL_RATE_GROUP_WINDOW_MAX) {
+            return MOTION_CONTROL_RATE_GROUP_WINDOW_MAX;
+        }
+    }
+    return window;
+}
+
+} // namespace motion_control
+
+} // namespace cogip
@@ -0,0 +1,348 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Jerk-limited (S-curve) velocity profile implementation
+/// @author     Gilles Doffe <g.doffe@gmail.com>
+
+#include "motion_control_common/SCurveProfile.hpp"
+
+#include <cmath>
+
+#define ENABLE_DEBUG 0
+#include <debug.h>
+
+#include <etl/algorithm.h>
+
+namespace cogip {
+
+namespace motion_control {
+
+/// Bisection iterations to find the peak velocity of short profiles
+constexpr int peak_velocity_iterations = 24;
+
+void SCurveProfile::reset_to_stationary()
+{
+    start_acceleration_ = 0.0f;
+    initial_velocity_ = 0.0f;
+    plateau_velocity_ = 0.0f;
+    target_distance_ = 0.0f;
+    final_velocity_ = 0.0f;
+    direction_ = 1.0f;
+    duration_ = 0.0f;
+    total_periods_ = 0;
+    phases_count_ = 0;
+    initialized_ = true;
+}
+
+void SCurveProfile::compute_velocity_change_durations(float dv, float accel, float jerk,
+                                                      float& jerk_duration, float& accel_duration)
+{
+    if (dv <= 0.0f || accel <= 0.0f || jerk <= 0.0f) {
+        jerk_duration = 0.0f;
+        accel_duration = 0.0f;
+        return;
+    }
+
+    if (dv * jerk >= accel * accel) {
+        // Acceleration limit reached: jerk up, constant acceleration, jerk down
+        jerk_duration = accel / jerk;
+        accel_duration = dv / accel - jerk_duration;
+    } else {
+        // Small velocity change: jerk up then down, acceleration peak below its limit
+        jerk_duration = std::sqrt(dv / jerk);
+        accel_duration = 0.0f;
+    }
+}
+
+float SCurveProfile::compute_velocity_change_duration(float v0, float v1, float accel, float jerk)
+{
+    float jerk_duration = 0.0f;
+    float accel_duration = 0.0f;
+    compute_velocity_change_durations(etl::absolute(v1 - v0), accel, jerk, jerk_duration,
+                                      accel_duration);
+    return 2.0f * jerk_duration + accel_duration;
+}
+
+float SCurveProfile::compute_velocity_change_distance(float v0, float v1, float accel, float jerk)
+{
+    // Acceleration is symmetric around the middle of the change: mean velocity is (v0 + v1) / 2
+    return 0.5f * (v0 + v1) * compute_velocity_change_duration(v0, v1, accel, jerk);
+}
+
+SCurveProfile::State SCurveProfile::state_at(float time) const
+{
+    if (phases_count_ == 0) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+
+    // Find the phase containing time, or use the end of the last one
+    size_t i = 0;
+    while ((i + 1 < phases_count_) && (time >= phases_[i].start + phases_[i].duration)) {
+        i++;
+    }
+    const Phase& phase = phases_[i];
+    const float dt = etl::clamp(time - phase.start, 0.0f, phase.duration);
+
+    return {phase.acceleration + phase.jerk * dt,
+            phase.velocity + phase.acceleration * dt + 0.5f * phase.jerk * dt * dt,
+            phase.distance + phase.velocity * dt + 0.5f * phase.acceleration * dt * dt +
+                phase.jerk * dt * dt * dt / 6.0f};
+}
+
+void SCurveProfile::append_phase(float duration, float jerk)
+{
+    if (duration <= 0.0f || phases_count_ >= max_phases) {
+        return;
+    }
+
+    Phase& phase = phases_[phases_count_];
+    phase.duration = duration;
+    phase.jerk = jerk;
+    if (phases_count_ == 0) {
+        phase.start = 0.0f;
+        phase.acceleration = start_acceleration_;
+        phase.velocity = initial_velocity_ * direction_;
+        phase.distance = 0.0f;
+    } else {
+        const Phase& previous = phases_[phases_count_ - 1];
+        const State state = state_at(previous.start + previous.duration);
+        phase.start = previous.start + previous.duration;
+        phase.acceleration = state.acceleration;
+        phase.velocity = state.velocity;
+        phase.distance = state.distance;
+    }
+    phases_count_++;
+}
+
+void SCurveProfile::append_velocity_change(float v0, float v1, float accel, float jerk)
+{
+    float jerk_duration = 0.0f;
+    float accel_duration = 0.0f;
+    compute_velocity_change_durations(etl::absolute(v1 - v0), accel, jerk, jerk_duration,
+                                      accel_duration);
+
+    const float sign = (v1 >= v0) ? 1.0f : -1.0f;
+    append_phase(jerk_duration, sign * jerk);
+    append_phase(accel_duration, 0.0f);
+    append_phase(jerk_duration, -sign * jerk);
+}
+
+uint32_t SCurveProfile::generate_optimal_profile(float initial_velocity, float target_distance,
+                                                 float acceleration, float deceleration,
+                                                 float max_speed, bool must_stop_at_end,
+                                                 float final_velocity)
+{
+    // Reset state
+    initialized_ = false;
+    phases_count_ = 0;
+    start_acceleration_ = 0.0f;
+
+    // Validate inputs
+    if (etl::absolute(target_distance) < 1e-6f || acceleration <= 0.0f || deceleration <= 0.0f ||
+        max_speed <= 0.0f || jerk_ <= 0.0f) {
+        reset_to_stationary();
+        return 0;
+    }
+
+    initial_velocity_ = initial_velocity;
+    target_distance_ = target_distance;
+
+    // Work in the target direction: distances and velocities are positive towards the target
+    direction_ = (target_distance >= 0.0f) ? 1.0f : -1.0f;
+    const float abs_distance = etl::absolute(target_distance);
+    float v0 = initial_velocity * direction_;
+
+    // Initial acceleration: ramp it down to 0 first, velocity and distance keep changing meanwhile
+    float distance = 0.0f;
+    start_acceleration_ = initial_acceleration_ * direction_;
+    if (etl::absolute(start_acceleration_) > 1e-6f) {
+        const float a0 = start_acceleration_;
+        const float t = etl::absolute(a0) / jerk_;
+        append_phase(t, (a0 > 0.0f) ? -jerk_ : jerk_);
+        distance = v0 * t + a0 * t * t / 3.0f;
+        v0 += 0.5f * a0 * t;
+    }
+
+    // Velocity opposite to target: decelerate to 0 first, moving away from the target
+    if (v0 < 0.0f) {
+        append_velocity_change(v0, 0.0f, deceleration, jerk_);
+        distance += compute_velocity_change_distance(v0, 0.0f, deceleration, jerk_);
+    }
+    const float v_start = etl::max(v0, 0.0f);
+    const float remaining = abs_distance - distance;
+
+    // Final velocity can't exceed the velocity reachable by accelerating over the whole distance
+    float v_end = must_stop_at_end ? etl::clamp(final_velocity, 0.0f, max_speed) : 0.0f;
+    if ((v_end > v_start) &&
+        (compute_velocity_change_distance(v_start, v_end, acceleration, jerk_) > remaining)) {
+        float low = v_start;
+        float high = v_end;
+        for (int i = 0; i < peak_velocity_iterations; i++) {
+            const float middle = 0.5f * (low + high);
+            if (compute_velocity_change_distance(v_start, middle, acceleration, jerk_) >
+                remaining) {
+                high = middle;
+            } else {
+                low = middle;
+            }
+        }
+        v_end = low;
+    }
+
+    // Distance to reach a peak velocity, then slow down to the final velocity if needed
+    auto peak_distance = [&](float v_peak) {
+        float d = compute_velocity_change_distance(
+            v_start, v_peak, (v_peak >= v_start) ? acceleration : deceleration, jerk_);
+        if (must_stop_at_end) {
+            d += compute_velocity_change_distance(v_peak, v_end, deceleration, jerk_);
+        }
+        return d;
+    };
+
+    // Peak velocity can't be lower than the initial or final velocities
+    const float v_low = etl::max(v_start, v_end);
+
+    float v_peak = max_speed;
+    if (peak_distance(max_speed) > remaining) {
+        if (peak_distance(v_low) > remaining) {
+            // Can't stop in time - let PID handle this case, as TrapezoidalProfile does
+            DEBUG("SCurveProfile: cannot stop in time: v0=%.2f, abs_dist=%.2f\n",
+                  static_cast<double>(v0), static_cast<double>(abs_distance));
+            reset_to_stationary();
+            return 0;
+        }
+        if (v_start > max_speed) {
+            // Not enough distance to slow down to max_speed: cruise at initial velocity
+            v_peak = v_start;
+        } else {
+            // Short distance: highest peak velocity fitting in the distance
+            float low = v_low;
+            float high = max_speed;
+            for (int i = 0; i < peak_velocity_iterations; i++) {
+                const float middle = 0.5f * (low + high);
+                if (peak_distance(middle) > remaining) {
+                    high = middle;
+                } else {
+                    low = middle;
+                }
+            }
+            v_peak = low;
+        }
+    }
+
+    // Velocity change to the peak velocity
+    append_velocity_change(v_start, v_peak, (v_peak >= v_start) ? acceleration : deceleration,
+                           jerk_);
+
+    // Plateau covers the distance left
+    const float plateau_distance = etl::max(0.0f, remaining - peak_distance(v_peak));
+    append_phase((v_peak > 1e-6f) ? plateau_distance / v_peak : 0.0f, 0.0f);
+
+    // Final deceleration
+    if (must_stop_at_end) {
+        append_velocity_change(v_peak, v_end, deceleration, jerk_);
+    }
+
+    plateau_velocity_ = v_peak * direction_;
+    final_velocity_ = must_stop_at_end ? v_end * direction_ : plateau_velocity_;
+    const Phase& last = phases_[phases_count_ - 1];
+    duration_ = last.start + last.duration;
+    total_periods_ = static_cast<uint32_t>(std::ceil(duration_));
+
+    DEBUG("SCurveProfile: v0=%.2f, v_peak=%.2f, phases=%u, duration=%.2f\n",
+          static_cast<double>(v0), static_cast<double>(v_peak),
+          static_cast<unsigned>(phases_count_), static_cast<double>(duration_));
+
+    initialized_ = true;
+    return total_periods_;
+}
+
+float SCurveProfile::compute_theoretical_velocity(uint32_t period) const
+{
+    if (!initialized_) {
+        return 0.0f;
+    }
+    return direction_ * state_at(static_cast<float>(period)).velocity;
+}
+
+float SCurveProfile::compute_theoretical_remaining_distance(uint32_t period) const
+{
+    if (!initialized_) {
+        return 0.0f;
+    }
+    return target_distance_ - direction_ * state_at(static_cast<float>(period)).distance;
+}
+
+bool SCurveProfile::phase_at(uint32_t period, uint32_t& end, float& acceleration,
+                             float& jerk) const
+{
+    const float time = static_cast<float>(period);
+
+    for (size_t i = 0; initialized_ && i < phases_count_; i++) {
+        const Phase& phase = phases_[i];
+        if (time < phase.start + phase.duration) {
+            end = static_cast<uint32_t>(std::ceil(phase.start + phase.duration));
+            acceleration = direction_ * (phase.acceleration + phase.jerk * (time - phase.start));
+            jerk = direction_ * phase.jerk;
+            return true;
+        }
+    }
+
+    // After trajectory completion
+    end = UINT32_MAX;
+    acceleration = 0.0f;
+    jerk = 0.0f;
+    return false;
+}
+
+float SCurveProfile::compute_distance_for_duration(float target_speed, float acceleration,
+                                                   float deceleration, float jerk,
+                                                   uint32_t total_periods, bool must_stop_at_end)
+{
+    if (target_speed <= 0.0f || acceleration <= 0.0f || jerk <= 0.0f || total_periods == 0 ||
+        (must_stop_at_end && deceleration <= 0.0f)) {
+        return 0.0f;
+    }
+
+    const float t_periods = static_cast<float>(total_periods);
+
+    // Duration of the velocity changes to reach a peak velocity from rest, and back to rest
+    auto ramps_duration = [&](float v_peak) {
+        float t = compute_velocity_change_duration(0.0f, v_peak, acceleration, jerk);
+        if (must_stop_at_end) {
+            t += compute_velocity_change_duration(v_peak, 0.0f, deceleration, jerk);
+        }
+        return t;
+    };
+
+    // Duration too short to reach target speed: highest peak velocity fitting in the duration
+    float v_peak = target_speed;
+    if (ramps_duration(target_speed) > t_periods) {
+        float low = 0.0f;
+        float high = target_speed;
+        for (int i = 0; i < peak_velocity_iterations; i++) {
+            const float middle = 0.5f * (low + high);
+            if (ramps_duration(middle) > t_periods) {
+                high = middle;
+            } else {
+                low = middle;
+            }
+        }
+        v_peak = low;
+    }
+
+    // Ramps at mean velocity v_peak / 2, plateau for the rest of the duration
+    const float t_ramps = ramps_duration(v_peak);
+    return 0.5f * v_peak * t_ramps + v_peak * (t_periods - t_ramps);
+}
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -87,7 +87,8 @@ float TrapezoidalProfile::compute_triangular_peak_velocity(float distance, float
 
 uint32_t TrapezoidalProfile::generate_optimal_profile(float initial_velocity, float target_distance,
                                                       float acceleration, float deceleration,
-                                                      float max_speed, bool must_stop_at_end)
+                                                      float max_speed, bool must_stop_at_end,
+                                                      float final_velocity)
 {
     // Reset state
     initialized_ = false;
@@ -111,7 +112,7 @@ uint32_t TrapezoidalProfile::generate_optimal_profile(float initial_velocity, fl
     target_distance_ = target_distance;
     acceleration_ = acceleration;
     deceleration_ = deceleration;
-    final_velocity_ = must_stop_at_end ? 0.0f : max_speed;
+    final_velocity_ = must_stop_at_end ? etl::clamp(final_velocity, 0.0f, max_speed) : max_speed;
 
     // Handle direction (negative distance means backward)
     float direction = (target_distance >= 0.0f) ? 1.0f : -1.0f;
@@ -150,6 +151,12 @@ uint32_t TrapezoidalProfile::generate_optimal_profile(float initial_velocity, fl
         v0_for_accel_ = v0_signed;
     }
 
+    // Final velocity can't exceed the velocity reachable by accelerating over the whole distance
+    if (must_stop_at_end && final_velocity_ > 0.0f) {
+        final_velocity_ =
+            etl::min(final_velocity_, std::sqrt(v0 * v0 + 2.0f * acceleration * abs_distance));
+    }
+
     // Calculate distances needed for acceleration and deceleration
     float accel_distance = compute_accel_distance(v0, signed_max_speed, acceleration);
     float decel_distance =
@@ -279,7 +286,7 @@ float TrapezoidalProfile::compute_theoretical_velocity(uint32_t period) const
         phase = "decel";
     } else {
         // After trajectory completion
-        velocity = final_velocity_;
+        velocity = direction * final_velocity_;
         phase = "done";
     }
 
@@ -292,6 +299,41 @@ float TrapezoidalProfile::compute_theoretical_velocity(uint32_t period) const
     return velocity;
 }
 
+bool TrapezoidalProfile::phase_at(uint32_t period, uint32_t& end, float& acceleration,
+                                  float& jerk) const
+{
+    jerk = 0.0f;
+    float direction = (plateau_velocity_ >= 0.0f) ? 1.0f : -1.0f;
+
+    end = reverse_decel_periods_;
+    if (initialized_ && period < end) {
+        // Reverse deceleration phase: towards 0 from initial_velocity (wrong direction)
+        float initial_sign = (initial_velocity_ >= 0.0f) ? 1.0f : -1.0f;
+        acceleration = -initial_sign * deceleration_;
+        return true;
+    }
+    end += accel_periods_;
+    if (initialized_ && period < end) {
+        acceleration = direction * initial_phase_accel_;
+        return true;
+    }
+    end += plateau_periods_;
+    if (initialized_ && period < end) {
+        acceleration = 0.0f;
+        return true;
+    }
+    end += decel_periods_;
+    if (initialized_ && period < end) {
+        acceleration = -direction * deceleration_;
+        return true;
+    }
+
+    // After trajectory completion
+    end = UINT32_MAX;
+    acceleration = 0.0f;
+    return false;
+}
+
 float TrapezoidalProfile::compute_distance_for_duration(float target_speed, float acceleration,
                                                         float deceleration, uint32_t total_periods,
                                                         bool must_stop_at_end)
@@ -14,13 +14,24 @@
 
 // System includes
 #include <cstdio>
+#include <inttypes.h>
 
 // Project includes
+#include "ChainLinker.hpp"
 #include "ControllersIO.hpp"
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+#include "CycleCounter.hpp"
+#include "ExecutionStats.hpp"
+#endif
 #include "etl/string.h"
 #include "etl/string_view.h"
 #include "etl/vector.h"
 
+/// Maximum number of controllers with execution time statistics
+#ifndef MOTION_CONTROL_PROFILED_CONTROLLERS_MAX
+#define MOTION_CONTROL_PROFILED_CONTROLLERS_MAX 48
+#endif
+
 namespace cogip {
 
 namespace motion_control {
@@ -43,11 +54,53 @@ class BaseController
     /// @param io Controllers input/output datas shared accross controllers
     virtual void execute(ControllersIO& io) = 0;
 
+    /// Execute the controller from its meta controller or engine.
+    /// With the motion_control_profiling module, the execution time is
+    /// measured and aggregated in execution_stats().
+    /// @param io Controllers input/output datas shared accross controllers
+    void profiled_execute(ControllersIO& io)
+    {
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+        const uint32_t start = cycle_counter::now();
+        execute(io);
+        const uint32_t elapsed = cycle_counter::now() - start;
+
+        if (!profiled_) {
+            register_profiled(this);
+            profiled_ = true;
+        }
+        stats_.add(elapsed);
+#else
+        execute(io);
+#endif
+    }
+
+    /// Declare the IO keys read and written by this controller
+    /// Called once by the engine when the chain is set (link phase), never
+    /// from the periodic loop. Meta controllers link their sub-controllers.
+    /// @param linker Chain linker validating the dataflow
+    virtual void link(ChainLinker& linker) const
+    {
+        (void)linker;
+    }
+
     /// Reset controller internal state
     /// Called when changing target to reinitialize all internal states.
     /// Default implementation does nothing - override in controllers with internal state.
     virtual void reset() {}
 
+    /// Take over from the chain previously executed by the engine
+    /// Called by the engine on the cycle the controller chain is switched,
+    /// before its first execution. The IO still holds the values written by
+    /// the previous chain, so controllers with internal state can seed it
+    /// from them (current speed order, speed command) to avoid a bump.
+    /// Default implementation does nothing - override in controllers with internal state.
+    /// @param io Controllers input/output datas shared accross controllers
+    virtual void handoff(const ControllersIO& io)
+    {
+        (void)io;
+    }
+
     /// Get the type name of this controller (class name)
     /// @return Type name string
     virtual const char* type_name() const
@@ -90,12 +143,39 @@ class BaseController
 
         // Print type and name
         if (name_.empty()) {
-            printf("%s\n", type_name());
+            printf("%s", type_name());
         } else {
-            printf("%s: %.*s\n", type_name(), static_cast<int>(name_.size()), name_.data());
+            printf("%s: %.*s", type_name(), static_cast<int>(name_.size()), name_.data());
         }
+        dump_execution_stats();
+        printf("\n");
+    }
+
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+    /// Get execution time statistics
+    const ExecutionStats& execution_stats() const
+    {
+        return stats_;
+    }
+
+    /// Forget execution time statistics
+    void reset_execution_stats()
+    {
+        stats_.reset();
     }
 
+    /// Number of controllers executed at least once with profiling
+    static size_t profiled_controllers_count();
+
+    /// Get a controller executed at least once with profiling
+    /// @param index Index in registration order
+    /// @return The controller, nullptr if index is out of range
+    static const BaseController* profiled_controller(size_t index);
+
+    /// Forget execution time statistics of all profiled controllers
+    static void reset_profiled_execution_stats();
+#endif
+
     /// Get meta controller to which current controller belongs to
     /// return Meta controller
     BaseMetaController* meta() const
@@ -109,11 +189,35 @@ class BaseController
     );
 
   protected:
+    /// Print execution time statistics for dump(), if available
+    void dump_execution_stats() const
+    {
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+        if (stats_.count()) {
+            printf(" (min/mean/max: %" PRIu32 "/%" PRIu32 "/%" PRIu32 " ns)",
+                   cycle_counter::to_ns(stats_.min()), cycle_counter::to_ns(stats_.mean()),
+                   cycle_counter::to_ns(stats_.max()));
+        }
+#endif
+    }
+
     /// Meta controller to which current controller belongs to
     BaseMetaController* meta_;
 
     /// Instance name for identification
     etl::string_view name_;
+
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+  private:
+    /// Add a controller to the profiled controllers registry
+    static void register_profiled(BaseController* controller);
+
+    /// Execution time statistics
+    ExecutionStats stats_;
+
+    /// Registered in the profiled controllers registry
+    bool profiled_ = false;
+#endif
 };
 
 } // namespace motion_control
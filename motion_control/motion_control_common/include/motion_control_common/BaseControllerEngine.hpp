@@ -14,6 +14,10 @@
 
 #include "Controller.hpp"
 #include "ControllersIO.hpp"
+#include "CycleRecorder.hpp"
+#include "OutputsSnapshot.hpp"
+#include "SeqLock.hpp"
+#include "etl/vector.h"
 #include "thread/thread.hpp"
 
 // RIOT includes
@@ -31,10 +35,48 @@ class BaseControllerEngine
     /// Constructor
     BaseControllerEngine(uint32_t engine_thread_period_ms);
 
-    /// Set the controller to launch.
+    /// Set the controller to launch. The controllers chain is linked against
+    /// the engine inputs to validate its dataflow.
     void set_controller(BaseController* controller ///< [in]   controller
     );
 
+    /// Stage the controller to launch, swapped in by the engine thread at the
+    /// next cycle boundary. The controllers chain is linked by the caller, out
+    /// of the engine loop. On the swap cycle, the new chain takes over the
+    /// state of the previous one (see BaseController::handoff()) before its
+    /// first execution, so that the motors commands do not bump. The timeout
+    /// enable flag is applied on the same cycle, so that the running chain
+    /// keeps its own until then.
+    void stage_controller(BaseController* controller, ///< [in]   controller
+                          bool timeout_enable = false ///< [in]   timeout enable flag of the chain
+    );
+
+    /// Link a controllers chain against the engine inputs. Chains staged later
+    /// can be linked at init, so that all their keys are registered at boot.
+    /// Halts if the keys registry is full.
+    /// return number of keys read by the chain without upstream writer
+    size_t link(const BaseController* controller ///< [in]   controllers chain
+    ) const;
+
+    /// Return whether a staged controller waits for the next cycle
+    bool switch_pending() const
+    {
+        mutex_lock(&mutex_);
+        const bool pending = (staged_controller_ != nullptr);
+        mutex_unlock(&mutex_);
+        return pending;
+    };
+
+    /// Return the latency of the last controller switch, from the
+    /// stage_controller() call to the end of the handoff, in nanoseconds
+    uint32_t last_switch_latency_ns() const;
+
+    /// Return the number of controller switches
+    uint32_t switches_count() const
+    {
+        return switches_count_;
+    };
+
     /// Start controller main thread, launching the thread loop.
     void start_thread();
 
@@ -57,6 +99,21 @@ class BaseControllerEngine
         mutex_unlock(&mutex_);
     };
 
+    /// Hold the engine loop between two cycles, so that data read by the
+    /// controllers chain can be updated from another thread while the chain
+    /// keeps running. Must be released with unlock(), without calling any
+    /// other locking engine method in between.
+    void lock()
+    {
+        mutex_lock(&mutex_);
+    };
+
+    /// Release the engine loop held by lock()
+    void unlock()
+    {
+        mutex_unlock(&mutex_);
+    };
+
     /// Return whether the engine is enabled
     bool is_enabled() const
     {
@@ -86,6 +143,7 @@ class BaseControllerEngine
     void set_brake_controller(BaseController* brake_controller)
     {
         brake_controller_ = brake_controller;
+        link(brake_controller_);
     };
 
     /// Get controller
@@ -164,19 +222,47 @@ class BaseControllerEngine
         }
     };
 
-    /// Get ControllersIO reference
+    /// Get ControllersIO reference.
+    /// Only safe from the engine thread, other threads must use outputs().
     const ControllersIO& io() const
     {
         return io_;
     };
 
-    /// Dump the controller pipeline hierarchy to stdout as ASCII tree
+    /// Publish an IO key in the outputs snapshot, updated on each cycle once
+    /// the controllers chain has been executed. Must be called before
+    /// start_thread().
+    /// return 0 on success, ENOMEM if too many keys are published
+    int publish_output(const IOKey& key ///< [in]   key to publish
+    );
+
+    /// Copy the outputs published on the last cycle, without locking the
+    /// engine. Safe from any thread.
+    /// return number of published snapshots so far
+    uint32_t outputs(OutputsSnapshot& snapshot ///< [out]  last published outputs
+    ) const
+    {
+        return outputs_.read(snapshot);
+    };
+
+    /// Record each enabled cycle IO in a recorder, or stop recording if
+    /// recorder is null. Detach the recorder before exporting its records.
+    void set_recorder(CycleRecorder* recorder ///< [in]   recorder, may be null
+    );
+
+    /// Dump the controller pipeline hierarchy to stdout as ASCII tree.
+    /// A staged controller is dumped instead of the running one.
     void dump_pipeline() const
     {
-        printf("Pipeline:\n");
-        if (controller_) {
+        mutex_lock(&mutex_);
+        const bool staged = (staged_controller_ != nullptr);
+        BaseController* controller = staged ? staged_controller_ : controller_;
+        mutex_unlock(&mutex_);
+
+        printf("Pipeline%s:\n", staged ? " (staged)" : "");
+        if (controller) {
             int counter = 0;
-            controller_->dump(1, true, "", &counter);
+            controller->dump(1, true, "", &counter);
         } else {
             printf("  (no controller set)\n");
         }
@@ -189,6 +275,21 @@ class BaseControllerEngine
     /// Process controller output for platform restitution.
     virtual void process_outputs() = 0;
 
+    /// Declare the keys written by the engine before the controllers chain
+    /// runs, for the link phase.
+    virtual void link_inputs(ChainLinker& linker ///< [in]   chain linker
+    ) const;
+
+    /// Publish the values of the published keys for other threads.
+    void publish_outputs();
+
+    /// Swap in the staged controller, handing off the previous chain state.
+    /// Called by the engine thread at the beginning of a cycle.
+    void switch_controller();
+
+    /// Record the cycle inputs, once prepared.
+    void record_inputs();
+
     /// Enable thread loop flag
     bool enable_;
 
@@ -196,6 +297,24 @@ class BaseControllerEngine
     /// leading to the execution of a chain of controllers.
     BaseController* controller_;
 
+    /// Controller waiting to replace controller_ at the next cycle boundary
+    BaseController* staged_controller_;
+
+    /// Timeout enable flag applied with staged_controller_
+    bool staged_timeout_enable_;
+
+    /// Cycle counter value when staged_controller_ was staged
+    uint32_t staged_at_;
+
+    /// Latency of the last controller switch, in cycle counter ticks
+    uint32_t last_switch_latency_;
+
+    /// Number of controller switches
+    uint32_t switches_count_;
+
+    /// Controller switched since the last recorded cycle
+    bool unrecorded_switch_;
+
     /// Current motion control cycle
     uint32_t current_cycle_;
 
@@ -219,7 +338,7 @@ class BaseControllerEngine
     uint32_t engine_thread_period_ms_;
 
     /// Mutex protecting engine loop
-    mutex_t mutex_;
+    mutable mutex_t mutex_;
 
     /// Controllers input/output datas shared accross controllers
     ControllersIO io_;
@@ -231,6 +350,18 @@ class BaseControllerEngine
 
     /// Controller chain executed while brake_ is latched.
     BaseController* brake_controller_;
+
+    /// Recorder of the cycles IO, null if not recording
+    CycleRecorder* recorder_;
+
+    /// Keys published in the outputs snapshot
+    etl::vector<IOKey, MAX_PUBLISHED_OUTPUTS> published_keys_;
+
+    /// Outputs snapshot, written by the engine thread only
+    utils::SeqLock<OutputsSnapshot> outputs_;
+
+    /// Snapshot being captured, kept out of the engine thread stack
+    OutputsSnapshot capture_;
 };
 
 } // namespace motion_control
@@ -0,0 +1,108 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Controllers chain link phase
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+
+#include "ControllersIO.hpp"
+#include "IOKey.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+// Forward declaration
+class BaseController;
+
+/// @class ChainLinker
+/// @brief Validates the dataflow of a controllers chain once, when it is set
+///        on an engine.
+/// @details
+///     The engine first declares the keys it provides in prepare_inputs(),
+///     then walks the controllers tree in execution order. Each controller
+///     declares the keys it reads and writes from its link() method.
+///     Every mandatory read must have been provided by the engine or written
+///     by an upstream controller, otherwise a warning is logged once, here,
+///     instead of on every cycle.
+///
+///     All declared keys are resolved into their ControllersIO slots, so no
+///     key registration happens on the periodic path. Keys that cannot be
+///     registered, the registry being full, are counted as overflows.
+class ChainLinker
+{
+  public:
+    /// @brief Link a controller: declare its IOs, and those of its
+    ///        sub-controllers for meta controllers.
+    /// @param controller Controller to link
+    void link(const BaseController& controller);
+
+    /// @brief Declare a key written by the engine before the chain runs.
+    /// @param key The provided key, ignored if empty.
+    void provides(const IOKey& key);
+
+    /// @brief Declare a key read by the controller being linked.
+    ///        It must be written upstream.
+    /// @param key The read key, ignored if empty.
+    void reads(const IOKey& key);
+
+    /// @brief Declare a key read by the controller being linked if available,
+    ///        the controller having a fallback value.
+    /// @param key The read key, ignored if empty.
+    void reads_optional(const IOKey& key);
+
+    /// @brief Declare a key written by the controller being linked.
+    /// @param key The written key, ignored if empty.
+    void writes(const IOKey& key);
+
+    /// @brief Keys available at the current point of the chain.
+    const ParamMask& available() const
+    {
+        return available_;
+    }
+
+    /// @brief Replace the keys available at the current point of the chain,
+    ///        used by meta controllers to merge alternative branches.
+    /// @param available Keys to consider as written
+    void set_available(const ParamMask& available)
+    {
+        available_ = available;
+    }
+
+    /// @brief Number of mandatory reads without upstream writer.
+    size_t unresolved() const
+    {
+        return unresolved_;
+    }
+
+    /// @brief Number of declared keys rejected by a full keys registry.
+    size_t overflows() const
+    {
+        return overflows_;
+    }
+
+  private:
+    /// @brief Resolve a declared key, counting registry overflows.
+    /// @param key The declared key.
+    /// @return The slot of the key, or INVALID_PARAM_SLOT if the registry is full.
+    ParamSlot resolve(const IOKey& key);
+
+    const BaseController* current_ = nullptr; ///< Controller being linked
+    ParamMask available_;                     ///< Keys written so far
+    size_t unresolved_ = 0;                   ///< Reads without upstream writer
+    size_t overflows_ = 0;                    ///< Keys rejected by a full registry
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
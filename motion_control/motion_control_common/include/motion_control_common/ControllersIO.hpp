@@ -11,17 +11,17 @@
 
 #pragma once
 
+#include "IOKey.hpp"
+#include "SlotMask.hpp"
 #include "log.h"
 #include <cerrno>
+#include <etl/array.h>
 #include <etl/hash.h>
 #include <etl/optional.h>
-#include <etl/set.h>
 #include <etl/string.h>
 #include <etl/string_view.h>
 #include <etl/type_traits.h>
-#include <etl/unordered_map.h>
 #include <etl/variant.h>
-#include <etl/vector.h>
 
 namespace cogip {
 
@@ -36,30 +36,59 @@ namespace motion_control {
 typedef enum { moving = 0, reached, intermediate_reached, blocked, timeout } target_pose_status_t;
 
 /// @brief Maximum number of parameters that can be stored.
-/// @note Used as ETL template parameter for the underlying unordered_map.
-constexpr size_t MAX_PARAMS = 48;
+/// @note Size of the process-wide key registry and of each ControllersIO storage.
+///       Slots are never freed: it must hold the keys of every chain linked in
+///       the process, whatever the engine. A full registry halts at link time.
+constexpr size_t MAX_PARAMS = 128;
 
+/// @brief Maximum number of double parameters stored at the same time.
+/// @note Doubles are rare and kept in a small side table.
+constexpr size_t MAX_DOUBLE_PARAMS = 4;
+
+/// @brief Maximum number of string parameters stored at the same time.
+/// @note Strings are rare and kept in a small side table.
+constexpr size_t MAX_STRING_PARAMS = 2;
+
+/// @brief String type for string parameters.
+using ParamString = etl::string<32>;
 /// @brief Variant type that can hold any supported parameter value.
-using ParamValue = etl::variant<float, double, int, bool, etl::string<32>>;
+using ParamValue = etl::variant<float, double, int, bool, ParamString>;
 /// @brief Hashed key type for lookup.
 using ParamKey = size_t;
 /// @brief String key type for parameter names.
 using KeyType = etl::string_view;
-/// @brief Vector of ParamKeys with maximum size.
-using ParamKeyVector = etl::vector<ParamKey, MAX_PARAMS>;
+/// @brief Set of ControllersIO slots, one bit per slot.
+using ParamMask = SlotMask<MAX_PARAMS>;
 /// @brief Optional of ParamValue for return of get().
 using OptionalValue = etl::optional<ParamValue>;
-/// @brief Maximum number of keys that can be marked read-only.
-constexpr size_t MAX_READONLY = 16;
+static_assert(MAX_PARAMS < INVALID_PARAM_SLOT, "ParamSlot too narrow for MAX_PARAMS");
+
+/// @brief Type of the value currently held by a ControllersIO slot.
+enum class ParamType : uint8_t {
+    none = 0,     ///< No value stored
+    float_value,  ///< float value
+    double_value, ///< double value (side table)
+    int_value,    ///< int value (also used for enums)
+    bool_value,   ///< bool value
+    string_value  ///< ParamString value (side table)
+};
 
 /// @class ControllersIO
 /// @brief Central storage for parameters shared across chained controllers.
 /// @details
-///     - Uses FNV-1a 32-bit hash of string keys (`etl::fnv_1a_32`) for lookup.
+///     - Keys are IOKey handles: the FNV-1a 32-bit hash is computed at compile
+///       time and each key is resolved once into a storage slot, shared by all
+///       ControllersIO instances. Values are then accessed by index.
+///     - Keys given as plain strings are converted to a temporary IOKey and
+///       resolved through the key registry on each call: keep this for non
+///       periodic accesses only.
+///     - Values are stored by type (structure of arrays): dense float, int and
+///       bool arrays indexed by slot, a type tag per slot, and small side tables
+///       for the rare double and string values.
 ///     - Allows marking keys read-only (further sets return EACCES).
-///     - Tracks “dirty” keys on each call to `set()`. You can clear or take
-///     those dirty keys
-///       to see exactly which parameters were modified since the last snapshot.
+///     - Tracks “dirty” keys on each call to `set()` in a bitmask over slots.
+///       You can clear or take those dirty keys to see exactly which
+///       parameters were modified since the last snapshot.
 class ControllersIO
 {
   public:
@@ -68,41 +97,79 @@ class ControllersIO
     /// @return The 32-bit hash as ParamKey.
     static ParamKey hash_key(KeyType key);
 
+    /// @brief Resolve a key into its storage slot, registering it if needed.
+    /// @details The slot is cached into the key, so this is a single load once
+    ///          the key has been resolved.
+    /// @param key The parameter key.
+    /// @return The slot of the key, or INVALID_PARAM_SLOT if the registry is full.
+    static ParamSlot resolve(const IOKey& key)
+    {
+        if (key.slot_ != INVALID_PARAM_SLOT) {
+            return key.slot_;
+        }
+        return register_key(key, true);
+    }
+
+    /// @brief Name of the key registered at a given slot.
+    /// @param slot Storage slot.
+    /// @return The key name, empty if the slot is not registered.
+    static KeyType key_name(ParamSlot slot);
+
+    /// @brief Number of keys registered so far (all instances).
+    static size_t registered_keys();
+
+    /// @brief Slot of a registered key, from its hash.
+    /// @param hash FNV-1a 32-bit hash of the key name.
+    /// @return The slot, or INVALID_PARAM_SLOT if no registered key has this hash.
+    static ParamSlot registered_slot(ParamKey hash);
+
     /// @brief Set or update a parameter value.
-    /// @param key   The parameter name.
+    /// @param key   The parameter key.
     /// @param value The value to store.
-    /// @return 0 on success; EACCES if the key is read-only.
+    /// @return 0 on success; EACCES if the key is read-only; ENOMEM if storage is full.
     /// @note If the key is marked read-only, the write is ignored and EACCES is
     /// returned.
-    int set(KeyType key, const ParamValue& value);
+    int set(const IOKey& key, const ParamValue& value);
 
     /// @brief Template overload to set values with automatic type conversion.
     /// @tparam T Type of the value (enum or basic type).
     /// @param key   The parameter name.
     /// @param value The value to store.
-    /// @return 0 on success; EACCES if the key is read-only.
+    /// @return 0 on success; EACCES if the key is read-only; ENOMEM if storage is full.
     /// @note Enums are stored as int (weak typing). Use get_as<int>() and cast manually.
-    template <typename T> int set(KeyType key, const T& value)
+    template <typename T> int set(const IOKey& key, const T& value)
     {
         if constexpr (etl::is_enum_v<T>) {
-            return set(key, ParamValue(static_cast<int>(value)));
+            return set(key, static_cast<int>(value));
+        } else if constexpr (is_stored_type<T>()) {
+            ParamSlot slot = INVALID_PARAM_SLOT;
+            int ret = writable_slot(key, slot);
+            if (ret) {
+                return ret;
+            }
+            ret = store(slot, value);
+            if (ret) {
+                return ret;
+            }
+            modified_.set(slot);
+            return 0;
         } else {
             return set(key, ParamValue(value));
         }
     }
 
     /// @brief Mark a parameter key as read-only.
-    /// @param key The parameter name to protect.
-    void mark_readonly(KeyType key);
+    /// @param key The parameter key to protect.
+    void mark_readonly(const IOKey& key);
 
     /// @brief Reset all read-only marks
     void reset_readonly_markers();
 
     /// @brief Retrieve the raw variant value for a key.
-    /// @param key The parameter name.
+    /// @param key The parameter key.
     /// @return An optional containing the `ParamValue` if found, or empty
     /// otherwise.
-    OptionalValue get(KeyType key) const;
+    OptionalValue get(const IOKey& key) const;
 
     /// @brief Retrieve a typed value for a key.
     /// @tparam T The expected type (must match one of the types in `ParamValue`).
@@ -110,66 +177,231 @@ class ControllersIO
     /// @return An optional containing the value cast to `T` if present and
     /// type-matched; empty otherwise.
     /// @note Enums are stored as int, so get_as<EnumType>() will retrieve int and cast to enum.
-    template <typename T> etl::optional<T> get_as(KeyType key) const
+    template <typename T> etl::optional<T> get_as(const IOKey& key) const
     {
+        const ParamSlot slot = find(key);
+        if (slot == INVALID_PARAM_SLOT) {
+            return {};
+        }
         if constexpr (etl::is_enum_v<T>) {
             // Enums are stored as int, retrieve as int and cast to enum
-            if (auto opt = get(key)) {
-                if (etl::holds_alternative<int>(*opt)) {
-                    return static_cast<T>(etl::get<int>(*opt));
-                } else {
-                    LOG_ERROR("Error getting %.*s (expected int for enum)\n",
-                              static_cast<int>(key.size()), key.data());
-                }
+            if (types_[slot] == ParamType::int_value) {
+                return static_cast<T>(ints_[slot]);
             }
-            return {};
+            LOG_ERROR("Error getting %.*s (expected int for enum)\n",
+                      static_cast<int>(key.size()), key.data());
         } else {
-            if (auto opt = get(key)) {
-                if (etl::holds_alternative<T>(*opt)) {
-                    return etl::get<T>(*opt);
-                } else {
-                    LOG_ERROR("Error getting %.*s\n", static_cast<int>(key.size()), key.data());
-                }
+            static_assert(is_stored_type<T>(), "Unsupported ControllersIO value type");
+            if (types_[slot] == param_type<T>()) {
+                return load<T>(slot);
             }
-            return {};
+            LOG_ERROR("Error getting %.*s\n", static_cast<int>(key.size()), key.data());
         }
+        return {};
     }
 
+    /// @brief Type of the value currently stored for a key.
+    /// @param key The parameter key.
+    /// @return The value type, ParamType::none if the key was never set.
+    ParamType type_of(const IOKey& key) const
+    {
+        const ParamSlot slot = find(key);
+        return (slot == INVALID_PARAM_SLOT) ? ParamType::none : types_[slot];
+    }
+
+    /// @name Raw slot accesses, for recording and replay.
+    /// Only float, int (and enums) and bool values are handled, as their value
+    /// fits in 32 bits: the bits are copied as is, so comparisons are exact.
+    ///@{
+    /// @brief Read the value of a slot.
+    /// @param slot Storage slot.
+    /// @param type Type of the value.
+    /// @param bits Bits of the value.
+    /// @return true if the slot holds a float, int or bool value.
+    bool read_slot(ParamSlot slot, ParamType& type, uint32_t& bits) const;
+
+    /// @brief Write the value of a slot, ignoring read-only marks.
+    /// @param slot Storage slot.
+    /// @param type Type of the value: float, int or bool.
+    /// @param bits Bits of the value.
+    /// @return 0 on success; EINVAL on invalid slot or type.
+    int write_slot(ParamSlot slot, ParamType type, uint32_t bits);
+    ///@}
+
     /// @brief Once you have run some controllers, you can call
     /// `snapshot_modified()` to get
     ///        all keys that were written since the last snapshot. Then call
     ///        `clear_modified()` to reset the “dirty” set.
     ///@{
-    /// @brief Returns a vector of all ParamKeys that have been written since the
+    /// @brief Returns the set of slots that have been written since the
     /// last `clear_modified()`.
-    ParamKeyVector snapshot_modified() const;
+    const ParamMask& snapshot_modified() const
+    {
+        return modified_;
+    }
 
     /// @brief Find which keys in `new_keys` also appear in `already_written`.
-    /// @param new_keys         Vector of keys newly written by one controller
-    /// subtree.
-    /// @param already_written  Set of keys written so far by earlier siblings.
-    /// @return A vector of ParamKey that appear in both.
-    static ParamKeyVector find_collisions(const ParamKeyVector& new_keys,
-                                          const etl::set<ParamKey, MAX_PARAMS>& already_written);
-
-    /// @brief Compute the set‐difference “after \ before” for two lists of keys.
-    /// @param before_ctrl All keys present before running a subtree.
-    /// @param after_ctrl  All keys present after running that subtree.
-    /// @return A vector containing keys in `after_ctrl` but not in `before_ctrl`.
-    static ParamKeyVector difference(const ParamKeyVector& after_ctrl,
-                                     const ParamKeyVector& before_ctrl);
+    /// @param new_keys         Slots newly written by one controller subtree.
+    /// @param already_written  Slots written so far by earlier siblings.
+    /// @return The slots that appear in both.
+    static ParamMask find_collisions(const ParamMask& new_keys, const ParamMask& already_written)
+    {
+        return new_keys & already_written;
+    }
+
+    /// @brief Compute the set‐difference “after \ before” for two sets of keys.
+    /// @param before_ctrl All slots present before running a subtree.
+    /// @param after_ctrl  All slots present after running that subtree.
+    /// @return The slots in `after_ctrl` but not in `before_ctrl`.
+    static ParamMask difference(const ParamMask& after_ctrl, const ParamMask& before_ctrl)
+    {
+        return after_ctrl.without(before_ctrl);
+    }
 
     /// @brief Clears the internal “dirty” set, so subsequent sets will be newly
     /// recorded.
-    void clear_modified();
+    void clear_modified()
+    {
+        modified_.clear();
+    }
+
+    /// @brief Replace the internal “dirty” set, e.g. to restore it after
+    /// isolating the keys written by a subtree.
+    /// @param modified Slots to mark as written.
+    void restore_modified(const ParamMask& modified)
+    {
+        modified_ = modified;
+    }
     ///@}
 
   private:
-    etl::unordered_map<ParamKey, ParamValue, MAX_PARAMS> data_; ///< Underlying storage map
-    etl::set<ParamKey, MAX_READONLY> readonly_keys_;            ///< Set of protected keys
+    /// @brief Side table entry for a double value.
+    struct DoubleEntry
+    {
+        ParamSlot slot = INVALID_PARAM_SLOT; ///< Owner slot
+        double value = 0;                    ///< Stored value
+    };
+
+    /// @brief Side table entry for a string value.
+    struct StringEntry
+    {
+        ParamSlot slot = INVALID_PARAM_SLOT; ///< Owner slot
+        ParamString value;                   ///< Stored value
+    };
+
+    /// @brief Type tag matching a stored C++ type.
+    template <typename T> static constexpr ParamType param_type()
+    {
+        if constexpr (etl::is_same_v<T, float>) {
+            return ParamType::float_value;
+        } else if constexpr (etl::is_same_v<T, double>) {
+            return ParamType::double_value;
+        } else if constexpr (etl::is_same_v<T, int>) {
+            return ParamType::int_value;
+        } else if constexpr (etl::is_same_v<T, bool>) {
+            return ParamType::bool_value;
+        } else if constexpr (etl::is_same_v<T, ParamString>) {
+            return ParamType::string_value;
+        } else {
+            return ParamType::none;
+        }
+    }
+
+    /// @brief Return true if T is stored natively, without variant conversion.
+    template <typename T> static constexpr bool is_stored_type()
+    {
+        return param_type<T>() != ParamType::none;
+    }
+
+    /// @brief Look up a key in the registry, adding it if requested.
+    /// @param key    The parameter key, its slot is cached on success.
+    /// @param create Register the key if unknown.
+    /// @return The slot of the key, or INVALID_PARAM_SLOT.
+    static ParamSlot register_key(const IOKey& key, bool create);
+
+    /// @brief Get the slot of a key holding a value, without registering it.
+    /// @param key The parameter key.
+    /// @return The slot, INVALID_PARAM_SLOT if the key was never set.
+    ParamSlot find(const IOKey& key) const
+    {
+        ParamSlot slot = key.slot_;
+        if (slot == INVALID_PARAM_SLOT) {
+            slot = register_key(key, false);
+            if (slot == INVALID_PARAM_SLOT) {
+                return INVALID_PARAM_SLOT;
+            }
+        }
+        return (types_[slot] != ParamType::none) ? slot : INVALID_PARAM_SLOT;
+    }
+
+    /// @brief Resolve the slot of a key about to be written.
+    /// @param key  The parameter key.
+    /// @param slot Resolved slot.
+    /// @return 0 on success; EACCES if the key is read-only; ENOMEM if storage is full.
+    int writable_slot(const IOKey& key, ParamSlot& slot);
+
+    /// @name Typed stores, the slot type tag is updated accordingly.
+    /// @return 0 on success; ENOMEM if a side table is full.
+    ///@{
+    int store(ParamSlot slot, float value)
+    {
+        floats_[slot] = value;
+        types_[slot] = ParamType::float_value;
+        return 0;
+    }
+    int store(ParamSlot slot, int value)
+    {
+        ints_[slot] = value;
+        types_[slot] = ParamType::int_value;
+        return 0;
+    }
+    int store(ParamSlot slot, bool value)
+    {
+        bools_[slot] = value;
+        types_[slot] = ParamType::bool_value;
+        return 0;
+    }
+    int store(ParamSlot slot, double value);
+    int store(ParamSlot slot, const ParamString& value);
+    ///@}
+
+    /// @brief Typed load from a slot whose type tag matches T.
+    template <typename T> T load(ParamSlot slot) const
+    {
+        if constexpr (etl::is_same_v<T, float>) {
+            return floats_[slot];
+        } else if constexpr (etl::is_same_v<T, int>) {
+            return ints_[slot];
+        } else if constexpr (etl::is_same_v<T, bool>) {
+            return bools_[slot];
+        } else if constexpr (etl::is_same_v<T, double>) {
+            return doubles_[side_index(doubles_, slot)].value;
+        } else {
+            return strings_[side_index(strings_, slot)].value;
+        }
+    }
+
+    /// @brief Index of the side table entry owned by a slot.
+    /// @return The entry index, or the table size if the slot owns no entry.
+    template <typename Table> static size_t side_index(const Table& table, ParamSlot slot)
+    {
+        size_t i = 0;
+        while ((i < table.size()) && (table[i].slot != slot)) {
+            i++;
+        }
+        return i;
+    }
+
+    etl::array<ParamType, MAX_PARAMS> types_{}; ///< Type of the value held by each slot
+    etl::array<float, MAX_PARAMS> floats_{};    ///< float values, indexed by slot
+    etl::array<int, MAX_PARAMS> ints_{};        ///< int and enum values, indexed by slot
+    etl::array<bool, MAX_PARAMS> bools_{};      ///< bool values, indexed by slot
+
+    etl::array<DoubleEntry, MAX_DOUBLE_PARAMS> doubles_{}; ///< double side table
+    etl::array<StringEntry, MAX_STRING_PARAMS> strings_{}; ///< string side table
 
-    /// @brief Tracks which keys have been written by calls to `set(...)`
-    etl::set<ParamKey, MAX_PARAMS> _modified_keys;
+    ParamMask readonly_; ///< Slots protected against writes
+    ParamMask modified_; ///< Slots written by calls to `set(...)` since `clear_modified()`
 };
 
 } // namespace motion_control
@@ -0,0 +1,81 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      High resolution counter for execution time measurement
+/// @details    Uses the DWT cycle counter on Cortex-M cores providing it,
+///             the monotonic clock on native, and the microsecond ztimer
+///             otherwise.
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+#ifdef BOARD_NATIVE
+#include <time.h>
+#else
+#include "cpu.h"
+#include "periph_conf.h"
+#include <ztimer.h>
+#endif
+
+namespace cogip {
+
+namespace motion_control {
+
+namespace cycle_counter {
+
+/// @brief Enable the counter. Must be called once before now().
+inline void init()
+{
+#if !defined(BOARD_NATIVE) && defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/// @brief Current counter value, in ticks. Differences of two values are
+///        valid across counter wrap-around.
+inline uint32_t now()
+{
+#ifdef BOARD_NATIVE
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint32_t>(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#elif defined(DWT_CTRL_CYCCNTENA_Msk)
+    return DWT->CYCCNT;
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+/// @brief Convert a number of ticks to nanoseconds.
+/// @param ticks Number of ticks
+/// @return Duration in nanoseconds, saturated to UINT32_MAX
+inline uint32_t to_ns(uint32_t ticks)
+{
+#ifdef BOARD_NATIVE
+    return ticks;
+#else
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    const uint64_t ns = (static_cast<uint64_t>(ticks) * 1000000000ULL) / CLOCK_CORECLOCK;
+#else
+    const uint64_t ns = static_cast<uint64_t>(ticks) * 1000ULL;
+#endif
+    return (ns > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(ns);
+#endif
+}
+
+} // namespace cycle_counter
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
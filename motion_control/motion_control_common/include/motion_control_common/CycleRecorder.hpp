@@ -0,0 +1,163 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Per-cycle ControllersIO recorder
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+
+// ETL includes
+#include "etl/array.h"
+
+// Project includes
+#include "ControllersIO.hpp"
+
+/// Record a full IO state every N records, replay starts on such a record
+#ifndef MOTION_CONTROL_RECORDER_KEYFRAME_INTERVAL
+#define MOTION_CONTROL_RECORDER_KEYFRAME_INTERVAL 100
+#endif
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Flags of a cycle record
+enum CycleRecordFlags : uint8_t {
+    cycle_record_keyframe = 0x01, ///< Inputs hold the whole IO state
+    cycle_record_braking = 0x02,  ///< Brake chain executed instead of the controller
+    cycle_record_switched = 0x04, ///< Controller switched since the previous record
+};
+
+/// @brief Magic number starting an exported recording ("MCRC")
+constexpr uint32_t CYCLE_RECORDING_MAGIC = 0x4352434d;
+
+/// @brief Version of the exported recording format
+constexpr uint8_t CYCLE_RECORDING_VERSION = 1;
+
+/// @brief Size of a recorded value: slot, type and 32-bit value
+constexpr size_t CYCLE_RECORD_ENTRY_SIZE = 6;
+
+/// @brief Size of a record header: size, cycle, flags
+constexpr size_t CYCLE_RECORD_HEADER_SIZE = 7;
+
+/// @brief Maximum size of a record: every slot in inputs and outputs
+constexpr size_t CYCLE_RECORD_MAX_SIZE =
+    CYCLE_RECORD_HEADER_SIZE + 2 * (1 + MAX_PARAMS * CYCLE_RECORD_ENTRY_SIZE);
+
+/// @class CycleRecorder
+/// @brief Records the ControllersIO of each engine cycle in a ring buffer.
+/// @details
+///     For each cycle, the recorder stores:
+///     - the inputs: IO values changed since the end of the previous cycle,
+///       written by prepare_inputs() or by other threads (targets, commands),
+///     - the outputs: IO values written by the controllers chain.
+///
+///     Only float, int (and enums) and bool values are recorded, bit for bit.
+///     Every MOTION_CONTROL_RECORDER_KEYFRAME_INTERVAL records, inputs hold
+///     the whole IO state instead, so that a replay can start there after the
+///     oldest records have been overwritten.
+///
+///     Record layout, little endian:
+///     | size (u16) | cycle (u32) | flags (u8) |
+///     | nb inputs (u8) | inputs | nb outputs (u8) | outputs |
+///     with each value encoded as | slot (u8) | type (u8) | value (u32) |.
+///
+///     The exported recording starts with the hashes of the registered keys,
+///     in slot order, so that slots can be mapped again on replay:
+///     | magic (u32) | version (u8) | nb keys (u8) | key hashes (u32) |
+///     | records size (u32) | records |
+///
+/// @note Not thread safe: the engine records under its mutex, detach the
+///       recorder from the engine before exporting.
+class CycleRecorder
+{
+  public:
+    /// @brief Byte sink receiving an exported recording
+    using sink_t = void (*)(const uint8_t* data, size_t size, void* arg);
+
+    /// @brief Constructor
+    /// @param buffer Ring buffer storage
+    /// @param size   Ring buffer size in bytes
+    CycleRecorder(uint8_t* buffer, size_t size);
+
+    /// @brief Record the inputs of a cycle, before the chain execution.
+    /// @param io    Engine ControllersIO, once inputs are prepared
+    /// @param cycle Engine cycle
+    /// @param flags Record flags (braking, switched)
+    void record_inputs(const ControllersIO& io, uint32_t cycle, uint8_t flags);
+
+    /// @brief Record the outputs of the cycle started by record_inputs() and
+    ///        store the record in the ring buffer.
+    /// @param io Engine ControllersIO, once the chain is executed
+    void record_outputs(const ControllersIO& io);
+
+    /// @brief Forget all records. The next record is a keyframe.
+    void clear();
+
+    /// @brief Number of records in the ring buffer
+    size_t records() const
+    {
+        return records_;
+    }
+
+    /// @brief Number of records overwritten or too large to be stored
+    uint32_t dropped() const
+    {
+        return dropped_;
+    }
+
+    /// @brief Size of the exported recording, in bytes
+    size_t export_size() const;
+
+    /// @brief Export the recording, oldest record first.
+    /// @param sink Function receiving the recording bytes, in order
+    /// @param arg  Argument given to the sink
+    /// @return Number of bytes exported
+    size_t export_recording(sink_t sink, void* arg) const;
+
+    /// @brief Print the exported recording to stdout as hexadecimal lines
+    void print() const;
+
+  private:
+    /// @brief Append a value to the record being built
+    void append_entry(ParamSlot slot, ParamType type, uint32_t bits);
+
+    /// @brief Drop the oldest record of the ring buffer
+    void drop_oldest();
+
+    /// @brief Copy bytes in the ring buffer at the write position
+    void write(const uint8_t* data, size_t size);
+
+    uint8_t* buffer_;   ///< Ring buffer storage
+    size_t size_;       ///< Ring buffer size
+    size_t head_;       ///< Write position
+    size_t tail_;       ///< Oldest record position
+    size_t used_;       ///< Bytes used in the ring buffer
+    size_t records_;    ///< Number of records in the ring buffer
+    uint32_t dropped_;  ///< Records overwritten or too large
+    uint32_t keyframe_; ///< Records until the next keyframe
+
+    /// Record being built, between record_inputs() and record_outputs()
+    etl::array<uint8_t, CYCLE_RECORD_MAX_SIZE> record_;
+    size_t record_size_; ///< Size of the record being built, 0 if none
+    size_t count_index_; ///< Position of the entry count being built
+
+    /// IO state at the end of the previous record, for inputs delta
+    etl::array<ParamType, MAX_PARAMS> last_types_;
+    etl::array<uint32_t, MAX_PARAMS> last_bits_; ///< Values matching last_types_
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,111 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Replay of a recording made by CycleRecorder
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+
+// ETL includes
+#include "etl/array.h"
+
+// Project includes
+#include "BaseController.hpp"
+#include "ControllersIO.hpp"
+#include "CycleRecorder.hpp"
+
+/// Maximum number of mismatches printed by a replay
+#ifndef MOTION_CONTROL_REPLAY_MISMATCHES_PRINTED
+#define MOTION_CONTROL_REPLAY_MISMATCHES_PRINTED 20
+#endif
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Result of a replay
+struct ReplayResult
+{
+    uint32_t cycles = 0;            ///< Replayed cycles
+    uint32_t skipped = 0;           ///< Records skipped before the first keyframe
+    uint32_t mismatched_cycles = 0; ///< Cycles with at least one output mismatch
+    uint32_t mismatches = 0;        ///< Output values differing from the recording
+    uint32_t unmapped = 0;          ///< Recorded values of keys unknown to the chain
+    uint64_t execution_ns = 0;      ///< Total chain execution time
+};
+
+/// @class CycleReplayer
+/// @brief Feeds a recording made by CycleRecorder back through a controllers
+///        chain, as fast as possible, and compares its outputs with the
+///        recorded ones.
+/// @details
+///     The replay starts on the first keyframe of the recording, with the
+///     chain reset. For each record, recorded inputs are written into the IO,
+///     the chain (or the brake chain on braking cycles) is executed, then the
+///     values it wrote are compared bit for bit with the recorded outputs.
+///     A value written by the chain but not recorded, or recorded but not
+///     written, is also a mismatch.
+///
+///     Outputs match exactly only if the chain state at the first keyframe
+///     is the reset state (recording started with the engine), and the chain
+///     parameters are the ones used on the robot.
+class CycleReplayer
+{
+  public:
+    /// @brief Load an exported recording. The data must outlive the replayer.
+    /// @param data Exported recording
+    /// @param size Recording size in bytes
+    /// @return 0 on success, EINVAL if the data is not a valid recording
+    int load(const uint8_t* data, size_t size);
+
+    /// @brief Replay the loaded recording.
+    /// @param io               ControllersIO used by the chain
+    /// @param controller       Controllers chain to replay
+    /// @param brake_controller Chain executed on braking cycles, may be null
+    /// @param verbose          Print the first mismatches
+    /// @return Replay result
+    ReplayResult replay(ControllersIO& io, BaseController& controller,
+                        BaseController* brake_controller = nullptr, bool verbose = true);
+
+  private:
+    /// @brief Write recorded inputs into the IO.
+    /// @param io      ControllersIO used by the chain
+    /// @param entries Inputs of the record
+    /// @param result  Replay result, counting unmapped values
+    void apply_inputs(ControllersIO& io, const uint8_t* entries, ReplayResult& result);
+
+    /// @brief Compare the values written by the chain with recorded outputs.
+    /// @return Number of mismatches
+    uint32_t compare_outputs(const ControllersIO& io, const uint8_t* outputs, uint32_t cycle,
+                             bool verbose, ReplayResult& result);
+
+    /// @brief Slot of the replay matching a recorded slot
+    ParamSlot map_slot(uint8_t recorded_slot) const
+    {
+        return (recorded_slot < nb_keys_) ? slots_map_[recorded_slot] : INVALID_PARAM_SLOT;
+    }
+
+    const uint8_t* keys_ = nullptr;    ///< Recorded key hashes, in recorded slot order
+    const uint8_t* records_ = nullptr; ///< First record
+    size_t records_size_ = 0;          ///< Size of the records
+    size_t nb_keys_ = 0;               ///< Number of keys in the recording dictionary
+    uint32_t printed_ = 0;             ///< Mismatches printed so far
+
+    /// Recorded slot to replay slot
+    etl::array<ParamSlot, MAX_PARAMS> slots_map_{};
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Execution time statistics of a controller
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @class ExecutionStats
+/// @brief Minimum, mean and maximum of execution time samples, in cycle
+///        counter ticks.
+class ExecutionStats
+{
+  public:
+    /// @brief Add an execution time sample
+    /// @param ticks Execution time in ticks
+    void add(uint32_t ticks)
+    {
+        if ((count_ == 0) || (ticks < min_)) {
+            min_ = ticks;
+        }
+        if (ticks > max_) {
+            max_ = ticks;
+        }
+        total_ += ticks;
+        count_++;
+    }
+
+    /// @brief Forget all samples
+    void reset()
+    {
+        min_ = 0;
+        max_ = 0;
+        count_ = 0;
+        total_ = 0;
+    }
+
+    /// @brief Number of samples
+    uint32_t count() const
+    {
+        return count_;
+    }
+
+    /// @brief Minimum execution time in ticks
+    uint32_t min() const
+    {
+        return min_;
+    }
+
+    /// @brief Mean execution time in ticks
+    uint32_t mean() const
+    {
+        return count_ ? static_cast<uint32_t>(total_ / count_) : 0;
+    }
+
+    /// @brief Maximum execution time in ticks
+    uint32_t max() const
+    {
+        return max_;
+    }
+
+  private:
+    uint32_t min_ = 0;   ///< Minimum sample
+    uint32_t max_ = 0;   ///< Maximum sample
+    uint32_t count_ = 0; ///< Number of samples
+    uint64_t total_ = 0; ///< Sum of all samples
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,125 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Pre-hashed ControllersIO key handle
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "KeyHash.hpp"
+#include "etl/string_view.h"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Index of a key inside ControllersIO storage.
+using ParamSlot = uint8_t;
+
+/// @brief Slot value of a key not resolved yet.
+constexpr ParamSlot INVALID_PARAM_SLOT = UINT8_MAX;
+
+// Forward declaration
+class ControllersIO;
+
+/// @class IOKey
+/// @brief Name of a ControllersIO entry with its pre-computed hash and slot.
+/// @details
+///     IOKeys structures of every controller are made of IOKey members. The
+///     FNV-1a hash is computed at compile time from the string literal (same
+///     algorithm as `cogip::utils::hash_key`), and the storage slot is resolved
+///     by ControllersIO on first access, then cached in the key itself.
+///     Subsequent reads and writes are plain indexed accesses, without hashing
+///     nor map probing.
+///
+///     Slots are process-wide: a given key name always resolves to the same
+///     slot, whatever the ControllersIO instance, so a key shared by several
+///     controllers or engines can safely cache it.
+///
+/// @note The key name must have static storage duration (string literal), as
+///       it is referenced and never copied.
+class IOKey
+{
+  public:
+    /// @brief Empty key, used for optional IOs not wired in a chain.
+    constexpr IOKey() : name_(), hash_(utils::hash_key("")), slot_(INVALID_PARAM_SLOT) {}
+
+    /// @brief Build a key from a null-terminated string, hashed at compile time
+    ///        when the string is a literal.
+    /// @param name Key name
+    constexpr IOKey(const char* name)
+        : name_(name, length(name)), hash_(utils::hash_key(name_)), slot_(INVALID_PARAM_SLOT)
+    {
+    }
+
+    /// @brief Build a key from a string view.
+    /// @param name Key name
+    constexpr IOKey(etl::string_view name)
+        : name_(name), hash_(utils::hash_key(name)), slot_(INVALID_PARAM_SLOT)
+    {
+    }
+
+    /// @brief Key name
+    constexpr etl::string_view name() const
+    {
+        return name_;
+    }
+
+    /// @brief Key name characters (null-terminated when built from a literal)
+    constexpr const char* data() const
+    {
+        return name_.data();
+    }
+
+    /// @brief Key name length
+    constexpr size_t size() const
+    {
+        return name_.size();
+    }
+
+    /// @brief Return true if the key is not wired
+    constexpr bool empty() const
+    {
+        return name_.empty();
+    }
+
+    /// @brief FNV-1a 32-bit hash of the key name
+    constexpr uint32_t hash() const
+    {
+        return hash_;
+    }
+
+  private:
+    friend class ControllersIO;
+
+    /// @brief constexpr strlen
+    static constexpr size_t length(const char* str)
+    {
+        size_t len = 0;
+        while (str && str[len] != '\0') {
+            len++;
+        }
+        return len;
+    }
+
+    etl::string_view name_; ///< Key name
+    uint32_t hash_;         ///< Compile-time FNV-1a hash of name_
+
+    /// Slot cached by ControllersIO on first access. Written under the
+    /// ControllersIO registry lock, always with the same value for a given name.
+    mutable ParamSlot slot_;
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -70,10 +70,12 @@ class MetaController : public BaseMetaController
 
         // Print type and name (no execution number for meta controllers)
         if (name_.empty()) {
-            printf("%s\n", type_name());
+            printf("%s", type_name());
         } else {
-            printf("%s: %.*s\n", type_name(), static_cast<int>(name_.size()), name_.data());
+            printf("%s: %.*s", type_name(), static_cast<int>(name_.size()), name_.data());
         }
+        dump_execution_stats();
+        printf("\n");
 
         // Build new prefix for children
         etl::string<128> new_prefix;
@@ -92,6 +94,17 @@ class MetaController : public BaseMetaController
         }
     }
 
+    /// @brief Link all controllers of the chain, in execution order.
+    /// @param linker Chain linker validating the dataflow
+    void link(ChainLinker& linker) const override
+    {
+        for (const auto* controller : controllers_) {
+            if (controller) {
+                linker.link(*controller);
+            }
+        }
+    }
+
     /// @brief Reset all controllers in the chain.
     /// Called when changing target to reinitialize all internal states.
     void reset() override
@@ -103,6 +116,17 @@ class MetaController : public BaseMetaController
         }
     }
 
+    /// @brief Hand off the state of the previous chain to all controllers.
+    /// @param io Shared IO object still holding the previous chain outputs.
+    void handoff(const ControllersIO& io) override
+    {
+        for (auto* controller : controllers_) {
+            if (controller) {
+                controller->handoff(io);
+            }
+        }
+    }
+
     /// @brief Run every controller in the chain, passing along the same
     /// ControllersIO.
     /// @param io Shared IO object containing inputs/outputs for all controllers.
@@ -118,7 +142,7 @@ class MetaController : public BaseMetaController
             if (!controller) {
                 LOG_ERROR("controllers_[%" PRIu32 "] is nullptr!\n", static_cast<uint32_t>(index));
             } else {
-                controller->execute(io);
+                controller->profiled_execute(io);
             }
             index++;
         }
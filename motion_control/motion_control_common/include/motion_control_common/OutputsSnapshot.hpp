@@ -0,0 +1,145 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Copy of engine outputs published for other threads
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ControllersIO.hpp"
+#include "IOKey.hpp"
+#include "etl/array.h"
+#include "etl/optional.h"
+#include "etl/type_traits.h"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Maximum number of IO keys an engine can publish.
+constexpr size_t MAX_PUBLISHED_OUTPUTS = 8;
+
+/// @class OutputsSnapshot
+/// @brief Values of the published engine IO keys at the end of a cycle.
+/// @details
+///     Only float, int (and enums) and bool values are published. A snapshot
+///     is a plain value: once copied by a reader, it is never modified by the
+///     engine thread.
+class OutputsSnapshot
+{
+  public:
+    /// @brief Retrieve a typed value for a published key.
+    /// @tparam T float, int, bool or an enum type
+    /// @param key The published key.
+    /// @return The value if the key is published and was set with this type,
+    ///         empty otherwise.
+    template <typename T> etl::optional<T> get_as(const IOKey& key) const
+    {
+        const Entry* entry = find(key);
+        if (!entry) {
+            return {};
+        }
+        if constexpr (etl::is_enum_v<T>) {
+            if (entry->type == ParamType::int_value) {
+                return static_cast<T>(entry->value.i);
+            }
+        } else if constexpr (etl::is_same_v<T, float>) {
+            if (entry->type == ParamType::float_value) {
+                return entry->value.f;
+            }
+        } else if constexpr (etl::is_same_v<T, int>) {
+            if (entry->type == ParamType::int_value) {
+                return entry->value.i;
+            }
+        } else {
+            static_assert(etl::is_same_v<T, bool>, "Unsupported published value type");
+            if (entry->type == ParamType::bool_value) {
+                return entry->value.b;
+            }
+        }
+        return {};
+    }
+
+    /// @brief Engine cycle at which the snapshot was taken.
+    uint32_t cycle() const
+    {
+        return cycle_;
+    }
+
+    /// @brief Capture the current values of some keys.
+    /// @param io    Engine ControllersIO
+    /// @param keys  Published keys
+    /// @param nb_keys Number of published keys
+    /// @param cycle Current engine cycle
+    void capture(const ControllersIO& io, const IOKey* keys, size_t nb_keys, uint32_t cycle)
+    {
+        nb_entries_ = 0;
+        cycle_ = cycle;
+
+        for (size_t i = 0; (i < nb_keys) && (i < MAX_PUBLISHED_OUTPUTS); i++) {
+            Entry& entry = entries_[nb_entries_];
+            entry.slot = ControllersIO::resolve(keys[i]);
+            entry.type = io.type_of(keys[i]);
+
+            switch (entry.type) {
+            case ParamType::float_value:
+                entry.value.f = *io.get_as<float>(keys[i]);
+                break;
+            case ParamType::int_value:
+                entry.value.i = *io.get_as<int>(keys[i]);
+                break;
+            case ParamType::bool_value:
+                entry.value.b = *io.get_as<bool>(keys[i]);
+                break;
+            default:
+                // Not set yet, or not a published type
+                continue;
+            }
+            nb_entries_++;
+        }
+    }
+
+  private:
+    /// @brief Published value
+    struct Entry
+    {
+        ParamSlot slot = INVALID_PARAM_SLOT; ///< Key slot
+        ParamType type = ParamType::none;    ///< Value type
+        union
+        {
+            float f; ///< float value
+            int i;   ///< int or enum value
+            bool b;  ///< bool value
+        } value = {};
+    };
+
+    /// @brief Find the entry of a key
+    const Entry* find(const IOKey& key) const
+    {
+        const ParamSlot slot = ControllersIO::resolve(key);
+        for (size_t i = 0; i < nb_entries_; i++) {
+            if (entries_[i].slot == slot) {
+                return &entries_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    etl::array<Entry, MAX_PUBLISHED_OUTPUTS> entries_{}; ///< Published values
+    size_t nb_entries_ = 0;                               ///< Number of valid entries
+    uint32_t cycle_ = 0;                                  ///< Engine cycle of the capture
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
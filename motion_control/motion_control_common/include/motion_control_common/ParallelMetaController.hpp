@@ -14,7 +14,6 @@
 
 // RIOT includes
 #include "log.h"
-#include <inttypes.h>
 
 #include <debug.h>
 
@@ -29,7 +28,9 @@ namespace motion_control {
 /// @brief Runs multiple sub-controllers “in parallel” using the same
 /// ControllersIO.
 /// @details If any ParamKey gets written by ≥2 top‐level controllers, prints a
-/// warning.
+/// warning. This check is a validation pass run on the first execution only,
+/// and again after each reset(): afterwards, sub-controllers are executed
+/// without any tracking overhead.
 /// @tparam NB_CONTROLLERS Maximum number of sub-controllers (default: METACONTROLLER_DEFAULT_SIZE).
 template <size_t NB_CONTROLLERS = METACONTROLLER_DEFAULT_SIZE>
 class ParallelMetaController : public MetaController<NB_CONTROLLERS>
@@ -48,8 +49,16 @@ class ParallelMetaController : public MetaController<NB_CONTROLLERS>
         return "ParallelMetaController";
     }
 
+    /// @brief Reset all sub-controllers and re-arm the collision check.
+    void reset() override
+    {
+        MetaController<NB_CONTROLLERS>::reset();
+        validated_ = false;
+    }
+
     /// @brief Execute all sub-controllers on the same `io`.
-    ///        Detects and warns if the same key is modified by ≥2 controllers.
+    ///        On the validation pass, detects and warns if the same key is
+    ///        modified by ≥2 controllers.
     /// @param io Shared ControllersIO instance.
     void execute(ControllersIO& io) override
     {
@@ -60,36 +69,47 @@ class ParallelMetaController : public MetaController<NB_CONTROLLERS>
 
         DEBUG("Execute ParallelMetaController\n");
 
+        if (validated_) {
+            for (auto ctrl : this->controllers_) {
+                ctrl->profiled_execute(io);
+            }
+            return;
+        }
+
         // Cumulative set of keys already written by previous controllers.
-        etl::set<ParamKey, MAX_PARAMS> cumulative_written;
+        ParamMask cumulative_written;
 
         // For each top-level controller:
         for (auto ctrl : this->controllers_) {
-            auto before_io = io.snapshot_modified();
+            // Isolate the keys written by this controller, including keys
+            // already written earlier in the cycle.
+            ParamMask before_io = io.snapshot_modified();
+            io.clear_modified();
 
             // Execute controller
-            ctrl->execute(io);
-
-            auto after_io = io.snapshot_modified();
+            ctrl->profiled_execute(io);
 
-            // Compute difference after/before on inputs/outputs via static helper
-            auto just_written = ControllersIO::difference(after_io, before_io);
+            ParamMask just_written = io.snapshot_modified();
+            io.restore_modified(before_io | just_written);
 
             // Detect collisions, parallel controllers should not modify the same
             // entry in the inputs/outputs map
-            auto collisions = ControllersIO::find_collisions(just_written, cumulative_written);
-            for (auto h : collisions) {
-                LOG_WARNING("Key hash %" PRIu32
-                            " was already written by another parallel controller\n",
-                            static_cast<uint32_t>(h));
-            }
+            ControllersIO::find_collisions(just_written, cumulative_written)
+                .for_each([](ParamSlot slot) {
+                    KeyType name = ControllersIO::key_name(slot);
+                    LOG_WARNING("Key %.*s was already written by another parallel controller\n",
+                                static_cast<int>(name.size()), name.data());
+                });
 
             // Merge
-            for (auto h_new : just_written) {
-                cumulative_written.insert(h_new);
-            }
+            cumulative_written |= just_written;
         }
+
+        validated_ = true;
     }
+
+  private:
+    bool validated_ = false; ///< True once the collision check has been run
 };
 
 } // namespace motion_control
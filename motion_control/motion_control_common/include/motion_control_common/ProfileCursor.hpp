@@ -0,0 +1,168 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Incremental evaluation of a velocity profile
+/// @author     Gilles Doffe <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+#include "VelocityProfile.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/**
+ * @brief Walks a VelocityProfile a fixed number of periods at a time
+ *
+ * VelocityProfile::compute_theoretical_velocity() and
+ * compute_theoretical_remaining_distance() find the phase of the requested
+ * period and evaluate closed-form kinematics each time they are called.
+ * When the profile is followed one step after the other, the cursor instead
+ * keeps the current velocity, acceleration and remaining distance, and
+ * updates them with increments precomputed for the current phase. Over n
+ * periods with a constant jerk j:
+ *
+ *     remaining    -= n * velocity + n²/2 * acceleration + n³/6 * j
+ *     velocity     += n * acceleration + n²/2 * j
+ *     acceleration += n * j
+ *
+ * which gives the same values as the closed-form evaluation of the
+ * profile, without divisions and without checking phase boundaries
+ * on each step. When a step reaches the end of the current phase, the cursor
+ * re-anchors on the closed-form values of the new period, which also bounds
+ * rounding errors accumulated by the increments.
+ *
+ * Random access evaluation is still available through seek() and the
+ * VelocityProfile methods, e.g. to replan from an arbitrary period.
+ *
+ * @code
+ * TrapezoidalProfile profile;
+ * ProfileCursor cursor;
+ * profile.generate_optimal_profile(0.0, 1000.0, 10.0, 10.0, 50.0, true);
+ * for (cursor.start(profile); !cursor.done(); cursor.advance()) {
+ *     float velocity = cursor.velocity();
+ *     float remaining = cursor.remaining_distance();
+ * }
+ * @endcode
+ */
+class ProfileCursor
+{
+  public:
+    /**
+     * @brief Go to the start of a profile
+     *
+     * Must be called after the profile is generated or reset.
+     *
+     * @param profile Profile to walk, must outlive its use by the cursor
+     * @param steps   Number of periods of each advance()
+     */
+    void start(const VelocityProfile& profile, uint32_t steps = 1)
+    {
+        profile_ = &profile;
+        steps_ = steps;
+        seek(0);
+    }
+
+    /**
+     * @brief Move to any period of the profile, evaluating it in closed form.
+     *        start() must have been called before.
+     * @param period Period index (0 = start of trajectory)
+     */
+    void seek(uint32_t period);
+
+    /**
+     * @brief Move forward by the number of periods given to start()
+     */
+    void advance()
+    {
+        const uint32_t next = period_ + steps_;
+        if (next >= phase_end_) {
+            // Entering another phase
+            seek(next);
+            return;
+        }
+        period_ = next;
+        remaining_distance_ -=
+            step_ * velocity_ + half_step_squared_ * acceleration_ + distance_jerk_;
+        velocity_ += step_ * acceleration_ + velocity_jerk_;
+        acceleration_ += acceleration_jerk_;
+    }
+
+    /**
+     * @brief Get the current period
+     * @return Period index (0 = start of trajectory)
+     */
+    uint32_t period() const
+    {
+        return period_;
+    }
+
+    /**
+     * @brief Check if the trajectory is complete at the current period
+     * @return true if the current period is past the profile total periods
+     */
+    bool done() const
+    {
+        return period_ >= total_periods_;
+    }
+
+    /**
+     * @brief Get theoretical velocity at the current period
+     * @return Same value as VelocityProfile::compute_theoretical_velocity(period())
+     */
+    float velocity() const
+    {
+        return velocity_;
+    }
+
+    /**
+     * @brief Get theoretical acceleration at the current period
+     * @return Signed velocity change per period, 0 once the trajectory is complete
+     */
+    float acceleration() const
+    {
+        return acceleration_;
+    }
+
+    /**
+     * @brief Get theoretical remaining distance at the current period
+     * @return Same value as VelocityProfile::compute_theoretical_remaining_distance(period())
+     */
+    float remaining_distance() const
+    {
+        return remaining_distance_;
+    }
+
+  private:
+    const VelocityProfile* profile_ = nullptr; ///< Walked profile
+
+    uint32_t steps_ = 1;         ///< Periods per advance()
+    uint32_t period_ = 0;        ///< Current period
+    uint32_t phase_end_ = 0;     ///< First period after the current phase
+    uint32_t total_periods_ = 0; ///< Total periods of the profile
+
+    float velocity_ = 0.0f;           ///< Velocity at the current period
+    float acceleration_ = 0.0f;       ///< Acceleration at the current period
+    float remaining_distance_ = 0.0f; ///< Remaining distance at the current period
+
+    // Increments per advance() in the current phase (n periods, jerk j)
+    float step_ = 0.0f;              ///< n, 0 once the trajectory is complete
+    float half_step_squared_ = 0.0f; ///< n²/2, 0 once the trajectory is complete
+    float distance_jerk_ = 0.0f;     ///< Distance covered due to jerk: n³/6 * j
+    float velocity_jerk_ = 0.0f;     ///< Velocity change due to jerk: n²/2 * j
+    float acceleration_jerk_ = 0.0f; ///< Acceleration change: n * j
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
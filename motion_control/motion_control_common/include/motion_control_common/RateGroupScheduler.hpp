@@ -0,0 +1,176 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Multi-rate scheduler executing controllers in phased rate groups
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+// System includes
+#include <cstdint>
+
+// ETL includes
+#include "etl/vector.h"
+
+// Project includes
+#include "BaseController.hpp"
+#include "ExecutionStats.hpp"
+
+/// Maximum number of rate groups in a scheduler
+#ifndef MOTION_CONTROL_RATE_GROUPS_MAX
+#define MOTION_CONTROL_RATE_GROUPS_MAX 6
+#endif
+
+/// Maximum number of controllers in a rate group
+#ifndef MOTION_CONTROL_RATE_GROUP_CONTROLLERS_MAX
+#define MOTION_CONTROL_RATE_GROUP_CONTROLLERS_MAX 4
+#endif
+
+/// Number of cycles inspected to choose the least loaded phase
+#ifndef MOTION_CONTROL_RATE_GROUP_WINDOW_MAX
+#define MOTION_CONTROL_RATE_GROUP_WINDOW_MAX 1024
+#endif
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @brief Controllers executed on the same engine cycles.
+struct RateGroup
+{
+    /// Execute the group every divider cycles
+    uint16_t divider;
+    /// Cycle, modulo divider, on which the group is executed
+    uint16_t phase;
+    /// Controllers of the group, in execution order
+    etl::vector<BaseController*, MOTION_CONTROL_RATE_GROUP_CONTROLLERS_MAX> controllers;
+    /// Execution time of the whole group, in cycle counter ticks
+    ExecutionStats load;
+};
+
+/// @brief Controller executing other controllers at reduced rates, with
+///        explicit phase offsets.
+///
+/// Each controller is added to a rate group, identified by a divider and a
+/// phase: the group is executed on cycles where cycle % divider == phase.
+/// Giving slow controllers different phases spreads them over the cycles
+/// instead of running them all on the same one, so the worst case cycle
+/// time stays close to the mean.
+///
+/// Groups are executed in the order they were created, controllers of a
+/// group in the order they were added. Values written by a controller are
+/// kept in ControllersIO between its executions, so they remain available
+/// to downstream controllers on every cycle.
+///
+/// Example: with divider 10, the pose loop runs every 10 cycles on phase 0,
+/// and the two telemetry controllers of divider 2 run on alternate cycles.
+class RateGroupScheduler : public BaseController
+{
+  public:
+    /// @brief Constructor
+    /// @param name Optional instance name for identification
+    explicit RateGroupScheduler(etl::string_view name = "") : BaseController(name), cycle_(0) {}
+
+    /// @brief Get the type name of this controller
+    const char* type_name() const override
+    {
+        return "RateGroupScheduler";
+    }
+
+    /// @brief Add a controller to the rate group of a divider and a phase.
+    /// @param controller Controller to schedule
+    /// @param divider    Execute the controller every divider cycles (>= 1)
+    /// @param phase      Cycle offset, lower than divider
+    /// @return 0 on success, EINVAL on invalid divider or phase, ENOMEM if
+    ///         there is no room left for the controller
+    int add_controller(BaseController* controller, uint16_t divider, uint16_t phase);
+
+    /// @brief Add a controller on the least loaded phase of a divider.
+    /// @details The chosen phase minimizes the number of controllers executed
+    ///          on the busiest cycle, then the number of controllers executed
+    ///          in total on the cycles of the phase.
+    /// @param controller Controller to schedule
+    /// @param divider    Execute the controller every divider cycles (>= 1)
+    /// @return 0 on success, EINVAL on invalid divider, ENOMEM if there is no
+    ///         room left for the controller
+    int add_controller(BaseController* controller, uint16_t divider);
+
+    /// @brief Execute the rate groups due on the current cycle.
+    /// @param io Controllers input/output datas shared across controllers
+    void execute(ControllersIO& io) override;
+
+    /// @brief Reset all scheduled controllers.
+    /// Called when changing target to reinitialize all internal states.
+    void reset() override;
+
+    /// @brief Hand off the state of the previous chain to all scheduled controllers.
+    /// @param io Controllers input/output datas still holding the previous chain outputs
+    void handoff(const ControllersIO& io) override;
+
+    /// @brief Link all scheduled controllers, in execution order.
+    /// @param linker Chain linker validating the dataflow
+    void link(ChainLinker& linker) const override;
+
+    /// @brief Dump the rate groups and their load
+    /// @param counter Execution order counter (passed to scheduled controllers)
+    void dump(int indent = 0, bool is_last = true, const char* prefix = "",
+              int* counter = nullptr) const override;
+
+    /// @brief Number of rate groups
+    size_t groups_count() const
+    {
+        return groups_.size();
+    }
+
+    /// @brief Get a rate group
+    /// @param index Group index, in creation order
+    const RateGroup& group(size_t index) const
+    {
+        return groups_[index];
+    }
+
+    /// @brief Worst case cycle execution time, summing the maximum measured
+    ///        load of all groups executed on a same cycle.
+    /// @return Execution time in cycle counter ticks
+    uint32_t worst_cycle_load() const;
+
+    /// @brief Forget the measured loads of all groups
+    void reset_loads();
+
+    /// @brief Scheduler cycle
+    uint32_t cycle() const
+    {
+        return cycle_;
+    }
+
+    /// @brief Restart the schedule at cycle 0.
+    void reset_cycle()
+    {
+        cycle_ = 0;
+    }
+
+  private:
+    /// @brief Number of controllers executed on a cycle
+    size_t controllers_on_cycle(uint32_t cycle) const;
+
+    /// @brief Number of cycles after which the schedule repeats, bounded by
+    ///        MOTION_CONTROL_RATE_GROUP_WINDOW_MAX
+    uint32_t hyperperiod(uint16_t divider = 1) const;
+
+    /// Rate groups, in execution order
+    etl::vector<RateGroup, MOTION_CONTROL_RATE_GROUPS_MAX> groups_;
+
+    /// Current cycle
+    uint32_t cycle_;
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,311 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Jerk-limited (S-curve) velocity profile calculator
+/// @author     Gilles Doffe <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <etl/array.h>
+
+#include "VelocityProfile.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/**
+ * @brief Jerk-limited velocity profile calculator
+ *
+ * Same generation and evaluation API as TrapezoidalProfile, but acceleration
+ * ramps up and down with a bounded jerk instead of stepping instantly,
+ * so velocity is an S-curve. This avoids wheel slipping at the start and end
+ * of acceleration phases, allowing higher peak accelerations.
+ *
+ * Each velocity change (reverse deceleration, acceleration, deceleration)
+ * is made of up to three phases:
+ * - jerk phase: acceleration ramps up to its limit (or less for small changes)
+ * - constant acceleration phase, if the velocity change is large enough
+ * - jerk phase: acceleration ramps down to 0
+ *
+ * These are the phases of the profile with the constant velocity plateau.
+ * Unlike TrapezoidalProfile, phases do not last a whole number of periods:
+ * the profile is computed in continuous time, expressed in periods, and
+ * evaluated at each period.
+ *
+ * Usage example:
+ * @code
+ * SCurveProfile profile(2.0);  // jerk (mm/period³)
+ * uint32_t total_periods = profile.generate_optimal_profile(
+ *     0.0,      // initial_velocity
+ *     1000.0,   // target_distance (mm)
+ *     10.0,     // acceleration (mm/period²)
+ *     10.0,     // deceleration (mm/period²)
+ *     50.0,     // max_speed (mm/period)
+ *     true      // must_stop_at_end
+ * );
+ * @endcode
+ */
+class SCurveProfile : public VelocityProfile
+{
+  public:
+    /// @brief Constructor
+    /// @param jerk Maximum jerk (mm/period³ or rad/period³)
+    explicit SCurveProfile(float jerk = 1.0f) : jerk_(jerk) {}
+
+    /**
+     * @brief Generate optimal velocity profile to reach target distance
+     *
+     * Computes the fastest jerk-limited trajectory to reach target_distance
+     * while respecting max speed, acceleration and deceleration. The plateau
+     * velocity is lowered if the distance is too short to reach max_speed.
+     *
+     * If an initial acceleration is set, the profile starts by ramping it
+     * down to 0 at the maximum jerk, so that it continues the one it replaces.
+     * If the initial velocity is then opposite to the target, the profile goes on
+     * by decelerating to 0. If it is higher than max_speed, the profile
+     * decelerates to max_speed, or keeps the initial velocity if there is not
+     * enough distance to do so.
+     *
+     * @param initial_velocity Starting velocity (mm/period or rad/period)
+     * @param target_distance Distance to travel (mm or rad, can be negative)
+     * @param acceleration Maximum acceleration (mm/period² or rad/period²)
+     * @param deceleration Maximum deceleration (mm/period² or rad/period²)
+     * @param max_speed Maximum velocity limit (mm/period or rad/period)
+     * @param must_stop_at_end If true, ends at final_velocity; if false, ends at plateau velocity
+     * @param final_velocity Velocity magnitude at the end when must_stop_at_end (0 to stop)
+     * @return Total number of periods to complete the trajectory, 0 on error
+     */
+    uint32_t generate_optimal_profile(float initial_velocity, float target_distance,
+                                      float acceleration, float deceleration, float max_speed,
+                                      bool must_stop_at_end, float final_velocity = 0.0f) override;
+
+    /**
+     * @brief Compute theoretical velocity at given period
+     * @param period Period index (0 = start of trajectory)
+     * @return Theoretical velocity at this period (mm/period or rad/period)
+     */
+    float compute_theoretical_velocity(uint32_t period) const override;
+
+    /**
+     * @brief Compute theoretical remaining distance at given period
+     * @param period Period index (0 = start of trajectory)
+     * @return Remaining distance from this period to target (mm or rad)
+     */
+    float compute_theoretical_remaining_distance(uint32_t period) const override;
+
+    /**
+     * @brief Get the phase of the profile containing a period
+     * @param period Period index (0 = start of trajectory)
+     * @param[out] end First period after the phase
+     * @param[out] acceleration Signed acceleration at this period
+     * @param[out] jerk Signed jerk during the phase
+     * @return false if the period is after trajectory completion (or the profile is
+     *         not initialized)
+     */
+    bool phase_at(uint32_t period, uint32_t& end, float& acceleration,
+                  float& jerk) const override;
+
+    /**
+     * @brief Get total number of periods for the trajectory
+     * @return Duration of the trajectory, rounded up to a whole number of periods
+     */
+    uint32_t total_periods() const override
+    {
+        return total_periods_;
+    }
+
+    /**
+     * @brief Get plateau velocity
+     * @return Target velocity during constant velocity phase (mm/period or rad/period)
+     */
+    float plateau_velocity() const
+    {
+        return plateau_velocity_;
+    }
+
+    /**
+     * @brief Get initial velocity
+     * @return Starting velocity (mm/period or rad/period)
+     */
+    float initial_velocity() const
+    {
+        return initial_velocity_;
+    }
+
+    /**
+     * @brief Get target distance
+     * @return Total distance to travel (mm or rad)
+     */
+    float target_distance() const override
+    {
+        return target_distance_;
+    }
+
+    /**
+     * @brief Check if profile is initialized
+     * @return true if generate_optimal_profile() was called successfully
+     */
+    bool is_initialized() const override
+    {
+        return initialized_;
+    }
+
+    /**
+     * @brief Reset profile to uninitialized state
+     */
+    void reset() override
+    {
+        initialized_ = false;
+    }
+
+    /// @brief Get maximum jerk
+    float jerk() const
+    {
+        return jerk_;
+    }
+
+    /// @brief Set maximum jerk, used by next generated profiles
+    void set_jerk(float jerk)
+    {
+        jerk_ = jerk;
+    }
+
+    /// @brief Get initial acceleration of next generated profiles
+    float initial_acceleration() const
+    {
+        return initial_acceleration_;
+    }
+
+    /// @brief Set initial acceleration (signed, mm/period² or rad/period²), used by next
+    ///        generated profiles to splice onto a running profile, 0 to start without acceleration
+    void set_initial_acceleration(float initial_acceleration)
+    {
+        initial_acceleration_ = initial_acceleration;
+    }
+
+    /**
+     * @brief Compute the distance covered by an S-curve profile for a given duration
+     *
+     * Jerk-limited counterpart of TrapezoidalProfile::compute_distance_for_duration():
+     * distance traveled when accelerating from rest to target_speed, cruising,
+     * and decelerating to rest if must_stop_at_end, all in total_periods.
+     * The peak speed is lowered if the duration is too short to reach target_speed.
+     *
+     * @param target_speed Target plateau speed (positive magnitude, units/period)
+     * @param acceleration Acceleration rate (positive, units/period²)
+     * @param deceleration Deceleration rate (positive, units/period²), unused if !must_stop_at_end
+     * @param jerk Jerk (positive, units/period³)
+     * @param total_periods Total duration in periods
+     * @param must_stop_at_end If true, includes deceleration phase in the distance
+     * @return Distance (positive magnitude)
+     */
+    static float compute_distance_for_duration(float target_speed, float acceleration,
+                                               float deceleration, float jerk,
+                                               uint32_t total_periods, bool must_stop_at_end);
+
+  private:
+    /// Maximum number of phases: initial acceleration ramp down, 3 per velocity
+    /// change (reverse deceleration, acceleration, deceleration) and the plateau
+    static constexpr size_t max_phases = 11;
+
+    /// @brief Constant jerk phase, in the target direction
+    struct Phase
+    {
+        float start;        ///< Start time (periods)
+        float duration;     ///< Duration (periods)
+        float jerk;         ///< Jerk during the phase
+        float acceleration; ///< Acceleration at phase start
+        float velocity;     ///< Velocity at phase start
+        float distance;     ///< Distance traveled at phase start
+    };
+
+    /// @brief Kinematic state in the target direction
+    struct State
+    {
+        float acceleration; ///< Acceleration
+        float velocity;     ///< Velocity
+        float distance;     ///< Distance traveled since the start
+    };
+
+    /**
+     * @brief Reset profile to stationary state (no movement)
+     */
+    void reset_to_stationary();
+
+    /**
+     * @brief Evaluate the profile at a time
+     * @param time Time since start (periods)
+     * @return State in the target direction
+     */
+    State state_at(float time) const;
+
+    /**
+     * @brief Append a constant jerk phase, continuing from the last phase
+     * @param duration Duration (periods)
+     * @param jerk Jerk during the phase
+     */
+    void append_phase(float duration, float jerk);
+
+    /**
+     * @brief Append the phases of a velocity change, starting with no acceleration
+     * @param v0 Velocity at start
+     * @param v1 Velocity at end
+     * @param accel Maximum acceleration magnitude
+     * @param jerk Maximum jerk magnitude
+     */
+    void append_velocity_change(float v0, float v1, float accel, float jerk);
+
+    /**
+     * @brief Compute durations of a jerk-limited velocity change
+     * @param dv Velocity change magnitude
+     * @param accel Maximum acceleration magnitude
+     * @param jerk Maximum jerk magnitude
+     * @param[out] jerk_duration Duration of each jerk phase
+     * @param[out] accel_duration Duration of the constant acceleration phase
+     */
+    static void compute_velocity_change_durations(float dv, float accel, float jerk,
+                                                  float& jerk_duration, float& accel_duration);
+
+    /**
+     * @brief Compute duration of a jerk-limited velocity change
+     * @return Duration of the velocity change from v0 to v1 (periods)
+     */
+    static float compute_velocity_change_duration(float v0, float v1, float accel, float jerk);
+
+    /**
+     * @brief Compute distance of a jerk-limited velocity change
+     * @return Distance traveled from v0 to v1: (v0 + v1) / 2 * duration
+     */
+    static float compute_velocity_change_distance(float v0, float v1, float accel, float jerk);
+
+    float jerk_;                        ///< Maximum jerk
+    float initial_acceleration_ = 0.0f; ///< Starting acceleration (signed)
+    float start_acceleration_ = 0.0f;   ///< Starting acceleration in the target direction
+    float initial_velocity_ = 0.0f;     ///< Starting velocity (signed, can be opposite to target)
+    float plateau_velocity_ = 0.0f;     ///< Plateau velocity (signed, may be < max_speed)
+    float target_distance_ = 0.0f;      ///< Total distance to cover
+    float final_velocity_ = 0.0f;       ///< Final velocity (signed)
+    float direction_ = 1.0f;            ///< Sign of target distance
+    float duration_ = 0.0f;             ///< Duration of the trajectory (periods)
+    uint32_t total_periods_ = 0;        ///< Duration rounded up to a whole number of periods
+
+    etl::array<Phase, max_phases> phases_{}; ///< Phases of the trajectory
+    size_t phases_count_ = 0;                ///< Number of phases
+
+    bool initialized_ = false; ///< Profile has been computed
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,172 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Fixed-width bitmask over ControllersIO slots
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "IOKey.hpp"
+
+namespace cogip {
+
+namespace motion_control {
+
+/// @class SlotMask
+/// @brief Set of ControllersIO slots, one bit per slot.
+/// @details All set operations (union, intersection, difference) are done
+///          word by word, so their cost only depends on the number of slots,
+///          not on the number of keys in the set.
+/// @tparam NB_SLOTS Number of slots covered by the mask.
+template <size_t NB_SLOTS> class SlotMask
+{
+  public:
+    /// @brief Number of bits per word
+    static constexpr size_t WORD_BITS = 32;
+
+    /// @brief Number of words needed to cover NB_SLOTS
+    static constexpr size_t NB_WORDS = (NB_SLOTS + WORD_BITS - 1) / WORD_BITS;
+
+    /// @brief Add a slot to the set
+    constexpr void set(ParamSlot slot)
+    {
+        words_[slot / WORD_BITS] |= bit(slot);
+    }
+
+    /// @brief Remove a slot from the set
+    constexpr void reset(ParamSlot slot)
+    {
+        words_[slot / WORD_BITS] &= ~bit(slot);
+    }
+
+    /// @brief Return true if the slot belongs to the set
+    constexpr bool test(ParamSlot slot) const
+    {
+        return (words_[slot / WORD_BITS] & bit(slot)) != 0;
+    }
+
+    /// @brief Remove all slots from the set
+    constexpr void clear()
+    {
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            words_[i] = 0;
+        }
+    }
+
+    /// @brief Return true if at least one slot belongs to the set
+    constexpr bool any() const
+    {
+        uint32_t acc = 0;
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            acc |= words_[i];
+        }
+        return acc != 0;
+    }
+
+    /// @brief Number of slots in the set
+    size_t count() const
+    {
+        size_t nb = 0;
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            nb += static_cast<size_t>(__builtin_popcount(words_[i]));
+        }
+        return nb;
+    }
+
+    /// @brief Slots belonging to both sets
+    constexpr SlotMask operator&(const SlotMask& other) const
+    {
+        SlotMask result;
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            result.words_[i] = words_[i] & other.words_[i];
+        }
+        return result;
+    }
+
+    /// @brief Slots belonging to at least one set
+    constexpr SlotMask operator|(const SlotMask& other) const
+    {
+        SlotMask result;
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            result.words_[i] = words_[i] | other.words_[i];
+        }
+        return result;
+    }
+
+    /// @brief Slots belonging to exactly one set
+    constexpr SlotMask operator^(const SlotMask& other) const
+    {
+        SlotMask result;
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            result.words_[i] = words_[i] ^ other.words_[i];
+        }
+        return result;
+    }
+
+    /// @brief Add all slots of another set
+    constexpr SlotMask& operator|=(const SlotMask& other)
+    {
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+
+    /// @brief Slots of this set not belonging to another set
+    constexpr SlotMask without(const SlotMask& other) const
+    {
+        SlotMask result;
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            result.words_[i] = words_[i] & ~other.words_[i];
+        }
+        return result;
+    }
+
+    /// @brief Equality of two sets
+    constexpr bool operator==(const SlotMask& other) const
+    {
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            if (words_[i] != other.words_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Call a function for each slot of the set, in increasing order.
+    /// @param func Callable taking a ParamSlot
+    template <typename F> void for_each(F&& func) const
+    {
+        for (size_t i = 0; i < NB_WORDS; i++) {
+            uint32_t word = words_[i];
+            while (word) {
+                const size_t bit_index = static_cast<size_t>(__builtin_ctz(word));
+                func(static_cast<ParamSlot>(i * WORD_BITS + bit_index));
+                word &= word - 1;
+            }
+        }
+    }
+
+  private:
+    /// @brief Bit of a slot inside its word
+    static constexpr uint32_t bit(ParamSlot slot)
+    {
+        return 1u << (slot % WORD_BITS);
+    }
+
+    uint32_t words_[NB_WORDS] = {}; ///< Slot bits, slot n is bit n % 32 of word n / 32
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -0,0 +1,203 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Meta-controller executing a chain of controllers fixed at build time
+/// @author     Gilles DOFFE <g.doffe@gmail.com>
+
+#pragma once
+
+// System includes
+#include <cerrno>
+#include <tuple>
+#include <type_traits>
+
+// Project includes
+#include "BaseMetaController.hpp"
+#include "ControllersIO.hpp"
+#include "etl/string.h"
+
+namespace cogip {
+namespace motion_control {
+
+/// @brief Chain of controllers composed at build time, executed in sequence
+/// sharing a single ControllersIO.
+///
+/// Same behavior as MetaController, but the controllers are given to the
+/// constructor and held by reference in a tuple. execute(), reset() and
+/// link() are unrolled at compile time: sub-controllers are called without
+/// virtual dispatch (unless execution time profiling is enabled), so small
+/// filters can be inlined, and no container or null check is needed.
+///
+/// The chain cannot be modified: add_controller(), prepend_controller() and
+/// replace_controller() fail with -EPERM.
+///
+/// @note Sub-controllers must be constructed before the meta controller, as
+///       it registers itself as their meta controller.
+///
+/// Example:
+/// @code
+/// inline StaticMetaController speed_loop(speed_filter, anti_blocking, speed_pid);
+/// @endcode
+///
+/// @tparam Ctrls Types of the controllers, in execution order
+template <typename... Ctrls>
+    requires(sizeof...(Ctrls) > 0) && (std::is_base_of_v<BaseController, Ctrls> && ...)
+class StaticMetaController : public BaseMetaController
+{
+  public:
+    /// Constructor
+    /// @param controllers Controllers, in execution order
+    explicit StaticMetaController(Ctrls&... controllers)
+        : StaticMetaController(etl::string_view(""), controllers...)
+    {
+    }
+
+    /// Constructor
+    /// @param name Instance name for identification
+    /// @param controllers Controllers, in execution order
+    StaticMetaController(etl::string_view name, Ctrls&... controllers)
+        : BaseController(name), BaseMetaController(name), controllers_(controllers...)
+    {
+        (controllers.set_meta(this), ...);
+    }
+
+    /// Not copyable: a copy would still reference the original controllers
+    StaticMetaController(const StaticMetaController&) = delete;
+    StaticMetaController& operator=(const StaticMetaController&) = delete;
+
+    /// @brief Get the type name of this controller
+    /// @return Type name string
+    const char* type_name() const override
+    {
+        return "StaticMetaController";
+    }
+
+    /// @brief Number of controllers in the chain
+    static constexpr size_t size()
+    {
+        return sizeof...(Ctrls);
+    }
+
+    /// @brief Dump the controller hierarchy to stdout as ASCII tree
+    /// @param indent Current indentation level
+    /// @param is_last Whether this is the last child at current level
+    /// @param prefix Prefix string for tree drawing
+    /// @param counter Execution order counter (passed to children, not used for meta)
+    void dump(int indent = 0, bool is_last = true, const char* prefix = "",
+              int* counter = nullptr) const override
+    {
+        // Print tree branch for this meta controller
+        if (indent > 0) {
+            printf("%s%s", prefix, is_last ? "└── " : "├── ");
+        }
+
+        // Print type and name (no execution number for meta controllers)
+        if (name_.empty()) {
+            printf("%s", type_name());
+        } else {
+            printf("%s: %.*s", type_name(), static_cast<int>(name_.size()), name_.data());
+        }
+        dump_execution_stats();
+        printf("\n");
+
+        // Build new prefix for children
+        etl::string<128> new_prefix;
+        new_prefix.append(prefix);
+        new_prefix.append(is_last ? "    " : "│   ");
+
+        // Dump children
+        size_t index = 0;
+        std::apply(
+            [&](const Ctrls&... controllers) {
+                ((controller_dump(controllers, indent + 1, ++index == size(), new_prefix.c_str(),
+                                  counter)),
+                 ...);
+            },
+            controllers_);
+    }
+
+    /// @brief Link all controllers of the chain, in execution order.
+    /// @param linker Chain linker validating the dataflow
+    void link(ChainLinker& linker) const override
+    {
+        std::apply([&](const Ctrls&... controllers) { (linker.link(controllers), ...); },
+                   controllers_);
+    }
+
+    /// @brief Reset all controllers in the chain.
+    /// Called when changing target to reinitialize all internal states.
+    void reset() override
+    {
+        std::apply([](Ctrls&... controllers) { (controllers.Ctrls::reset(), ...); }, controllers_);
+    }
+
+    /// @brief Hand off the state of the previous chain to all controllers.
+    /// @param io Shared IO object still holding the previous chain outputs.
+    void handoff(const ControllersIO& io) override
+    {
+        std::apply([&](Ctrls&... controllers) { (controllers.Ctrls::handoff(io), ...); },
+                   controllers_);
+    }
+
+    /// @brief Run every controller in the chain, passing along the same
+    /// ControllersIO.
+    /// @param io Shared IO object containing inputs/outputs for all controllers.
+    void execute(ControllersIO& io) override
+    {
+        std::apply([&](Ctrls&... controllers) { (controller_execute(controllers, io), ...); },
+                   controllers_);
+    }
+
+    /// @brief Not supported, the chain is fixed at build time.
+    /// @return -EPERM
+    int add_controller(BaseController*) override
+    {
+        return -EPERM;
+    }
+
+    /// @brief Not supported, the chain is fixed at build time.
+    /// @return -EPERM
+    int prepend_controller(BaseController*) override
+    {
+        return -EPERM;
+    }
+
+    /// @brief Not supported, the chain is fixed at build time.
+    /// @return -EPERM
+    int replace_controller(uint32_t, BaseController*) override
+    {
+        return -EPERM;
+    }
+
+  private:
+    /// @brief Execute one controller of the chain
+    template <typename C> static void controller_execute(C& controller, ControllersIO& io)
+    {
+#ifdef MODULE_MOTION_CONTROL_PROFILING
+        controller.profiled_execute(io);
+#else
+        // Qualified call: no virtual dispatch
+        controller.C::execute(io);
+#endif
+    }
+
+    /// @brief Dump one controller of the chain
+    static void controller_dump(const BaseController& controller, int indent, bool is_last,
+                                const char* prefix, int* counter)
+    {
+        controller.dump(indent, is_last, prefix, counter);
+    }
+
+    /// Controllers, in execution order
+    std::tuple<Ctrls&...> controllers_;
+};
+
+} // namespace motion_control
+} // namespace cogip
+
+/// @}
@@ -13,6 +13,8 @@
 
 #include <cstdint>
 
+#include "VelocityProfile.hpp"
+
 namespace cogip {
 
 namespace motion_control {
@@ -48,7 +50,7 @@ namespace motion_control {
  * }
  * @endcode
  */
-class TrapezoidalProfile
+class TrapezoidalProfile : public VelocityProfile
 {
   public:
     /// Default constructor
@@ -70,12 +72,14 @@ class TrapezoidalProfile
      * @param acceleration Maximum acceleration (mm/period² or rad/period²)
      * @param deceleration Maximum deceleration (mm/period² or rad/period²)
      * @param max_speed Maximum velocity limit (mm/period or rad/period)
-     * @param must_stop_at_end If true, final velocity is 0; if false, continues at plateau velocity
+     * @param must_stop_at_end If true, ends at final_velocity; if false, continues at plateau
+     *                         velocity
+     * @param final_velocity Velocity magnitude at the end when must_stop_at_end (0 to stop)
      * @return Total number of periods to complete the trajectory, 0 on error
      */
     uint32_t generate_optimal_profile(float initial_velocity, float target_distance,
                                       float acceleration, float deceleration, float max_speed,
-                                      bool must_stop_at_end);
+                                      bool must_stop_at_end, float final_velocity = 0.0f) override;
 
     /**
      * @brief Compute theoretical velocity at given period
@@ -86,7 +90,7 @@ class TrapezoidalProfile
      * @param period Period index (0 = start of trajectory)
      * @return Theoretical velocity at this period (mm/period or rad/period)
      */
-    float compute_theoretical_velocity(uint32_t period) const;
+    float compute_theoretical_velocity(uint32_t period) const override;
 
     /**
      * @brief Compute theoretical remaining distance at given period
@@ -97,13 +101,29 @@ class TrapezoidalProfile
      * @param period Period index (0 = start of trajectory)
      * @return Remaining distance from this period to target (mm or rad)
      */
-    float compute_theoretical_remaining_distance(uint32_t period) const;
+    float compute_theoretical_remaining_distance(uint32_t period) const override;
+
+    /**
+     * @brief Get the phase of the profile containing a period
+     *
+     * Within a phase, velocity changes by a constant acceleration at each period.
+     * Used by ProfileCursor to walk the profile incrementally.
+     *
+     * @param period Period index (0 = start of trajectory)
+     * @param[out] end First period after the phase
+     * @param[out] acceleration Signed velocity change per period during the phase
+     * @param[out] jerk Always 0: acceleration is constant during each phase
+     * @return false if the period is after trajectory completion (or the profile is
+     *         not initialized): velocity is then constant and the distance no longer changes
+     */
+    bool phase_at(uint32_t period, uint32_t& end, float& acceleration,
+                  float& jerk) const override;
 
     /**
      * @brief Get total number of periods for the trajectory
      * @return Total periods (reverse_decel + acceleration + plateau + deceleration)
      */
-    uint32_t total_periods() const
+    uint32_t total_periods() const override
     {
         return reverse_decel_periods_ + accel_periods_ + plateau_periods_ + decel_periods_;
     }
@@ -130,7 +150,7 @@ class TrapezoidalProfile
      * @brief Get target distance
      * @return Total distance to travel (mm or rad)
      */
-    float target_distance() const
+    float target_distance() const override
     {
         return target_distance_;
     }
@@ -139,7 +159,7 @@ class TrapezoidalProfile
      * @brief Check if profile is initialized
      * @return true if generate_optimal_profile() was called successfully
      */
-    bool is_initialized() const
+    bool is_initialized() const override
     {
         return initialized_;
     }
@@ -151,7 +171,7 @@ class TrapezoidalProfile
      * This allows the controller to rely solely on the profile state without
      * maintaining a separate ready flag.
      */
-    void reset()
+    void reset() override
     {
         initialized_ = false;
     }
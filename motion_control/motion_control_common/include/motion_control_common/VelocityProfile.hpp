@@ -0,0 +1,106 @@
+// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+// This file is subject to the terms and conditions of the GNU Lesser
+// General Public License v2.1. See the file LICENSE in the top level
+// directory for more details.
+
+/// @ingroup    motion_control_common
+/// @{
+/// @file
+/// @brief      Velocity profile interface
+/// @author     Gilles Doffe <g.doffe@gmail.com>
+
+#pragma once
+
+#include <cstdint>
+
+namespace cogip {
+
+namespace motion_control {
+
+/**
+ * @brief Interface of the velocity profiles followed by the tracker controllers
+ *
+ * A profile is generated to cover a target distance from an initial velocity,
+ * then evaluated at any period since its start. Profiles are made of phases
+ * where the acceleration changes with a constant jerk (0 for trapezoidal
+ * profiles), which allows ProfileCursor to walk them incrementally.
+ */
+class VelocityProfile
+{
+  public:
+    /// Destructor
+    virtual ~VelocityProfile() = default;
+
+    /**
+     * @brief Generate optimal velocity profile to reach target distance
+     * @param initial_velocity Starting velocity (mm/period or rad/period)
+     * @param target_distance Distance to travel (mm or rad, can be negative)
+     * @param acceleration Maximum acceleration (mm/period² or rad/period²)
+     * @param deceleration Maximum deceleration (mm/period² or rad/period²)
+     * @param max_speed Maximum velocity limit (mm/period or rad/period)
+     * @param must_stop_at_end If true, ends at final_velocity; if false, continues at plateau
+     *                         velocity
+     * @param final_velocity Velocity magnitude at the end when must_stop_at_end, 0 to stop.
+     *                       Lowered to max_speed and to the velocity reachable on the distance.
+     * @return Total number of periods to complete the trajectory, 0 on error
+     */
+    virtual uint32_t generate_optimal_profile(float initial_velocity, float target_distance,
+                                              float acceleration, float deceleration,
+                                              float max_speed, bool must_stop_at_end,
+                                              float final_velocity = 0.0f) = 0;
+
+    /**
+     * @brief Compute theoretical velocity at given period
+     * @param period Period index (0 = start of trajectory)
+     * @return Theoretical velocity at this period (mm/period or rad/period)
+     */
+    virtual float compute_theoretical_velocity(uint32_t period) const = 0;
+
+    /**
+     * @brief Compute theoretical remaining distance at given period
+     * @param period Period index (0 = start of trajectory)
+     * @return Remaining distance from this period to target (mm or rad)
+     */
+    virtual float compute_theoretical_remaining_distance(uint32_t period) const = 0;
+
+    /**
+     * @brief Get the phase of the profile containing a period
+     * @param period Period index (0 = start of trajectory)
+     * @param[out] end First period after the phase
+     * @param[out] acceleration Signed velocity change per period at this period
+     * @param[out] jerk Signed acceleration change per period during the phase
+     * @return false if the period is after trajectory completion (or the profile is
+     *         not initialized): velocity is then constant and the distance no longer changes
+     */
+    virtual bool phase_at(uint32_t period, uint32_t& end, float& acceleration,
+                          float& jerk) const = 0;
+
+    /**
+     * @brief Get total number of periods for the trajectory
+     * @return Total periods
+     */
+    virtual uint32_t total_periods() const = 0;
+
+    /**
+     * @brief Get target distance
+     * @return Total distance to travel (mm or rad)
+     */
+    virtual float target_distance() const = 0;
+
+    /**
+     * @brief Check if profile is initialized
+     * @return true if generate_optimal_profile() was called successfully
+     */
+    virtual bool is_initialized() const = 0;
+
+    /**
+     * @brief Reset profile to uninitialized state
+     */
+    virtual void reset() = 0;
+};
+
+} // namespace motion_control
+
+} // namespace cogip
+
+/// @}
@@ -5,6 +5,11 @@
 #include "path/Path.hpp"
 #include "platform.hpp"
 
+/// Size of the engine cycles recorder ring buffer, in bytes
+#ifndef MOTION_CONTROL_RECORDER_BUFFER_SIZE
+#define MOTION_CONTROL_RECORDER_BUFFER_SIZE (16 * 1024)
+#endif
+
 namespace cogip {
 
 namespace pf {
@@ -17,6 +22,9 @@ inline cogip::path::Path motion_control_path;
 /// Throttle divider for QUADPID pose loop controllers (execute every N cycles)
 constexpr uint16_t quadpid_pose_controllers_throttle_divider = 1;
 
+/// Rate divider for telemetry controllers (execute every N cycles, on distinct phases)
+constexpr uint16_t telemetry_rate_divider = 2;
+
 /// Handle brake signal to stop the robot
 void pf_handle_brake(const cogip::canpb::ReadBuffer& buffer);
 
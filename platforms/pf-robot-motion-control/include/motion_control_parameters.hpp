@@ -19,6 +19,7 @@
 #include "parameter/ConversionPolicies.hpp"
 #include "parameter/Parameter.hpp"
 #include "parameter/StoragePolicies.hpp"
+#include "trigonometry.h"
 
 using cogip::utils::operator"" _key_hash;
 
@@ -64,6 +65,11 @@ constexpr uint32_t ANGULAR_SPEED_PID_KD_KEY = "angular_speed_pid_kd"_key_hash;
 constexpr uint32_t LINEAR_THRESHOLD_KEY = "linear_threshold"_key_hash;
 constexpr uint32_t ANGULAR_THRESHOLD_KEY = "angular_threshold"_key_hash;
 constexpr uint32_t ANGULAR_INTERMEDIATE_THRESHOLD_KEY = "angular_intermediate_threshold"_key_hash;
+// Flash keys of the angular thresholds, stored in radians since they were
+// stored in degrees under the protocol keys above
+constexpr uint32_t ANGULAR_THRESHOLD_RAD_FLASH_KEY = "angular_threshold_rad"_key_hash;
+constexpr uint32_t ANGULAR_INTERMEDIATE_THRESHOLD_RAD_FLASH_KEY =
+    "angular_intermediate_threshold_rad"_key_hash;
 
 // Speed and acceleration limits
 constexpr uint32_t MIN_SPEED_LINEAR_KEY = "min_speed_linear"_key_hash;
@@ -75,6 +81,9 @@ constexpr uint32_t MAX_SPEED_ANGULAR_KEY = "max_speed_angular"_key_hash;
 constexpr uint32_t MAX_ACC_ANGULAR_KEY = "max_acc_angular"_key_hash;
 constexpr uint32_t MAX_DEC_ANGULAR_KEY = "max_dec_angular"_key_hash;
 
+// Speed observer
+constexpr uint32_t SPEED_OBSERVER_BANDWIDTH_KEY = "speed_observer_bandwidth_hz"_key_hash;
+
 // Tracker linear pose PID
 constexpr uint32_t TRACKER_LINEAR_POSE_PID_KP_KEY = "tracker_linear_pose_pid_kp"_key_hash;
 constexpr uint32_t TRACKER_LINEAR_POSE_PID_KI_KEY = "tracker_linear_pose_pid_ki"_key_hash;
@@ -114,8 +123,14 @@ namespace pf {
 namespace motion_control {
 
 constexpr uint16_t motion_control_thread_period_ms = 20; ///< controller thread loop period
-
-/// @name Platform speed/acceleration constexpr (per-period units, derived from app_conf.hpp)
+/// Localization thread loop period, sampled by the controller thread
+constexpr uint16_t motion_control_localization_period_ms = motion_control_thread_period_ms;
+/// Localization update ahead of each controller cycle, covering an OTOS burst
+/// read (about 2 ms at 100 kHz): the pose used by a cycle is this old
+constexpr uint32_t motion_control_localization_lead_us = 3000;
+
+/// @name Platform speed/acceleration constexpr (per-period units and radians, derived from
+///       app_conf.hpp)
 /// @{
 constexpr float platform_max_acc_linear_mm_per_period2 =
     X_SEC2_TO_X_PERIOD2(max_acc_mm_per_s2, motion_control_thread_period_ms);
@@ -130,18 +145,22 @@ constexpr float platform_low_speed_linear_mm_per_period =
 constexpr float platform_normal_speed_linear_mm_per_period =
     (platform_max_speed_linear_mm_per_period / 2);
 
-constexpr float platform_max_acc_angular_deg_per_period2 =
-    X_SEC2_TO_X_PERIOD2(max_acc_deg_per_s2, motion_control_thread_period_ms);
-constexpr float platform_max_dec_angular_deg_per_period2 =
-    X_SEC2_TO_X_PERIOD2(max_dec_deg_per_s2, motion_control_thread_period_ms);
-constexpr float platform_min_speed_angular_deg_per_period =
-    X_SEC_TO_X_PERIOD(min_speed_deg_per_s, motion_control_thread_period_ms);
-constexpr float platform_max_speed_angular_deg_per_period =
-    X_SEC_TO_X_PERIOD(max_speed_deg_per_s, motion_control_thread_period_ms);
-constexpr float platform_low_speed_angular_deg_per_period =
-    (platform_max_speed_angular_deg_per_period / 4);
-constexpr float platform_normal_speed_angular_deg_per_period =
-    (platform_max_speed_angular_deg_per_period / 2);
+constexpr float platform_max_acc_angular_rad_per_period2 =
+    X_SEC2_TO_X_PERIOD2(DEG2RAD(max_acc_deg_per_s2), motion_control_thread_period_ms);
+constexpr float platform_max_dec_angular_rad_per_period2 =
+    X_SEC2_TO_X_PERIOD2(DEG2RAD(max_dec_deg_per_s2), motion_control_thread_period_ms);
+constexpr float platform_min_speed_angular_rad_per_period =
+    X_SEC_TO_X_PERIOD(DEG2RAD(min_speed_deg_per_s), motion_control_thread_period_ms);
+constexpr float platform_max_speed_angular_rad_per_period =
+    X_SEC_TO_X_PERIOD(DEG2RAD(max_speed_deg_per_s), motion_control_thread_period_ms);
+constexpr float platform_low_speed_angular_rad_per_period =
+    (platform_max_speed_angular_rad_per_period / 4);
+constexpr float platform_normal_speed_angular_rad_per_period =
+    (platform_max_speed_angular_rad_per_period / 2);
+
+constexpr float platform_angular_threshold_rad = DEG2RAD(angular_threshold);
+constexpr float platform_angular_intermediate_threshold_rad =
+    DEG2RAD(angular_intermediate_threshold);
 
 constexpr double platform_linear_anti_blocking_speed_threshold_mm_per_period =
     (motion_control_thread_period_ms * platform_linear_anti_blocking_speed_threshold_mm_per_s) /
@@ -149,6 +168,10 @@ constexpr double platform_linear_anti_blocking_speed_threshold_mm_per_period =
 constexpr double platform_linear_anti_blocking_error_threshold_mm_per_period =
     (motion_control_thread_period_ms * platform_linear_anti_blocking_error_threshold_mm_per_s) /
     1000;
+
+/// Speed observer bandwidth (Hz), 0 feeds the speed loops with raw encoder speeds
+/// Disabled until the speed PID gains are retuned with the observer lag (5 Hz suggested)
+constexpr float platform_speed_observer_bandwidth_hz = 0.0f;
 /// @}
 
 } // namespace motion_control
@@ -226,36 +249,39 @@ inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::
 
 // PID integral limits
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> linear_pose_pid_integral_limit{default_linear_pose_pid_integral_limit};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> angular_pose_pid_integral_limit{default_angular_pose_pid_integral_limit};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> angular_pose_pid_integral_limit{DEG2RAD(default_angular_pose_pid_integral_limit)};
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> linear_speed_pid_integral_limit{default_linear_speed_pid_integral_limit};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> angular_speed_pid_integral_limit{default_angular_speed_pid_integral_limit};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> angular_speed_pid_integral_limit{DEG2RAD(default_angular_speed_pid_integral_limit)};
 
 // Tracker PID integral limits
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> tracker_linear_pose_pid_integral_limit{default_tracker_linear_pose_pid_integral_limit};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> tracker_angular_pose_pid_integral_limit{default_tracker_angular_pose_pid_integral_limit};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> tracker_angular_pose_pid_integral_limit{DEG2RAD(default_tracker_angular_pose_pid_integral_limit)};
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> tracker_linear_speed_pid_integral_limit{default_tracker_linear_speed_pid_integral_limit};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> tracker_angular_speed_pid_integral_limit{default_tracker_angular_speed_pid_integral_limit};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> tracker_angular_speed_pid_integral_limit{DEG2RAD(default_tracker_angular_speed_pid_integral_limit)};
 
 // Brake speed PID integral limits
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> brake_linear_speed_pid_integral_limit{default_brake_linear_speed_pid_integral_limit};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> brake_angular_speed_pid_integral_limit{default_brake_angular_speed_pid_integral_limit};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative> brake_angular_speed_pid_integral_limit{DEG2RAD(default_brake_angular_speed_pid_integral_limit)};
 
-// Pose straight filter thresholds (absolute units: mm, deg)
+// Pose straight filter thresholds (internal: mm, rad, protobuf: mm, deg)
 inline cogip::parameter::Parameter<float, cogip::parameter::Clamp<1, 10>, cogip::parameter::WithFlashStorage<LINEAR_THRESHOLD_KEY>> param_linear_threshold{linear_threshold};
-inline cogip::parameter::Parameter<float, cogip::parameter::Clamp<1, 5>, cogip::parameter::WithFlashStorage<ANGULAR_THRESHOLD_KEY>> param_angular_threshold{angular_threshold};
-inline cogip::parameter::Parameter<float, cogip::parameter::Clamp<1, 5>, cogip::parameter::WithFlashStorage<ANGULAR_INTERMEDIATE_THRESHOLD_KEY>> param_angular_intermediate_threshold{angular_intermediate_threshold};
+inline cogip::parameter::Parameter<float, cogip::parameter::Clamp<DEG2RAD(1.0f), DEG2RAD(5.0f)>, cogip::parameter::DegreesConversion, cogip::parameter::WithFlashStorageFromDegrees<ANGULAR_THRESHOLD_RAD_FLASH_KEY, ANGULAR_THRESHOLD_KEY>> param_angular_threshold{platform_angular_threshold_rad};
+inline cogip::parameter::Parameter<float, cogip::parameter::Clamp<DEG2RAD(1.0f), DEG2RAD(5.0f)>, cogip::parameter::DegreesConversion, cogip::parameter::WithFlashStorageFromDegrees<ANGULAR_INTERMEDIATE_THRESHOLD_RAD_FLASH_KEY, ANGULAR_INTERMEDIATE_THRESHOLD_KEY>> param_angular_intermediate_threshold{platform_angular_intermediate_threshold_rad};
 
-// Speed limits (internal: /period, protobuf: /s)
+// Speed limits (internal: /period and rad, protobuf: /s and deg)
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::SpeedConversion<motion_control_thread_period_ms>> param_min_speed_linear{platform_min_speed_linear_mm_per_period};
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::SpeedConversion<motion_control_thread_period_ms>> param_max_speed_linear{platform_max_speed_linear_mm_per_period};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::SpeedConversion<motion_control_thread_period_ms>> param_min_speed_angular{platform_min_speed_angular_deg_per_period};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::SpeedConversion<motion_control_thread_period_ms>> param_max_speed_angular{platform_max_speed_angular_deg_per_period};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::SpeedConversion<motion_control_thread_period_ms>, cogip::parameter::DegreesConversion> param_min_speed_angular{platform_min_speed_angular_rad_per_period};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::SpeedConversion<motion_control_thread_period_ms>, cogip::parameter::DegreesConversion> param_max_speed_angular{platform_max_speed_angular_rad_per_period};
 
-// Acceleration/deceleration limits (internal: /period², protobuf: /s²)
+// Acceleration/deceleration limits (internal: /period² and rad, protobuf: /s² and deg)
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::AccelerationConversion<motion_control_thread_period_ms>> param_max_acc_linear{platform_max_acc_linear_mm_per_period2};
 inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::AccelerationConversion<motion_control_thread_period_ms>> param_max_dec_linear{platform_max_dec_linear_mm_per_period2};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::AccelerationConversion<motion_control_thread_period_ms>> param_max_acc_angular{platform_max_acc_angular_deg_per_period2};
-inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::AccelerationConversion<motion_control_thread_period_ms>> param_max_dec_angular{platform_max_dec_angular_deg_per_period2};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::AccelerationConversion<motion_control_thread_period_ms>, cogip::parameter::DegreesConversion> param_max_acc_angular{platform_max_acc_angular_rad_per_period2};
+inline cogip::parameter::Parameter<float, cogip::parameter::NonNegative, cogip::parameter::AccelerationConversion<motion_control_thread_period_ms>, cogip::parameter::DegreesConversion> param_max_dec_angular{platform_max_dec_angular_rad_per_period2};
+
+// Speed observer bandwidth (Hz), bounded below the Nyquist frequency of the control loop
+inline cogip::parameter::Parameter<float, cogip::parameter::Clamp<0, 25>, cogip::parameter::WithFlashStorage<SPEED_OBSERVER_BANDWIDTH_KEY>> param_speed_observer_bandwidth_hz{platform_speed_observer_bandwidth_hz};
 // clang-format on
 // ============================================================================
 // Parameter registry handlers (canpb)
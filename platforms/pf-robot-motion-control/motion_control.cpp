@@ -1,6 +1,10 @@
 // RIOT includes
 #include "log.h"
 #include <inttypes.h>
+#ifdef MODULE_MOTION_CONTROL_RECORDER
+#include <cstring>
+#include <shell.h>
+#endif
 
 #define ENABLE_DEBUG 0
 #include <debug.h>
@@ -10,7 +14,9 @@
 #include "board.h"
 #include "drive_controller/DifferentialDriveController.hpp"
 #include "drive_controller/DifferentialDriveControllerParameters.hpp"
+#include "localization/LocalizationThread.hpp"
 #include "motion_control.hpp"
+#include "motion_control_common/CycleRecorder.hpp"
 #include "motion_control_common/MetaController.hpp"
 #include "motion_motors_params.hpp"
 #include "motor/MotorDriverDRV8873.hpp"
@@ -33,17 +39,14 @@
 
 // Odometry: select the localization implementation at compile time.
 // robot2_conf.hpp defines ROBOT_HAS_OTOS; every other robot falls back
-// to encoder-based LocalizationDifferential. Kept at file scope so the
-// nested namespace resolution stays clean in the per-robot headers.
-#ifdef ROBOT_HAS_OTOS
-#include "localization/LocalizationOTOS.hpp"
-#include "otos/OTOS.hpp"
-static cogip::localization::LocalizationOTOS::Parameters
-    otos_params(otos_linear_scalar, otos_angular_scalar, otos_offset_x_mm, otos_offset_y_mm,
-                otos_offset_h_deg);
-static cogip::otos::OTOS otos_sensor(SOFT_I2C_DEV(0), otos_i2c_addr);
-static cogip::localization::LocalizationOTOS robot_localization(otos_sensor, otos_params);
-#else
+// to encoder-based LocalizationDifferential. Robots with both sensors may
+// fuse them with the localization_fused module (see Makefile.dep).
+// Kept at file scope so the nested namespace resolution stays clean in the
+// per-robot headers.
+#if defined(MODULE_LOCALIZATION_FUSED) && !defined(ROBOT_HAS_OTOS)
+#error "localization_fused requires an OTOS robot configuration (ROBOT_HAS_OTOS)"
+#endif
+#if !defined(ROBOT_HAS_OTOS) || defined(MODULE_LOCALIZATION_FUSED)
 #include "encoder/EncoderQDEC.hpp"
 #include "localization/LocalizationDifferential.hpp"
 static cogip::encoder::EncoderQDEC left_encoder(MOTOR_LEFT, COGIP_BOARD_ENCODER_MODE,
@@ -53,6 +56,26 @@ static cogip::encoder::EncoderQDEC right_encoder(MOTOR_RIGHT, COGIP_BOARD_ENCODE
 static cogip::localization::LocalizationDifferentialParameters
     localization_params(left_encoder_wheels_diameter_mm, right_encoder_wheels_diameter_mm,
                         encoder_wheels_distance_mm, qdec_left_polarity, qdec_right_polarity);
+#endif
+#ifdef ROBOT_HAS_OTOS
+#include "localization/LocalizationOTOS.hpp"
+#include "otos/OTOS.hpp"
+static cogip::localization::LocalizationOTOS::Parameters
+    otos_params(otos_linear_scalar, otos_angular_scalar, otos_offset_x_mm, otos_offset_y_mm,
+                otos_offset_h_deg);
+static cogip::otos::OTOS otos_sensor(SOFT_I2C_DEV(0), otos_i2c_addr);
+#endif
+#if defined(MODULE_LOCALIZATION_FUSED)
+#include "localization/LocalizationFused.hpp"
+static cogip::localization::LocalizationDifferential
+    encoder_localization(localization_params, left_encoder, right_encoder);
+static cogip::localization::LocalizationOTOS otos_localization(otos_sensor, otos_params);
+static cogip::localization::LocalizationFusedParameters fused_localization_params;
+static cogip::localization::LocalizationFused
+    robot_localization(encoder_localization, otos_localization, fused_localization_params);
+#elif defined(ROBOT_HAS_OTOS)
+static cogip::localization::LocalizationOTOS robot_localization(otos_sensor, otos_params);
+#else
 static cogip::localization::LocalizationDifferential
     robot_localization(localization_params, left_encoder, right_encoder);
 #endif
@@ -71,6 +94,14 @@ PB_Pose pb_pose;
 PB_Controller pb_controller;
 PB_State pb_state;
 
+// Engine outputs published for readers outside the engine thread
+static const cogip::motion_control::IOKey is_intermediate_key("is_intermediate");
+static const cogip::motion_control::IOKey path_complete_key("path_complete");
+static const cogip::motion_control::IOKey linear_speed_order_key("linear_speed_order");
+static const cogip::motion_control::IOKey angular_speed_order_key("angular_speed_order");
+static const cogip::motion_control::IOKey
+    pose_straight_filter_state_key("pose_straight_filter_state");
+
 // PID tuning period
 constexpr uint16_t motion_control_pid_tuning_period_ms = 1500;
 
@@ -94,13 +125,52 @@ static cogip::drive_controller::DifferentialDriveControllerParameters
 
 static cogip::drive_controller::DifferentialDriveController
     drive_controller(drive_controller_params, left_motor, right_motor);
+/// Localization thread priority, above the engine one (THREAD_PRIORITY_MAIN - 2)
+/// so that the update phased ahead of an engine cycle is never delayed by it
+#define LOCALIZATION_PRIO (THREAD_PRIORITY_MAIN - 3)
+
+/// Localization updated in its own thread, sampled by the engine
+/// motion_control_localization_lead_us before each engine cycle
+static cogip::localization::LocalizationThread
+    threaded_localization(robot_localization, motion_control_localization_period_ms,
+                          motion_control_thread_period_ms, LOCALIZATION_PRIO,
+                          motion_control_localization_lead_us);
+
 static void pf_pose_reached_cb(const cogip::motion_control::target_pose_status_t state);
 // Motion control engine
 static cogip::motion_control::PlatformEngine pf_motion_control_platform_engine(
-    robot_localization, drive_controller, motion_control_path,
+    threaded_localization, drive_controller, motion_control_path,
     cogip::motion_control::pose_reached_cb_t::create<pf_pose_reached_cb>(),
     motion_control_thread_period_ms);
 
+#ifdef MODULE_MOTION_CONTROL_RECORDER
+/// Engine cycles recorder ring buffer
+static uint8_t recorder_buffer[MOTION_CONTROL_RECORDER_BUFFER_SIZE];
+static cogip::motion_control::CycleRecorder recorder(recorder_buffer, sizeof(recorder_buffer));
+
+/// Print the recorded cycles as hexadecimal, or clear them
+static int _cmd_mc_record(int argc, char** argv)
+{
+    // Do not record while the recorder is read
+    pf_motion_control_platform_engine.set_recorder(nullptr);
+
+    if ((argc > 1) && (strcmp(argv[1], "clear") == 0)) {
+        recorder.clear();
+    } else {
+        printf("# %u records, %" PRIu32 " dropped, %u bytes\n",
+               static_cast<unsigned>(recorder.records()), recorder.dropped(),
+               static_cast<unsigned>(recorder.export_size()));
+        recorder.print();
+    }
+
+    pf_motion_control_platform_engine.set_recorder(&recorder);
+
+    return 0;
+}
+
+SHELL_COMMAND(mc_record, "Print motion control recorded cycles, or clear them", _cmd_mc_record);
+#endif
+
 /// Handle controller change request
 static void _handle_set_controller(cogip::canpb::ReadBuffer& buffer)
 {
@@ -113,34 +183,32 @@ static void _handle_set_controller(cogip::canpb::ReadBuffer& buffer)
         return;
     }
 
-    // Change controller
+    // Stage controller change
     current_controller_id = static_cast<uint32_t>(pb_controller.id());
     switch (static_cast<uint32_t>(pb_controller.id())) {
     case static_cast<uint32_t>(PB_ControllerEnum::QUADPID_TRACKER):
         LOG_INFO("Change to controller: QUADPID_TRACKER\n");
-        pf_motion_control_platform_engine.set_controller(
-            &quadpid_tracker_chain::quadpid_tracker_meta_controller);
-        pf_motion_control_platform_engine.set_timeout_enable(false);
+        pf_motion_control_platform_engine.stage_controller(
+            &quadpid_tracker_chain::quadpid_tracker_meta_controller, false);
         break;
 
     case static_cast<uint32_t>(PB_ControllerEnum::TRACKER_SPEED_TUNING):
         LOG_INFO("Change to controller: TRACKER_SPEED_TUNING\n");
-        pf_motion_control_platform_engine.set_controller(
-            &tracker_speed_tuning_chain::meta_controller);
-        pf_motion_control_platform_engine.set_timeout_enable(true);
+        pf_motion_control_platform_engine.stage_controller(
+            &tracker_speed_tuning_chain::meta_controller, true);
         break;
 
     case static_cast<uint32_t>(PB_ControllerEnum::QUADPID):
     default:
         LOG_INFO("Change to controller: QUADPID\n");
-        pf_motion_control_platform_engine.set_controller(&quadpid_chain::quadpid_meta_controller);
-        pf_motion_control_platform_engine.set_timeout_enable(false);
+        pf_motion_control_platform_engine.stage_controller(&quadpid_chain::quadpid_meta_controller,
+                                                           false);
         break;
     }
 
-    // Reset pose_reached to avoid stale blocked/reached state from previous chain
-    pf_motion_control_platform_engine.reset_pose_reached();
-    pf_motion_control_platform_engine.set_current_cycle(0);
+    // The chain is swapped in by the engine on its next cycle, which also
+    // resets pose_reached and the current cycle, applies the chain timeout
+    // enable flag and hands off the speed loops state of the previous chain
     pf_motion_control_platform_engine.dump_pipeline();
 }
 
@@ -155,15 +223,20 @@ static void pf_pose_reached_cb(const cogip::motion_control::target_pose_status_t
         // Do nothing when robot is moving
         break;
 
+    case cogip::motion_control::target_pose_status_t::intermediate_reached:
+        // Path waypoint passed at junction speed, without stopping
     case cogip::motion_control::target_pose_status_t::reached:
         // Send message when pose is reached
         // Note: Path advancement is handled by PathManagerFilter in the control loop.
         // This callback only sends CAN messages.
         if (previous_target_pose_status != state) {
-            // Read is_intermediate from IO (set by PathManagerFilter, PurePursuit, or
-            // PlatformEngine)
+            // Read is_intermediate from published outputs (set by PathManagerFilter,
+            // PurePursuit, or PlatformEngine)
+            cogip::motion_control::OutputsSnapshot outputs;
+            pf_motion_control_platform_engine.outputs(outputs);
+
             bool is_intermediate = false;
-            if (auto opt = pf_motion_control_platform_engine.io().get_as<bool>("is_intermediate")) {
+            if (auto opt = outputs.get_as<bool>(is_intermediate_key)) {
                 is_intermediate = *opt;
             }
 
@@ -172,9 +245,9 @@ static void pf_pose_reached_cb(const cogip::motion_control::target_pose_status_t
             } else {
                 pf_get_canpb().send_message(pose_reached_uuid);
 
-                // Read path_complete from IO (set by PathManagerFilter or PurePursuit)
-                if (auto opt =
-                        pf_motion_control_platform_engine.io().get_as<bool>("path_complete")) {
+                // Read path_complete from published outputs (set by PathManagerFilter or
+                // PurePursuit)
+                if (auto opt = outputs.get_as<bool>(path_complete_key)) {
                     if (*opt) {
                         pf_get_canpb().send_message(path_complete_uuid);
                     }
@@ -252,30 +325,32 @@ void cogip_native_motor_driver_qdec_simulation(const motor_driver_t* motor_drive
     (void)motor_id;
     (void)pwm_duty_cycle;
 
-    float wheels_perimeter = M_PI * left_encoder_wheels_diameter_mm.get();
+    float wheels_perimeter = FAST_MATH_PI * left_encoder_wheels_diameter_mm.get();
     float pulse_per_mm = encoder_wheels_resolution_pulses.get() / wheels_perimeter;
-    float wheels_distance_pulse = encoder_wheels_distance_mm.get() * pulse_per_mm;
-    float pulse_per_degree = (wheels_distance_pulse * 2 * M_PI) / 360;
+    float pulse_per_rad = encoder_wheels_distance_mm.get() * pulse_per_mm;
 
     // On native architecture set speeds at their theorical value, no error.
     if (pf_motion_control_platform_engine.pose_reached() !=
         cogip::motion_control::target_pose_status_t::reached) {
-        // Get speed commands from IO
+        // Get speed commands from published outputs, this may run outside the
+        // engine thread when motors are stopped by a CAN handler
+        cogip::motion_control::OutputsSnapshot outputs;
+        pf_motion_control_platform_engine.outputs(outputs);
+
         float linear_speed_cmd = 0.0f;
         float angular_speed_cmd = 0.0f;
-        if (auto opt = pf_motion_control_platform_engine.io().get_as<float>("linear_speed_order")) {
+        if (auto opt = outputs.get_as<float>(linear_speed_order_key)) {
             linear_speed_cmd = *opt;
         }
-        if (auto opt =
-                pf_motion_control_platform_engine.io().get_as<float>("angular_speed_order")) {
+        if (auto opt = outputs.get_as<float>(angular_speed_order_key)) {
             angular_speed_cmd = *opt;
         }
 
         qdecs_value[MOTOR_RIGHT] =
-            (linear_speed_cmd * pulse_per_mm + angular_speed_cmd * pulse_per_degree / 2) *
+            (linear_speed_cmd * pulse_per_mm + angular_speed_cmd * pulse_per_rad / 2) *
             qdec_right_polarity.get();
         qdecs_value[MOTOR_LEFT] =
-            (linear_speed_cmd * pulse_per_mm - angular_speed_cmd * pulse_per_degree / 2) *
+            (linear_speed_cmd * pulse_per_mm - angular_speed_cmd * pulse_per_rad / 2) *
             qdec_left_polarity.get();
     }
 }
@@ -302,7 +377,7 @@ void pf_send_pb_state(void)
 
 void pf_send_encoder_telemetry(void)
 {
-    robot_localization.send_telemetry();
+    threaded_localization.send_telemetry();
 }
 
 void pf_handle_brake([[maybe_unused]] const cogip::canpb::ReadBuffer& buffer)
@@ -355,21 +430,25 @@ void pf_handle_target_pose(cogip::canpb::ReadBuffer& buffer)
 
     // Target pose
     target_pose.pb_read(pb_path_target_pose);
-    LOG_INFO("New target pose: x=%.2f, y=%.2f, O=%.2f\n", static_cast<double>(target_pose.x()),
+    LOG_INFO("New target pose: x=%.2f, y=%.2f, O=%.3f\n", static_cast<double>(target_pose.x()),
              static_cast<double>(target_pose.y()), static_cast<double>(target_pose.O()));
 
-    // Use path manager for backward compatibility: reset + add + start
+    // Use path manager for backward compatibility: reset + add + start.
+    // The path is rewritten between two engine cycles: on replan the chain is not
+    // reset, so PathManagerFilter must never read a partially written path.
+    pf_motion_control_platform_engine.lock();
     motion_control_path.reset();
     motion_control_path.add_point(target_pose);
     motion_control_path.start();
+    pf_motion_control_platform_engine.unlock();
 
     // Target speed
     target_speed.set_distance(
         (platform_max_speed_linear_mm_per_period * target_pose.max_speed_ratio_linear()) / 100);
     target_speed.set_angle(
-        (platform_max_speed_angular_deg_per_period * target_pose.max_speed_ratio_angular()) / 100);
+        (platform_max_speed_angular_rad_per_period * target_pose.max_speed_ratio_angular()) / 100);
     pf_motion_control_platform_engine.set_target_speed(target_speed);
-    LOG_INFO("Target speed: linear=%.2f mm/period, angular=%.2f deg/period\n",
+    LOG_INFO("Target speed: linear=%.2f mm/period, angular=%.4f rad/period\n",
              static_cast<double>(target_speed.distance()),
              static_cast<double>(target_speed.angle()));
 
@@ -386,6 +465,25 @@ void pf_handle_target_pose(cogip::canpb::ReadBuffer& buffer)
         pf_motion_control_platform_engine.set_timeout_enable(false);
     }
 
+    // Target updated while the tracker chain is moving to position: let PoseStraightFilter
+    // replan on the fly from the running profiles, without resetting the chain (e.g. chasing
+    // a moving goal). It still resets PIDs itself if the new target needs a rotation first.
+    // The filter state is read from published outputs, as this runs outside the engine thread.
+    cogip::motion_control::OutputsSnapshot outputs;
+    pf_motion_control_platform_engine.outputs(outputs);
+    const auto pose_straight_filter_state =
+        outputs.get_as<cogip::motion_control::PoseStraightFilterState>(
+            pose_straight_filter_state_key);
+
+    const bool replan =
+        (current_controller_id == static_cast<uint32_t>(PB_ControllerEnum::QUADPID_TRACKER)) &&
+        quadpid_tracker_chain::pose_straight_filter_parameters.continuous_replanning() &&
+        pose_straight_filter_state &&
+        (*pose_straight_filter_state ==
+         cogip::motion_control::PoseStraightFilterState::MOVE_TO_POSITION) &&
+        (pf_motion_control_platform_engine.pose_reached() ==
+         cogip::motion_control::target_pose_status_t::moving);
+
     // Release any latched brake from a previous reached arrival so the
     // normal control chain runs again on this new motion.
     pf_motion_control_platform_engine.set_brake(false);
@@ -393,6 +491,10 @@ void pf_handle_target_pose(cogip::canpb::ReadBuffer& buffer)
     pf_motion_control_platform_engine.set_pose_reached(
         cogip::motion_control::target_pose_status_t::moving);
 
+    if (replan) {
+        return;
+    }
+
     pf_motion_control_platform_engine.disable();
     pf_motion_control_reset_controllers();
     pf_motion_control_platform_engine.enable();
@@ -429,7 +531,8 @@ void pf_handle_speed_order(cogip::canpb::ReadBuffer& buffer)
     // The sign carries the direction for ProfileTrackerController in duration mode.
     target_speed.set_distance(
         X_SEC_TO_X_PERIOD(linear_speed_mm_s, motion_control_thread_period_ms));
-    target_speed.set_angle(X_SEC_TO_X_PERIOD(angular_speed_deg_s, motion_control_thread_period_ms));
+    target_speed.set_angle(
+        X_SEC_TO_X_PERIOD(DEG2RAD(angular_speed_deg_s), motion_control_thread_period_ms));
     pf_motion_control_platform_engine.set_target_speed(target_speed);
 
     // Release any latched brake from a previous reached arrival.
@@ -462,7 +565,7 @@ void pf_handle_start_pose(cogip::canpb::ReadBuffer& buffer)
     start_pose.pb_read(pb_start_pose);
     cogip::path::Pose pose(start_pose.x(), start_pose.y(), start_pose.O());
 
-    LOG_INFO("[START_POSE] Received from planner: x=%.1f y=%.1f O=%.1f\n",
+    LOG_INFO("[START_POSE] Received from planner: x=%.1f y=%.1f O=%.3f\n",
              static_cast<double>(pose.x()), static_cast<double>(pose.y()),
              static_cast<double>(pose.O()));
 
@@ -508,7 +611,7 @@ void pf_handle_path_add_point(cogip::canpb::ReadBuffer& buffer)
     if (motion_control_path.add_point_from_pb(pb_path_pose)) {
         const auto* added = motion_control_path.waypoint_at(motion_control_path.size() - 1);
         if (added) {
-            LOG_INFO("[PATH_ADD_POINT] Added waypoint %u: x=%.1f, y=%.1f, O=%.1f\n",
+            LOG_INFO("[PATH_ADD_POINT] Added waypoint %u: x=%.1f, y=%.1f, O=%.3f\n",
                      static_cast<unsigned>(motion_control_path.size()),
                      static_cast<double>(added->x()), static_cast<double>(added->y()),
                      static_cast<double>(added->O()));
@@ -551,7 +654,7 @@ void pf_handle_path_start([[maybe_unused]] const cogip::canpb::ReadBuffer& buffe
         target_speed.set_distance(
             (platform_max_speed_linear_mm_per_period * target_pose.max_speed_ratio_linear()) / 100);
         target_speed.set_angle(
-            (platform_max_speed_angular_deg_per_period * target_pose.max_speed_ratio_angular()) /
+            (platform_max_speed_angular_rad_per_period * target_pose.max_speed_ratio_angular()) /
             100);
         pf_motion_control_platform_engine.set_target_speed(target_speed);
 
@@ -578,15 +681,16 @@ void pf_handle_path_start([[maybe_unused]] const cogip::canpb::ReadBuffer& buffe
 
 void pf_start_motion_control(void)
 {
-    // Start engine thread
+    // Start localization thread, then engine thread
+    threaded_localization.start_thread();
     pf_motion_control_platform_engine.start_thread();
 }
 
 void pf_motion_control_reset_controllers(void)
 {
     // Log pose before reset
-    const auto& pose_before = robot_localization.pose();
-    LOG_INFO("[RESET] Pose BEFORE reset: x=%.1f y=%.1f O=%.1f\n",
+    const auto& pose_before = pf_motion_control_platform_engine.current_pose();
+    LOG_INFO("[RESET] Pose BEFORE reset: x=%.1f y=%.1f O=%.3f\n",
              static_cast<double>(pose_before.x()), static_cast<double>(pose_before.y()),
              static_cast<double>(pose_before.O()));
 
@@ -608,8 +712,8 @@ void pf_motion_control_reset_controllers(void)
     }
 
     // Log pose after reset
-    const auto& pose_after = robot_localization.pose();
-    LOG_INFO("[RESET] Pose AFTER reset: x=%.1f y=%.1f O=%.1f\n",
+    const auto& pose_after = pf_motion_control_platform_engine.current_pose();
+    LOG_INFO("[RESET] Pose AFTER reset: x=%.1f y=%.1f O=%.3f\n",
              static_cast<double>(pose_after.x()), static_cast<double>(pose_after.y()),
              static_cast<double>(pose_after.O()));
 }
@@ -623,7 +727,7 @@ void pf_disable_motion_control()
     left_motor.disable();
     right_motor.disable();
 
-    robot_localization.reset();
+    threaded_localization.reset();
 }
 
 void pf_enable_motion_control()
@@ -641,7 +745,7 @@ void pf_init_motion_control(void)
     right_motor.init();
 
     // Init localization (encoder or OTOS depending on robot config)
-    robot_localization.init();
+    threaded_localization.init();
 
     // Init controllers
     quadpid_chain::init();
@@ -650,6 +754,23 @@ void pf_init_motion_control(void)
     brake_chain::init();
     pf_motion_control_platform_engine.set_brake_controller(&brake_chain::brake_meta_controller);
 
+    // Link the chains selectable later, so that a full keys registry halts at
+    // boot instead of on the first controller change
+    pf_motion_control_platform_engine.link(&quadpid_chain::quadpid_meta_controller);
+    pf_motion_control_platform_engine.link(&tracker_speed_tuning_chain::meta_controller);
+
+    // Publish outputs read outside the engine thread
+    pf_motion_control_platform_engine.publish_output(is_intermediate_key);
+    pf_motion_control_platform_engine.publish_output(path_complete_key);
+    pf_motion_control_platform_engine.publish_output(linear_speed_order_key);
+    pf_motion_control_platform_engine.publish_output(angular_speed_order_key);
+    pf_motion_control_platform_engine.publish_output(pose_straight_filter_state_key);
+
+#ifdef MODULE_MOTION_CONTROL_RECORDER
+    // Record engine cycles for offline replay
+    pf_motion_control_platform_engine.set_recorder(&recorder);
+#endif
+
     // Associate default controller (QUADPID_TRACKER) to the engine
     pf_motion_control_platform_engine.set_controller(
         &quadpid_tracker_chain::quadpid_tracker_meta_controller);
@@ -662,7 +783,7 @@ void pf_init_motion_control(void)
     pf_get_canpb().register_message_handler(
         controller_uuid, cogip::canpb::message_handler_t::create<_handle_set_controller>());
 
-    robot_localization.reset();
+    threaded_localization.reset();
     pf_disable_motion_control();
 }
 
@@ -99,6 +99,8 @@ static const ParameterHandlerType::Registry registry = {
     {MAX_SPEED_ANGULAR_KEY, param_max_speed_angular},
     {MAX_ACC_ANGULAR_KEY, param_max_acc_angular},
     {MAX_DEC_ANGULAR_KEY, param_max_dec_angular},
+    /// Speed observer
+    {SPEED_OBSERVER_BANDWIDTH_KEY, param_speed_observer_bandwidth_hz},
 };
 
 static ParameterHandlerType parameter_handler(registry);
@@ -20,21 +20,8 @@ namespace quadpid_chain {
 
 cogip::motion_control::QuadPIDMetaController* init()
 {
-    // Linear pose loop meta controller (pose controller only, executed at reduced frequency)
-    linear_pose_loop_meta_controller.add_controller(&linear_pose_controller);
-
-    // Linear speed loop meta controller (speed filter + anti-blocking + speed controller)
-    linear_speed_loop_meta_controller.add_controller(&linear_speed_filter);
-    linear_speed_loop_meta_controller.add_controller(&linear_anti_blocking_controller);
-    linear_speed_loop_meta_controller.add_controller(&linear_speed_controller);
-
-    // Angular pose loop meta controller (pose controller only, executed at reduced frequency)
-    angular_pose_loop_meta_controller.add_controller(&angular_pose_controller);
-
-    // Angular speed loop meta controller (speed filter + anti-blocking + speed controller)
-    angular_speed_loop_meta_controller.add_controller(&angular_speed_filter);
-    angular_speed_loop_meta_controller.add_controller(&angular_anti_blocking_controller);
-    angular_speed_loop_meta_controller.add_controller(&angular_speed_controller);
+    // Pose and speed loop meta controllers are StaticMetaController, composed
+    // at build time in quadpid_chain.hpp
 
     // Pose loop PolarParallelMetaController (pose controllers only)
     // --> Linear pose loop meta controller
@@ -42,25 +29,22 @@ cogip::motion_control::QuadPIDMetaController* init()
     pose_loop_polar_parallel_meta_controller.add_controller(&linear_pose_loop_meta_controller);
     pose_loop_polar_parallel_meta_controller.add_controller(&angular_pose_loop_meta_controller);
 
-    // Pose loop meta controller (pose_straight_filter + deceleration filters + pose loop polar
-    // parallel) PoseStraightFilter -> DecelerationFilters -> Pose loop PolarParallelMetaController
-    pose_loop_meta_controller.add_controller(&pose_straight_filter);
-    pose_loop_meta_controller.add_controller(&linear_deceleration_filter);
-    pose_loop_meta_controller.add_controller(&angular_deceleration_filter);
-    pose_loop_meta_controller.add_controller(&pose_loop_polar_parallel_meta_controller);
-
     // Speed loop PolarParallelMetaController (speed controllers only)
     // --> Linear speed loop meta controller
     // `-> Angular speed loop meta controller
     speed_loop_polar_parallel_meta_controller.add_controller(&linear_speed_loop_meta_controller);
     speed_loop_polar_parallel_meta_controller.add_controller(&angular_speed_loop_meta_controller);
 
+    // Pose loop executed every quadpid_pose_controllers_throttle_divider cycles
+    pose_loop_scheduler.add_controller(&pose_loop_meta_controller,
+                                       quadpid_pose_controllers_throttle_divider, 0);
+
     // QuadPIDMetaController:
-    // PathManagerFilter -> TargetChangeDetector -> ThrottledController(pose_loop_meta_controller,
-    // 10) -> Speed loop
+    // PathManagerFilter -> TargetChangeDetector -> RateGroupScheduler(pose_loop_meta_controller)
+    // -> Speed loop
     quadpid_meta_controller.add_controller(&path_manager_filter);
     quadpid_meta_controller.add_controller(&target_change_detector);
-    quadpid_meta_controller.add_controller(&throttled_pose_loop_controllers);
+    quadpid_meta_controller.add_controller(&pose_loop_scheduler);
     quadpid_meta_controller.add_controller(&speed_loop_polar_parallel_meta_controller);
 
     return &quadpid_meta_controller;
@@ -16,7 +16,8 @@
 #include "deceleration_filter/DecelerationFilterParameters.hpp"
 #include "motion_control.hpp"
 #include "motion_control_common/MetaController.hpp"
-#include "motion_control_common/ThrottledController.hpp"
+#include "motion_control_common/RateGroupScheduler.hpp"
+#include "motion_control_common/StaticMetaController.hpp"
 #include "passthrough_pose_pid_controller/PassthroughPosePIDController.hpp"
 #include "passthrough_pose_pid_controller/PassthroughPosePIDControllerIOKeysDefault.hpp"
 #include "passthrough_pose_pid_controller/PassthroughPosePIDControllerParameters.hpp"
@@ -35,6 +36,9 @@
 #include "speed_filter/SpeedFilter.hpp"
 #include "speed_filter/SpeedFilterIOKeysDefault.hpp"
 #include "speed_filter/SpeedFilterParameters.hpp"
+#include "speed_observer_filter/SpeedObserverFilter.hpp"
+#include "speed_observer_filter/SpeedObserverFilterIOKeysDefault.hpp"
+#include "speed_observer_filter/SpeedObserverFilterParameters.hpp"
 #include "speed_pid_controller/SpeedPIDController.hpp"
 #include "speed_pid_controller/SpeedPIDControllerIOKeysDefault.hpp"
 #include "speed_pid_controller/SpeedPIDControllerParameters.hpp"
@@ -89,7 +93,8 @@ inline constexpr cogip::motion_control::PathManagerFilterIOKeys path_manager_fil
     .path_index = "path_index",
     .bypass_final_orientation = "bypass_final_orientation",
     .motion_direction = "motion_direction",
-    .is_intermediate = "is_intermediate"};
+    .is_intermediate = "is_intermediate",
+    .final_speed = "final_speed"}; // Always 0: no velocity look-ahead without profiles
 
 inline cogip::motion_control::PathManagerFilterParameters path_manager_filter_parameters;
 
@@ -122,8 +127,8 @@ inline cogip::motion_control::TargetChangeDetector<5>
 // ============================================================================
 
 inline cogip::motion_control::PoseStraightFilterParameters pose_straight_filter_parameters(
-    angular_threshold, linear_threshold, angular_intermediate_threshold,
-    platform_max_dec_angular_deg_per_period2, platform_max_dec_linear_mm_per_period2,
+    platform_angular_threshold_rad, linear_threshold, platform_angular_intermediate_threshold_rad,
+    platform_max_dec_angular_rad_per_period2, platform_max_dec_linear_mm_per_period2,
     false, // bypass_final_orientation
     false  // use_angle_continuity (not needed for direct PID control)
 );
@@ -158,7 +163,7 @@ inline cogip::motion_control::DecelerationFilterIOKeys angular_deceleration_filt
 };
 
 inline cogip::motion_control::DecelerationFilterParameters
-    angular_deceleration_filter_parameters(platform_max_dec_angular_deg_per_period2);
+    angular_deceleration_filter_parameters(platform_max_dec_angular_rad_per_period2);
 
 inline cogip::motion_control::DecelerationFilter
     angular_deceleration_filter(angular_deceleration_filter_io_keys,
@@ -168,16 +173,29 @@ inline cogip::motion_control::DecelerationFilter
 // MetaControllers
 // ============================================================================
 
-inline cogip::motion_control::MetaController<> pose_loop_meta_controller;
 inline cogip::motion_control::PolarParallelMetaController pose_loop_polar_parallel_meta_controller;
 inline cogip::motion_control::PolarParallelMetaController speed_loop_polar_parallel_meta_controller;
 
 // ============================================================================
-// Linear chain
+// Speed observers (speed loops read the observed speed instead of the
+// quantized encoder pose delta)
 // ============================================================================
 
-inline cogip::motion_control::MetaController<> linear_pose_loop_meta_controller;
-inline cogip::motion_control::MetaController<> linear_speed_loop_meta_controller;
+inline cogip::motion_control::SpeedObserverFilterParameters
+    speed_observer_filter_parameters(param_speed_observer_bandwidth_hz,
+                                     motion_control_thread_period_ms);
+
+inline cogip::motion_control::SpeedObserverFilter linear_speed_observer_filter(
+    cogip::motion_control::linear_speed_observer_filter_io_keys_default,
+    speed_observer_filter_parameters);
+
+inline cogip::motion_control::SpeedObserverFilter angular_speed_observer_filter(
+    cogip::motion_control::angular_speed_observer_filter_io_keys_default,
+    speed_observer_filter_parameters);
+
+// ============================================================================
+// Linear chain
+// ============================================================================
 
 inline cogip::motion_control::PosePIDControllerParameters
     linear_pose_controller_parameters(&linear_pose_pid);
@@ -190,24 +208,33 @@ inline cogip::motion_control::SpeedFilterParameters linear_speed_filter_paramete
     platform_min_speed_linear_mm_per_period, platform_max_speed_linear_mm_per_period,
     platform_max_acc_linear_mm_per_period2, platform_max_dec_linear_mm_per_period2);
 
-inline cogip::motion_control::SpeedFilter
-    linear_speed_filter(cogip::motion_control::linear_speed_filter_io_keys_default,
-                        linear_speed_filter_parameters);
+inline cogip::motion_control::SpeedFilterIOKeys linear_speed_filter_io_keys = {
+    .speed_order = "linear_speed_order",
+    .current_speed = "linear_observed_speed",
+    .target_speed = "linear_target_speed",
+    .speed_error = "linear_speed_error",
+    .bypass_filter = "linear_speed_filter_flag",
+};
+
+inline cogip::motion_control::SpeedFilter linear_speed_filter(linear_speed_filter_io_keys,
+                                                              linear_speed_filter_parameters);
 
 inline cogip::motion_control::SpeedPIDControllerParameters
     linear_speed_controller_parameters(&linear_speed_pid);
 
+inline cogip::motion_control::SpeedPIDControllerIOKeys linear_speed_controller_io_keys = {
+    .speed_order = "linear_speed_order",
+    .current_speed = "linear_observed_speed",
+    .speed_command = "linear_speed_command",
+    .reset = "linear_speed_pid_reset"};
+
 inline cogip::motion_control::SpeedPIDController
-    linear_speed_controller(cogip::motion_control::linear_speed_pid_controller_io_keys_default,
-                            linear_speed_controller_parameters);
+    linear_speed_controller(linear_speed_controller_io_keys, linear_speed_controller_parameters);
 
 // ============================================================================
 // Angular chain
 // ============================================================================
 
-inline cogip::motion_control::MetaController<> angular_pose_loop_meta_controller;
-inline cogip::motion_control::MetaController<> angular_speed_loop_meta_controller;
-
 inline cogip::motion_control::PosePIDControllerParameters
     angular_pose_controller_parameters(&angular_pose_pid);
 
@@ -216,27 +243,31 @@ inline cogip::motion_control::PosePIDController
                             angular_pose_controller_parameters);
 
 inline cogip::motion_control::SpeedFilterParameters angular_speed_filter_parameters(
-    platform_min_speed_angular_deg_per_period, platform_max_speed_angular_deg_per_period,
-    platform_max_acc_angular_deg_per_period2, platform_max_dec_angular_deg_per_period2);
+    platform_min_speed_angular_rad_per_period, platform_max_speed_angular_rad_per_period,
+    platform_max_acc_angular_rad_per_period2, platform_max_dec_angular_rad_per_period2);
+
+inline cogip::motion_control::SpeedFilterIOKeys angular_speed_filter_io_keys = {
+    .speed_order = "angular_speed_order",
+    .current_speed = "angular_observed_speed",
+    .target_speed = "angular_target_speed",
+    .speed_error = "angular_speed_error",
+    .bypass_filter = "angular_speed_filter_flag",
+};
 
-inline cogip::motion_control::SpeedFilter
-    angular_speed_filter(cogip::motion_control::angular_speed_filter_io_keys_default,
-                         angular_speed_filter_parameters);
+inline cogip::motion_control::SpeedFilter angular_speed_filter(angular_speed_filter_io_keys,
+                                                               angular_speed_filter_parameters);
 
 inline cogip::motion_control::SpeedPIDControllerParameters
     angular_speed_controller_parameters(&angular_speed_pid);
 
-inline cogip::motion_control::SpeedPIDController
-    angular_speed_controller(cogip::motion_control::angular_speed_pid_controller_io_keys_default,
-                             angular_speed_controller_parameters);
-
-// ============================================================================
-// Throttled controller
-// ============================================================================
+inline cogip::motion_control::SpeedPIDControllerIOKeys angular_speed_controller_io_keys = {
+    .speed_order = "angular_speed_order",
+    .current_speed = "angular_observed_speed",
+    .speed_command = "angular_speed_command",
+    .reset = "angular_speed_pid_reset"};
 
-inline cogip::motion_control::ThrottledController
-    throttled_pose_loop_controllers(&pose_loop_meta_controller,
-                                    quadpid_pose_controllers_throttle_divider);
+inline cogip::motion_control::SpeedPIDController
+    angular_speed_controller(angular_speed_controller_io_keys, angular_speed_controller_parameters);
 
 // ============================================================================
 // Passthrough controllers (for test modes)
@@ -250,7 +281,7 @@ inline cogip::motion_control::PassthroughPosePIDController passthrough_linear_po
     passthrough_linear_pose_controller_parameters);
 
 inline cogip::motion_control::PassthroughPosePIDControllerParameters
-    passthrough_angular_pose_controller_parameters(platform_max_speed_angular_deg_per_period, true);
+    passthrough_angular_pose_controller_parameters(platform_max_speed_angular_rad_per_period, true);
 
 inline cogip::motion_control::PassthroughPosePIDController passthrough_angular_pose_controller(
     cogip::motion_control::angular_passthrough_pose_pid_controller_io_keys_default,
@@ -262,7 +293,7 @@ inline cogip::motion_control::PassthroughPosePIDController passthrough_angular_p
 
 inline cogip::motion_control::AntiBlockingControllerIOKeys linear_anti_blocking_io_keys = {
     .speed_order = "linear_speed_order",
-    .current_speed = "linear_current_speed",
+    .current_speed = "linear_observed_speed",
     .speed_error = "linear_speed_error",
     .pose_reached = "pose_reached"};
 
@@ -277,7 +308,7 @@ inline cogip::motion_control::AntiBlockingController
 
 inline cogip::motion_control::AntiBlockingControllerIOKeys angular_anti_blocking_io_keys = {
     .speed_order = "angular_speed_order",
-    .current_speed = "angular_current_speed",
+    .current_speed = "angular_observed_speed",
     .speed_error = "angular_speed_error",
     .pose_reached = "pose_reached"};
 
@@ -292,6 +323,37 @@ inline cogip::motion_control::AntiBlockingController
     angular_anti_blocking_controller(angular_anti_blocking_io_keys,
                                      angular_anti_blocking_parameters);
 
+// ============================================================================
+// Static meta controllers (chains fixed at build time)
+// ============================================================================
+
+// Pose loops: pose controller only, executed at reduced frequency
+inline cogip::motion_control::StaticMetaController
+    linear_pose_loop_meta_controller(linear_pose_controller);
+inline cogip::motion_control::StaticMetaController
+    angular_pose_loop_meta_controller(angular_pose_controller);
+
+// Speed loops: speed observer + speed filter + anti-blocking + speed controller
+inline cogip::motion_control::StaticMetaController
+    linear_speed_loop_meta_controller(linear_speed_observer_filter, linear_speed_filter,
+                                      linear_anti_blocking_controller, linear_speed_controller);
+inline cogip::motion_control::StaticMetaController
+    angular_speed_loop_meta_controller(angular_speed_observer_filter, angular_speed_filter,
+                                       angular_anti_blocking_controller,
+                                       angular_speed_controller);
+
+// Pose loop: PoseStraightFilter -> DecelerationFilters -> Pose loop PolarParallelMetaController
+inline cogip::motion_control::StaticMetaController
+    pose_loop_meta_controller(pose_straight_filter, linear_deceleration_filter,
+                              angular_deceleration_filter,
+                              pose_loop_polar_parallel_meta_controller);
+
+// ============================================================================
+// Pose loop rate group scheduler
+// ============================================================================
+
+inline cogip::motion_control::RateGroupScheduler pose_loop_scheduler("pose_loop");
+
 // ============================================================================
 // QuadPID meta controller
 // ============================================================================
@@ -315,6 +377,7 @@ inline void reset()
     // Reset all controllers via meta controller cascade
     // This will call reset() on each controller, which resets:
     // - PoseStraightFilter: state machine, prev_target, angular error tracking
+    // - SpeedObserverFilter: restarts from the measured speed
     // - SpeedFilter: previous speed order
     // - SpeedPIDController: PID integral term
     quadpid_meta_controller.reset();
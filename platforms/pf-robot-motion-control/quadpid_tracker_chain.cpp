@@ -17,7 +17,7 @@
 #include "profile_tracker_controller/ProfileTrackerControllerIOKeys.hpp"
 #include "profile_tracker_controller/ProfileTrackerControllerParameters.hpp"
 #include "speed_pid_controller/SpeedPIDController.hpp"
-#include "speed_pid_controller/SpeedPIDControllerIOKeysDefault.hpp"
+#include "speed_pid_controller/SpeedPIDControllerIOKeys.hpp"
 #include "speed_pid_controller/SpeedPIDControllerParameters.hpp"
 #include "telemetry_controller/TelemetryController.hpp"
 #include "telemetry_controller/TelemetryControllerIOKeysDefault.hpp"
@@ -76,12 +76,20 @@ cogip::motion_control::QuadPIDMetaController* init()
 
     // =========================================================================
     // QuadPIDTrackerMetaController:
-    // PathManagerFilter -> PoseStraightFilter -> Pose loops -> AntiBlocking
+    // PathManagerFilter -> PoseStraightFilter -> ProfileSync -> SpeedObservers -> Pose loops ->
+    // AntiBlocking
     // (Safety filters are now inside tracker chains, before SpeedPID)
     // =========================================================================
     quadpid_tracker_meta_controller.add_controller(&path_manager_filter);
     quadpid_tracker_meta_controller.add_controller(&target_change_detector);
     quadpid_tracker_meta_controller.add_controller(&pose_straight_filter);
+    quadpid_tracker_meta_controller.add_controller(&profile_sync_controller);
+
+    // Speed observers run every cycle, ahead of the speed PIDs and anti-blocking
+    speed_observer_polar_parallel_meta_controller.add_controller(&linear_speed_observer_filter);
+    speed_observer_polar_parallel_meta_controller.add_controller(&angular_speed_observer_filter);
+    quadpid_tracker_meta_controller.add_controller(&speed_observer_polar_parallel_meta_controller);
+
     quadpid_tracker_meta_controller.add_controller(&pose_loop_polar_parallel_meta_controller);
 
     // Add anti-blocking controllers (common to all configurations)
@@ -90,9 +98,10 @@ cogip::motion_control::QuadPIDMetaController* init()
     speed_loop_polar_parallel_meta_controller.add_controller(&angular_anti_blocking_controller);
     quadpid_tracker_meta_controller.add_controller(&speed_loop_polar_parallel_meta_controller);
 
-    // Add telemetry controllers for pose data
-    quadpid_tracker_meta_controller.add_controller(&linear_telemetry_controller);
-    quadpid_tracker_meta_controller.add_controller(&angular_telemetry_controller);
+    // Add telemetry controllers for pose data, spread on alternate cycles
+    telemetry_scheduler.add_controller(&linear_telemetry_controller, telemetry_rate_divider);
+    telemetry_scheduler.add_controller(&angular_telemetry_controller, telemetry_rate_divider);
+    quadpid_tracker_meta_controller.add_controller(&telemetry_scheduler);
 
     return &quadpid_tracker_meta_controller;
 }
@@ -21,6 +21,7 @@
 #include "deceleration_filter/DecelerationFilterParameters.hpp"
 #include "motion_control.hpp"
 #include "motion_control_common/MetaController.hpp"
+#include "motion_control_common/RateGroupScheduler.hpp"
 #include "parameter/Parameter.hpp"
 #include "path_manager_filter/PathManagerFilter.hpp"
 #include "path_manager_filter/PathManagerFilterIOKeys.hpp"
@@ -33,6 +34,9 @@
 #include "pose_straight_filter/PoseStraightFilter.hpp"
 #include "pose_straight_filter/PoseStraightFilterIOKeysDefault.hpp"
 #include "pose_straight_filter/PoseStraightFilterParameters.hpp"
+#include "profile_sync_controller/ProfileSyncController.hpp"
+#include "profile_sync_controller/ProfileSyncControllerIOKeys.hpp"
+#include "profile_sync_controller/ProfileSyncControllerParameters.hpp"
 #include "profile_tracker_controller/ProfileTrackerController.hpp"
 #include "profile_tracker_controller/ProfileTrackerControllerIOKeys.hpp"
 #include "profile_tracker_controller/ProfileTrackerControllerParameters.hpp"
@@ -40,8 +44,11 @@
 #include "speed_limit_filter/SpeedLimitFilter.hpp"
 #include "speed_limit_filter/SpeedLimitFilterIOKeys.hpp"
 #include "speed_limit_filter/SpeedLimitFilterParameters.hpp"
+#include "speed_observer_filter/SpeedObserverFilter.hpp"
+#include "speed_observer_filter/SpeedObserverFilterIOKeysDefault.hpp"
+#include "speed_observer_filter/SpeedObserverFilterParameters.hpp"
 #include "speed_pid_controller/SpeedPIDController.hpp"
-#include "speed_pid_controller/SpeedPIDControllerIOKeysDefault.hpp"
+#include "speed_pid_controller/SpeedPIDControllerIOKeys.hpp"
 #include "speed_pid_controller/SpeedPIDControllerParameters.hpp"
 #include "target_change_detector/TargetChangeDetector.hpp"
 #include "telemetry_controller/TelemetryController.hpp"
@@ -101,9 +108,22 @@ inline constexpr cogip::motion_control::PathManagerFilterIOKeys path_manager_fil
     .path_index = "path_index",
     .bypass_final_orientation = "bypass_final_orientation",
     .motion_direction = "motion_direction",
-    .is_intermediate = "is_intermediate"};
-
-inline cogip::motion_control::PathManagerFilterParameters path_manager_filter_parameters;
+    .is_intermediate = "is_intermediate",
+    .current_pose_x = "current_pose_x",
+    .current_pose_y = "current_pose_y",
+    .final_speed = "final_speed"};
+
+/// Junction speeds planned over path waypoints: straight enough waypoints (turn below
+/// angular_intermediate_threshold, passed without rotating in place) are passed at a speed
+/// keeping within linear_threshold of the waypoint
+inline cogip::motion_control::PathManagerFilterParameters path_manager_filter_parameters(
+    cogip::path::Path::MAX_WAYPOINTS,
+    platform_max_speed_linear_mm_per_period,    // max_speed
+    platform_max_acc_linear_mm_per_period2,     // acceleration
+    platform_max_dec_linear_mm_per_period2,     // deceleration
+    linear_threshold,                           // junction_deviation
+    platform_angular_intermediate_threshold_rad // max_junction_angle
+);
 
 inline cogip::motion_control::PathManagerFilter path_manager_filter(path_manager_filter_io_keys,
                                                                     path_manager_filter_parameters,
@@ -115,10 +135,11 @@ inline cogip::motion_control::PathManagerFilter path_manager_filter(path_manager
 
 /// Local parameters for PoseStraightFilter (independent from quadpid_chain)
 inline cogip::motion_control::PoseStraightFilterParameters pose_straight_filter_parameters(
-    angular_threshold, linear_threshold, angular_intermediate_threshold,
-    platform_max_dec_angular_deg_per_period2, platform_max_dec_linear_mm_per_period2,
+    platform_angular_threshold_rad, linear_threshold, platform_angular_intermediate_threshold_rad,
+    platform_max_dec_angular_rad_per_period2, platform_max_dec_linear_mm_per_period2,
     false, // bypass_final_orientation
-    true   // use_angle_continuity (required for ProfileTracker)
+    true,  // use_angle_continuity (required for ProfileTracker)
+    true   // continuous_replanning
 );
 
 inline cogip::motion_control::PoseStraightFilter
@@ -159,7 +180,10 @@ inline cogip::motion_control::ProfileTrackerControllerIOKeys linear_profile_trac
     .tracker_velocity = "linear_tracker_velocity",
     .tracking_error = "linear_tracking_error",
     .profile_complete = "", // Not used, PoseStraightFilter handles pose_reached
-    .target_speed = "linear_target_speed"};
+    .target_speed = "linear_target_speed",
+    .final_speed = "linear_final_speed",
+    .sync_periods = "profile_sync_periods",
+    .replan_profile = "replan_profile"};
 
 /// Linear ProfileTrackerController parameters
 inline cogip::motion_control::ProfileTrackerControllerParameters
@@ -185,13 +209,15 @@ inline cogip::motion_control::ProfileTrackerControllerIOKeys angular_profile_tra
     .tracker_velocity = "angular_tracker_velocity",
     .tracking_error = "angular_tracking_error",
     .profile_complete = "", // Not used, PoseStraightFilter handles pose_reached
-    .target_speed = "angular_target_speed"};
+    .target_speed = "angular_target_speed",
+    .sync_periods = "profile_sync_periods",
+    .replan_profile = "replan_profile"};
 
 /// Angular ProfileTrackerController parameters
 inline cogip::motion_control::ProfileTrackerControllerParameters angular_profile_tracker_parameters(
-    platform_max_speed_angular_deg_per_period, // max_speed
-    platform_max_acc_angular_deg_per_period2,  // acceleration
-    platform_max_dec_angular_deg_per_period2,  // deceleration (same as acc for angular)
+    platform_max_speed_angular_rad_per_period, // max_speed
+    platform_max_acc_angular_rad_per_period2,  // acceleration
+    platform_max_dec_angular_rad_per_period2,  // deceleration (same as acc for angular)
     true,                                      // must_stop_at_end
     1                                          // period_increment
 );
@@ -201,6 +227,32 @@ inline cogip::motion_control::ProfileTrackerController
     angular_profile_tracker_controller(angular_profile_tracker_io_keys,
                                        angular_profile_tracker_parameters);
 
+// ============================================================================
+// ProfileSyncController
+// ============================================================================
+
+/// Linear and angular profiles generated together share the same duration, read with the
+/// same keys as the trackers
+inline constexpr cogip::motion_control::ProfileSyncControllerIOKeys profile_sync_io_keys = {
+    .linear_pose_error = "linear_pose_error",
+    .linear_current_speed = "linear_speed_order",
+    .linear_recompute_profile = "linear_recompute_profile",
+    .linear_target_speed = "linear_target_speed",
+    .linear_final_speed = "linear_final_speed",
+    .angular_pose_error = "angular_pose_error",
+    .angular_current_speed = "angular_speed_order",
+    .angular_recompute_profile = "angular_recompute_profile",
+    .angular_target_speed = "angular_target_speed",
+    .replan_profile = "replan_profile",
+    .sync_periods = "profile_sync_periods"};
+
+inline cogip::motion_control::ProfileSyncControllerParameters
+    profile_sync_parameters(&linear_profile_tracker_controller,
+                            &angular_profile_tracker_controller);
+
+inline cogip::motion_control::ProfileSyncController profile_sync_controller(profile_sync_io_keys,
+                                                                            profile_sync_parameters);
+
 // ============================================================================
 // TrackerCombinerController instances
 // ============================================================================
@@ -239,6 +291,42 @@ inline cogip::motion_control::TrackerCombinerController
     angular_tracker_combiner_controller(angular_tracker_combiner_io_keys,
                                         angular_tracker_combiner_parameters);
 
+// ============================================================================
+// Speed observers (speed loops read the observed speed instead of the
+// quantized encoder pose delta, same as the QUADPID chain)
+// ============================================================================
+
+inline cogip::motion_control::SpeedObserverFilterParameters
+    speed_observer_filter_parameters(param_speed_observer_bandwidth_hz,
+                                     motion_control_thread_period_ms);
+
+inline cogip::motion_control::SpeedObserverFilter linear_speed_observer_filter(
+    cogip::motion_control::linear_speed_observer_filter_io_keys_default,
+    speed_observer_filter_parameters);
+
+inline cogip::motion_control::SpeedObserverFilter angular_speed_observer_filter(
+    cogip::motion_control::angular_speed_observer_filter_io_keys_default,
+    speed_observer_filter_parameters);
+
+inline cogip::motion_control::PolarParallelMetaController
+    speed_observer_polar_parallel_meta_controller;
+
+// ============================================================================
+// SpeedPIDController IO keys (feedback from the speed observers)
+// ============================================================================
+
+inline cogip::motion_control::SpeedPIDControllerIOKeys linear_speed_controller_io_keys = {
+    .speed_order = "linear_speed_order",
+    .current_speed = "linear_observed_speed",
+    .speed_command = "linear_speed_command",
+    .reset = "linear_speed_pid_reset"};
+
+inline cogip::motion_control::SpeedPIDControllerIOKeys angular_speed_controller_io_keys = {
+    .speed_order = "angular_speed_order",
+    .current_speed = "angular_observed_speed",
+    .speed_command = "angular_speed_command",
+    .reset = "angular_speed_pid_reset"};
+
 // ============================================================================
 // SpeedPIDController parameters (use local tracker PIDs)
 // ============================================================================
@@ -257,13 +345,11 @@ inline cogip::motion_control::SpeedPIDControllerParameters
 
 /// Linear SpeedPIDController (uses local tracker PID)
 inline cogip::motion_control::SpeedPIDController linear_tracker_speed_controller(
-    cogip::motion_control::linear_speed_pid_controller_io_keys_default,
-    linear_tracker_speed_controller_parameters);
+    linear_speed_controller_io_keys, linear_tracker_speed_controller_parameters);
 
 /// Angular SpeedPIDController (uses local tracker PID)
 inline cogip::motion_control::SpeedPIDController angular_tracker_speed_controller(
-    cogip::motion_control::angular_speed_pid_controller_io_keys_default,
-    angular_tracker_speed_controller_parameters);
+    angular_speed_controller_io_keys, angular_tracker_speed_controller_parameters);
 
 // ============================================================================
 // Linear tracker chain SpeedPIDController
@@ -274,8 +360,7 @@ inline cogip::motion_control::SpeedPIDControllerParameters linear_tracker_chain_
     &tracker_linear_speed_pid};
 
 inline cogip::motion_control::SpeedPIDController linear_tracker_chain_speed{
-    cogip::motion_control::linear_speed_pid_controller_io_keys_default,
-    linear_tracker_chain_speed_params};
+    linear_speed_controller_io_keys, linear_tracker_chain_speed_params};
 
 // ============================================================================
 // Linear tracker chain MetaController
@@ -313,8 +398,7 @@ inline cogip::motion_control::SpeedPIDControllerParameters angular_tracker_chain
     &tracker_angular_speed_pid};
 
 inline cogip::motion_control::SpeedPIDController angular_tracker_chain_speed{
-    cogip::motion_control::angular_speed_pid_controller_io_keys_default,
-    angular_tracker_chain_speed_params};
+    angular_speed_controller_io_keys, angular_tracker_chain_speed_params};
 
 // ============================================================================
 // Angular tracker chain MetaController
@@ -355,7 +439,7 @@ inline cogip::motion_control::TargetChangeDetector<5>
 
 inline cogip::motion_control::AntiBlockingControllerIOKeys linear_anti_blocking_io_keys = {
     .speed_order = "linear_speed_order",
-    .current_speed = "linear_current_speed",
+    .current_speed = "linear_observed_speed",
     .speed_error = "linear_speed_error",
     .pose_reached = "pose_reached"};
 
@@ -370,7 +454,7 @@ inline cogip::motion_control::AntiBlockingController
 
 inline cogip::motion_control::AntiBlockingControllerIOKeys angular_anti_blocking_io_keys = {
     .speed_order = "angular_speed_order",
-    .current_speed = "angular_current_speed",
+    .current_speed = "angular_observed_speed",
     .speed_error = "angular_speed_error",
     .pose_reached = "pose_reached"};
 
@@ -403,8 +487,8 @@ inline cogip::motion_control::SpeedLimitFilterIOKeys angular_speed_limit_io_keys
     .target_speed = "angular_speed_order", .output_speed = ""};
 
 inline cogip::motion_control::SpeedLimitFilterParameters
-angular_speed_limit_parameters(platform_min_speed_angular_deg_per_period,
-                               platform_max_speed_angular_deg_per_period* speed_clamp_ratio);
+angular_speed_limit_parameters(platform_min_speed_angular_rad_per_period,
+                               platform_max_speed_angular_rad_per_period* speed_clamp_ratio);
 
 inline cogip::motion_control::SpeedLimitFilter
     angular_speed_limit_filter(angular_speed_limit_io_keys, angular_speed_limit_parameters);
@@ -427,8 +511,8 @@ inline cogip::motion_control::AccelerationFilterIOKeys angular_acceleration_io_k
     .target_speed = "angular_speed_order"};
 
 inline cogip::motion_control::AccelerationFilterParameters
-angular_acceleration_parameters(platform_max_acc_angular_deg_per_period2* acceleration_clamp_ratio,
-                                platform_min_speed_angular_deg_per_period);
+angular_acceleration_parameters(platform_max_acc_angular_rad_per_period2* acceleration_clamp_ratio,
+                                platform_min_speed_angular_rad_per_period);
 
 inline cogip::motion_control::AccelerationFilter
     angular_acceleration_filter(angular_acceleration_io_keys, angular_acceleration_parameters);
@@ -439,8 +523,9 @@ inline cogip::motion_control::AccelerationFilter
 
 inline cogip::motion_control::TelemetryControllerParameters linear_telemetry_controller_parameters{
     .loop_period_ms = motion_control_thread_period_ms};
+/// Angular telemetry is reported in degrees
 inline cogip::motion_control::TelemetryControllerParameters angular_telemetry_controller_parameters{
-    .loop_period_ms = motion_control_thread_period_ms};
+    .loop_period_ms = motion_control_thread_period_ms, .unit_scale = RAD2DEG(1.0f)};
 
 inline cogip::motion_control::TelemetryController
     linear_telemetry_controller(cogip::motion_control::linear_telemetry_controller_io_keys_default,
@@ -450,6 +535,12 @@ inline cogip::motion_control::TelemetryController angular_telemetry_controller(
     cogip::motion_control::angular_telemetry_controller_io_keys_default,
     angular_telemetry_controller_parameters);
 
+// ============================================================================
+// Telemetry rate group scheduler
+// ============================================================================
+
+inline cogip::motion_control::RateGroupScheduler telemetry_scheduler("telemetry");
+
 // ============================================================================
 // QuadPIDMetaController for tracker chain
 // ============================================================================
@@ -27,7 +27,7 @@ static void* _thread_pose(void* arg)
     (void)arg;
 
     // Init loop iteration start time
-    ztimer_now_t loop_start_time = ztimer_now(ZTIMER_MSEC);
+    ztimer_now_t loop_start_time = cogip::thread::thread_ztimer_now(ZTIMER_MSEC);
 
     while (true) {
         if (pf_trace_on()) {
@@ -47,7 +47,7 @@ static void* _thread_state(void* arg)
     (void)arg;
 
     // Init loop iteration start time
-    ztimer_now_t loop_start_time = ztimer_now(ZTIMER_MSEC);
+    ztimer_now_t loop_start_time = cogip::thread::thread_ztimer_now(ZTIMER_MSEC);
 
     while (true) {
         if (pf_trace_on()) {
@@ -67,7 +67,7 @@ static void* _thread_telemetry(void* arg)
     (void)arg;
 
     // Init loop iteration start time
-    ztimer_now_t loop_start_time = ztimer_now(ZTIMER_MSEC);
+    ztimer_now_t loop_start_time = cogip::thread::thread_ztimer_now(ZTIMER_MSEC);
 
     while (true) {
         cogip::pf::motion_control::pf_send_encoder_telemetry();
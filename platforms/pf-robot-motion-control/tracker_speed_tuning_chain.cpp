@@ -25,13 +25,18 @@ namespace tracker_speed_tuning_chain {
 static cogip::motion_control::TelemetryControllerParameters telemetry_controller_parameters{
     .loop_period_ms = motion_control_thread_period_ms};
 
+/// Angular telemetry is reported in degrees
+static cogip::motion_control::TelemetryControllerParameters
+    angular_telemetry_controller_parameters{.loop_period_ms = motion_control_thread_period_ms,
+                                            .unit_scale = RAD2DEG(1.0f)};
+
 static cogip::motion_control::TelemetryController
     linear_telemetry_controller(cogip::motion_control::linear_telemetry_controller_io_keys_default,
                                 telemetry_controller_parameters);
 
 static cogip::motion_control::TelemetryController angular_telemetry_controller(
     cogip::motion_control::angular_telemetry_controller_io_keys_default,
-    telemetry_controller_parameters);
+    angular_telemetry_controller_parameters);
 
 // ============================================================================
 // Initialization function
@@ -39,13 +44,17 @@ static cogip::motion_control::TelemetryController angular_telemetry_controller(
 
 cogip::motion_control::MetaController<>* init()
 {
-    // Linear speed loop: TargetChangeDetector -> ProfileTracker -> SpeedPID -> TrackerCombiner
+    // Linear speed loop: SpeedObserver -> TargetChangeDetector -> ProfileTracker -> SpeedPID ->
+    // TrackerCombiner
+    linear_meta_controller.add_controller(&linear_speed_observer_filter);
     linear_meta_controller.add_controller(&linear_target_change_detector);
     linear_meta_controller.add_controller(&linear_profile_tracker_controller);
     linear_meta_controller.add_controller(&linear_speed_controller);
     linear_meta_controller.add_controller(&linear_tracker_combiner_controller);
 
-    // Angular speed loop: TargetChangeDetector -> ProfileTracker -> SpeedPID -> TrackerCombiner
+    // Angular speed loop: SpeedObserver -> TargetChangeDetector -> ProfileTracker -> SpeedPID ->
+    // TrackerCombiner
+    angular_meta_controller.add_controller(&angular_speed_observer_filter);
     angular_meta_controller.add_controller(&angular_target_change_detector);
     angular_meta_controller.add_controller(&angular_profile_tracker_controller);
     angular_meta_controller.add_controller(&angular_speed_controller);
@@ -8,8 +8,10 @@
 /// @details Chain for tuning the tracker's speed PIDs with trapezoidal velocity profiles.
 ///          Runs linear and angular loops in parallel via PolarParallelMetaController.
 ///          The handler writes target_speed + duration into IO.
-///          Each axis: TargetChangeDetector -> ProfileTrackerController(speed_mode) ->
-///                     SpeedPIDController -> TrackerCombinerController
+///          Each axis: SpeedObserverFilter -> TargetChangeDetector ->
+///                     ProfileTrackerController(speed_mode) -> SpeedPIDController ->
+///                     TrackerCombinerController
+///          The speed PIDs read the observed speed, as in the tracker chain they are tuned for.
 
 #pragma once
 
@@ -17,6 +19,9 @@
 #include "motion_control_common/MetaController.hpp"
 #include "polar_parallel_meta_controller/PolarParallelMetaController.hpp"
 #include "profile_tracker_controller/ProfileTrackerController.hpp"
+#include "speed_observer_filter/SpeedObserverFilter.hpp"
+#include "speed_observer_filter/SpeedObserverFilterIOKeysDefault.hpp"
+#include "speed_observer_filter/SpeedObserverFilterParameters.hpp"
 #include "speed_pid_controller/SpeedPIDController.hpp"
 #include "speed_pid_controller/SpeedPIDControllerIOKeys.hpp"
 #include "target_change_detector/TargetChangeDetector.hpp"
@@ -29,6 +34,22 @@ namespace pf {
 namespace motion_control {
 namespace tracker_speed_tuning_chain {
 
+// ============================================================================
+// Speed observers (same feedback as the tracker chain speed loops)
+// ============================================================================
+
+inline cogip::motion_control::SpeedObserverFilterParameters
+    speed_observer_filter_parameters(param_speed_observer_bandwidth_hz,
+                                     motion_control_thread_period_ms);
+
+inline cogip::motion_control::SpeedObserverFilter linear_speed_observer_filter(
+    cogip::motion_control::linear_speed_observer_filter_io_keys_default,
+    speed_observer_filter_parameters);
+
+inline cogip::motion_control::SpeedObserverFilter angular_speed_observer_filter(
+    cogip::motion_control::angular_speed_observer_filter_io_keys_default,
+    speed_observer_filter_parameters);
+
 // ============================================================================
 // LINEAR PID (uses tracker parameters for tuning)
 // ============================================================================
@@ -95,7 +116,7 @@ inline cogip::motion_control::ProfileTrackerController
 
 inline cogip::motion_control::SpeedPIDControllerIOKeys linear_speed_pid_io_keys = {
     .speed_order = "linear_tracker_velocity",
-    .current_speed = "linear_current_speed",
+    .current_speed = "linear_observed_speed",
     .speed_command = "linear_speed_feedback"};
 
 inline cogip::motion_control::SpeedPIDController
@@ -141,9 +162,9 @@ inline cogip::motion_control::ProfileTrackerControllerIOKeys angular_profile_tra
     .duration_periods = "timeout_duration_period"};
 
 inline cogip::motion_control::ProfileTrackerControllerParameters
-    angular_profile_tracker_parameters(platform_max_speed_angular_deg_per_period,
-                                       platform_max_acc_angular_deg_per_period2,
-                                       platform_max_dec_angular_deg_per_period2,
+    angular_profile_tracker_parameters(platform_max_speed_angular_rad_per_period,
+                                       platform_max_acc_angular_rad_per_period2,
+                                       platform_max_dec_angular_rad_per_period2,
                                        true,  // must_stop_at_end
                                        1,     // period_increment
                                        true); // speed_mode
@@ -154,7 +175,7 @@ inline cogip::motion_control::ProfileTrackerController
 
 inline cogip::motion_control::SpeedPIDControllerIOKeys angular_speed_pid_io_keys = {
     .speed_order = "angular_tracker_velocity",
-    .current_speed = "angular_current_speed",
+    .current_speed = "angular_observed_speed",
     .speed_command = "angular_speed_feedback"};
 
 inline cogip::motion_control::SpeedPIDController
@@ -176,8 +197,8 @@ inline cogip::motion_control::TrackerCombinerController
 // Meta controllers
 // ============================================================================
 
-inline cogip::motion_control::MetaController<4> linear_meta_controller;
-inline cogip::motion_control::MetaController<4> angular_meta_controller;
+inline cogip::motion_control::MetaController<5> linear_meta_controller;
+inline cogip::motion_control::MetaController<5> angular_meta_controller;
 inline cogip::motion_control::PolarParallelMetaController polar_parallel_meta_controller;
 inline cogip::motion_control::MetaController<> meta_controller;
 
@@ -15,7 +15,7 @@
 #include "anti_blocking_controller/AntiBlockingController.hpp"
 #include "anti_blocking_controller/AntiBlockingControllerIOKeys.hpp"
 #include "anti_blocking_controller/AntiBlockingControllerParameters.hpp"
-#include "motion_control_common/MetaController.hpp"
+#include "motion_control_common/StaticMetaController.hpp"
 #include "pid/PID.hpp"
 #include "pid/PIDParameters.hpp"
 #include "pose_pid_controller/PosePIDController.hpp"
@@ -131,10 +131,44 @@ struct DualPIDTrackerChainParameters
 // ============================================================================
 
 /// @brief A complete DualPID Tracker Chain instance
-/// @details Contains all controllers needed for the tracker chain.
+/// @details Contains all controllers needed for the tracker chain, with their
+///          parameters: controllers keep a reference to them.
 ///          Each lift actuator should have its own instance of this structure.
 struct DualPIDTrackerChain
 {
+    /// @brief Build the chain in place: the meta controller references its members
+    /// @param params Configuration parameters for the chain
+    explicit DualPIDTrackerChain(const DualPIDTrackerChainParameters& params)
+        : profile_params(params.max_speed_mm_per_period, params.acceleration_mm_per_period2,
+                         params.deceleration_mm_per_period2,
+                         true, // must_stop_at_end
+                         1     // period_increment
+                         ),
+          pose_pid_params(params.pose_pid), speed_pid_params(params.speed_pid),
+          anti_blocking_params(params.anti_blocking_params),
+          profile_tracker(profile_tracker_io_keys, profile_params),
+          pose_pid(tracker_pose_pid_io_keys, pose_pid_params),
+          combiner(tracker_combiner_io_keys, combiner_params),
+          speed_pid(tracker_speed_pid_io_keys, speed_pid_params),
+          anti_blocking(anti_blocking_io_keys, anti_blocking_params)
+    {
+    }
+
+    /// @brief Profile tracker parameters
+    cogip::motion_control::ProfileTrackerControllerParameters profile_params;
+
+    /// @brief Pose PID parameters
+    cogip::motion_control::PosePIDControllerParameters pose_pid_params;
+
+    /// @brief Combiner parameters (empty)
+    cogip::motion_control::TrackerCombinerControllerParameters combiner_params;
+
+    /// @brief Speed PID parameters
+    cogip::motion_control::SpeedPIDControllerParameters speed_pid_params;
+
+    /// @brief Anti-blocking parameters
+    cogip::motion_control::AntiBlockingControllerParameters anti_blocking_params;
+
     /// @brief Profile tracker controller - generates trapezoidal velocity profile
     cogip::motion_control::ProfileTrackerController profile_tracker;
 
@@ -150,18 +184,12 @@ struct DualPIDTrackerChain
     /// @brief Anti-blocking controller - detects motor stall
     cogip::motion_control::AntiBlockingController anti_blocking;
 
-    /// @brief Meta controller chaining all controllers
-    cogip::motion_control::MetaController<> meta_controller;
-
-    /// @brief Initialize the chain by connecting controllers
-    void init()
-    {
-        meta_controller.add_controller(&profile_tracker);
-        meta_controller.add_controller(&pose_pid);
-        meta_controller.add_controller(&combiner);
-        meta_controller.add_controller(&speed_pid);
-        meta_controller.add_controller(&anti_blocking);
-    }
+    /// @brief Meta controller chaining all controllers, composed at construction
+    cogip::motion_control::StaticMetaController<
+        cogip::motion_control::ProfileTrackerController, cogip::motion_control::PosePIDController,
+        cogip::motion_control::TrackerCombinerController, cogip::motion_control::SpeedPIDController,
+        cogip::motion_control::AntiBlockingController>
+        meta_controller{profile_tracker, pose_pid, combiner, speed_pid, anti_blocking};
 
     /// @brief Reset all controllers in the chain
     void reset()
@@ -170,7 +198,7 @@ struct DualPIDTrackerChain
     }
 
     /// @brief Get the meta controller for use with MotorEngine
-    cogip::motion_control::MetaController<>* get_controller()
+    cogip::motion_control::BaseController* get_controller()
     {
         return &meta_controller;
     }
@@ -181,41 +209,8 @@ struct DualPIDTrackerChain
 /// @return A fully configured DualPIDTrackerChain instance
 inline DualPIDTrackerChain create_chain(const DualPIDTrackerChainParameters& params)
 {
-    // Create profile tracker parameters
-    cogip::motion_control::ProfileTrackerControllerParameters profile_params(
-        params.max_speed_mm_per_period, params.acceleration_mm_per_period2,
-        params.deceleration_mm_per_period2,
-        true, // must_stop_at_end
-        1     // period_increment
-    );
-
-    // Create pose PID parameters
-    cogip::motion_control::PosePIDControllerParameters pose_pid_params(params.pose_pid);
-
-    // Create combiner parameters (empty)
-    cogip::motion_control::TrackerCombinerControllerParameters combiner_params;
-
-    // Create speed PID parameters
-    cogip::motion_control::SpeedPIDControllerParameters speed_pid_params(params.speed_pid);
-
-    // Create the chain
-    DualPIDTrackerChain chain{
-        .profile_tracker = cogip::motion_control::ProfileTrackerController(profile_tracker_io_keys,
-                                                                           profile_params),
-        .pose_pid =
-            cogip::motion_control::PosePIDController(tracker_pose_pid_io_keys, pose_pid_params),
-        .combiner = cogip::motion_control::TrackerCombinerController(tracker_combiner_io_keys,
-                                                                     combiner_params),
-        .speed_pid =
-            cogip::motion_control::SpeedPIDController(tracker_speed_pid_io_keys, speed_pid_params),
-        .anti_blocking = cogip::motion_control::AntiBlockingController(anti_blocking_io_keys,
-                                                                       params.anti_blocking_params),
-        .meta_controller = {}};
-
-    // Initialize the chain
-    chain.init();
-
-    return chain;
+    // Guaranteed copy elision: the chain is created in place
+    return DualPIDTrackerChain(params);
 }
 
 } // namespace dualpid_tracker_chain
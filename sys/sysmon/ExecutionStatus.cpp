@@ -0,0 +1,23 @@
+// System includes
+
+// RIOT includes
+
+// Project includes
+#include "sysmon/ExecutionStatus.hpp"
+
+namespace cogip {
+
+namespace sysmon {
+
+void ExecutionStatus::update_pb_message()
+{
+    pb_message_.mutable_name() = name_.c_str();
+    pb_message_.set_count(count_);
+    pb_message_.set_min_ns(min_ns_);
+    pb_message_.set_mean_ns(mean_ns_);
+    pb_message_.set_max_ns(max_ns_);
+}
+
+} // namespace sysmon
+
+} // namespace cogip
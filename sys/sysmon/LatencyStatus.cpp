@@ -0,0 +1,91 @@
+// System includes
+#include <cstring>
+
+// RIOT includes
+
+// Project includes
+#include "sysmon/LatencyStatus.hpp"
+
+namespace cogip {
+
+namespace sysmon {
+
+/// Samples below this value have their own bucket
+constexpr uint32_t LINEAR_LIMIT = 4;
+
+LatencyStatus::LatencyStatus()
+{
+    memset(buckets_, 0, sizeof(buckets_));
+    count_ = 0;
+    max_ = 0;
+}
+
+size_t LatencyStatus::bucket(uint32_t us)
+{
+    if (us < LINEAR_LIMIT) {
+        return us;
+    }
+
+    // Power of two, then half within this power of two
+    const size_t exponent = 31 - __builtin_clz(us);
+    const size_t half = (us >> (exponent - 1)) & 1;
+    const size_t index = LINEAR_LIMIT + (exponent - 2) * 2 + half;
+
+    return (index < SYSMON_LATENCY_BUCKETS) ? index : SYSMON_LATENCY_BUCKETS - 1;
+}
+
+uint32_t LatencyStatus::bucket_upper_bound(size_t index)
+{
+    if (index < LINEAR_LIMIT) {
+        return index;
+    }
+
+    const size_t exponent = (index - LINEAR_LIMIT) / 2 + 2;
+    const size_t half = (index - LINEAR_LIMIT) % 2;
+    const uint32_t half_size = 1u << (exponent - 1);
+
+    return (1u << exponent) + (half + 1) * half_size - 1;
+}
+
+void LatencyStatus::add(uint32_t us)
+{
+    buckets_[bucket(us)]++;
+    count_++;
+    if (us > max_) {
+        max_ = us;
+    }
+}
+
+uint32_t LatencyStatus::percentile(uint32_t percent) const
+{
+    if (count_ == 0) {
+        return 0;
+    }
+
+    // Rank of the percentile sample, rounded up
+    const uint64_t rank = (static_cast<uint64_t>(count_) * percent + 99) / 100;
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < SYSMON_LATENCY_BUCKETS; i++) {
+        seen += buckets_[i];
+        if ((seen >= rank) && (seen > 0)) {
+            // Last bucket is unbounded, the maximum is also a tighter bound
+            const uint32_t upper = bucket_upper_bound(i);
+            return ((i == SYSMON_LATENCY_BUCKETS - 1) || (upper > max_)) ? max_ : upper;
+        }
+    }
+
+    return max_;
+}
+
+void LatencyStatus::update_pb_message(void)
+{
+    pb_message_.set_count(count_);
+    pb_message_.set_p50_us(percentile(50));
+    pb_message_.set_p99_us(percentile(99));
+    pb_message_.set_max_us(max_);
+}
+
+} // namespace sysmon
+
+} // namespace cogip
@@ -14,6 +14,10 @@ void ThreadStatus::update_pb_message()
 {
     stack_status_.update_pb_message();
     pb_message_.mutable_stack_status() = stack_status_.pb_message();
+    wakeup_lateness_.update_pb_message();
+    pb_message_.mutable_wakeup_lateness() = wakeup_lateness_.pb_message();
+    compute_time_.update_pb_message();
+    pb_message_.mutable_compute_time() = compute_time_.pb_message();
 
     pb_message_.set_pid(pid_);
     pb_message_.mutable_name() = name_.c_str();
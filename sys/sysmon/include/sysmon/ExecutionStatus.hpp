@@ -0,0 +1,111 @@
+///
+/// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+///
+/// This file is subject to the terms and conditions of the GNU Lesser
+/// General Public License v2.1. See the file LICENSE in the top level
+/// directory for more details.
+///
+///
+///
+/// @defgroup    sys_sysmon System monitoring
+/// @ingroup     sys
+/// @brief       System monitoring module
+///              Module used to monitor memory (thread stacks, heap and
+///              overall).
+///
+/// @{
+/// @file
+/// @brief       Execution time status of a monitored code section
+///
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+///
+
+// RIOT includes
+#include <etl/string.h>
+
+// Project includes
+#include "MemoryStatus.hpp"
+#include "PB_ExecutionStatus.hpp"
+
+#pragma once
+
+#ifndef SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH
+#define SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH 48
+#endif
+
+#ifndef SYSMON_EXECUTIONS_MAX
+#define SYSMON_EXECUTIONS_MAX 32
+#endif
+
+namespace cogip {
+
+namespace sysmon {
+
+class ExecutionStatus
+    : public StatusBase<PB_ExecutionStatus<SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH>>
+{
+
+  public:
+    /// Constructor
+    ExecutionStatus() : count_(0), min_ns_(0), mean_ns_(0), max_ns_(0){};
+
+    /// Get monitored section name
+    const etl::string<SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH>& name() const
+    {
+        return name_;
+    };
+    /// Get number of executions
+    uint32_t count() const
+    {
+        return count_;
+    };
+    /// Get minimum execution time in nanoseconds
+    uint32_t min_ns() const
+    {
+        return min_ns_;
+    };
+    /// Get mean execution time in nanoseconds
+    uint32_t mean_ns() const
+    {
+        return mean_ns_;
+    };
+    /// Get maximum execution time in nanoseconds
+    uint32_t max_ns() const
+    {
+        return max_ns_;
+    };
+    /// Set monitored section name
+    void set_name(const char* name)
+    {
+        name_ = name;
+    };
+    /// Set execution times
+    void set_times(uint32_t count, uint32_t min_ns, uint32_t mean_ns, uint32_t max_ns)
+    {
+        count_ = count;
+        min_ns_ = min_ns;
+        mean_ns_ = mean_ns;
+        max_ns_ = max_ns;
+    };
+
+    /// Update Protobuf message
+    void update_pb_message() override;
+
+  private:
+    /// Monitored section name
+    etl::string<SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH> name_;
+    /// Number of executions
+    uint32_t count_;
+    /// Minimum execution time in nanoseconds
+    uint32_t min_ns_;
+    /// Mean execution time in nanoseconds
+    uint32_t mean_ns_;
+    /// Maximum execution time in nanoseconds
+    uint32_t max_ns_;
+};
+
+} // namespace sysmon
+
+} // namespace cogip
+
+/// @}
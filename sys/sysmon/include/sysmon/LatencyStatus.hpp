@@ -0,0 +1,96 @@
+///
+/// Copyright (C) 2025 COGIP Robotics association <cogip35@gmail.com>
+///
+/// This file is subject to the terms and conditions of the GNU Lesser
+/// General Public License v2.1. See the file LICENSE in the top level
+/// directory for more details.
+///
+///
+///
+/// @defgroup    sys_sysmon System monitoring
+/// @ingroup     sys
+/// @brief       System monitoring module
+///              Module used to monitor memory (thread stacks, heap and
+///              overall).
+///
+/// @{
+/// @file
+/// @brief       Latency distribution of a periodic thread
+///
+/// @author      Gilles DOFFE <g.doffe@gmail.com>
+///
+
+// System includes
+#include <cstddef>
+#include <cstdint>
+
+// Project includes
+#include "MemoryStatus.hpp"
+#include "PB_LatencyStatus.hpp"
+
+#pragma once
+
+/// Number of histogram buckets, the last one gathers all larger samples
+#ifndef SYSMON_LATENCY_BUCKETS
+#define SYSMON_LATENCY_BUCKETS 32
+#endif
+
+namespace cogip {
+
+namespace sysmon {
+
+/// Fixed-bucket histogram of durations in microseconds
+///
+/// Buckets are log-linear: samples below 4 us have their own bucket, then
+/// each power of two is split in two buckets. Percentiles are therefore
+/// given with a 25 to 50% resolution, which is enough to size periods and
+/// priorities, with constant time insertion and a few hundred bytes per
+/// thread. With 32 buckets, samples up to 65535 us are distinguished.
+class LatencyStatus : public StatusBase<PB_LatencyStatus>
+{
+
+  public:
+    /// Constructor
+    LatencyStatus();
+
+    /// Add a sample
+    /// @param  us              Duration in microseconds
+    void add(uint32_t us);
+
+    /// Get number of samples
+    uint32_t count() const
+    {
+        return count_;
+    };
+    /// Get maximum sample in microseconds
+    uint32_t max() const
+    {
+        return max_;
+    };
+    /// Get a percentile in microseconds
+    /// @param  percent         Percentage of samples below the returned value
+    /// @return Upper bound of the bucket containing the percentile, 0 without samples
+    uint32_t percentile(uint32_t percent) const;
+
+    /// Update Protobuf message
+    void update_pb_message() override;
+
+  private:
+    /// Bucket index of a sample
+    static size_t bucket(uint32_t us);
+    /// Largest sample of a bucket
+    static uint32_t bucket_upper_bound(size_t index);
+
+    /// Samples count per bucket
+    uint32_t buckets_[SYSMON_LATENCY_BUCKETS];
+    /// Total number of samples
+    uint32_t count_;
+    /// Maximum sample
+    uint32_t max_;
+};
+
+} // namespace sysmon
+
+} // namespace cogip
+
+/// @}
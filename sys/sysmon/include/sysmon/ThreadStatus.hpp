@@ -24,6 +24,7 @@
 #include <etl/string.h>
 
 // Project includes
+#include "LatencyStatus.hpp"
 #include "MemoryStatus.hpp"
 #include "PB_ThreadStatus.hpp"
 #ifdef MODULE_CANPB
@@ -116,6 +117,27 @@ class ThreadStatus : public StatusBase<PB_ThreadStatus<SYSMON_THREADSTATUS_NAME_
         stack_status_.set_used(used);
     };
 
+    /// Add a wake-up lateness sample in microseconds
+    void add_wakeup_lateness(const uint32_t us)
+    {
+        wakeup_lateness_.add(us);
+    };
+    /// Add a compute time sample in microseconds
+    void add_compute_time(const uint32_t us)
+    {
+        compute_time_.add(us);
+    };
+    /// Get wake-up lateness distribution
+    const LatencyStatus& wakeup_lateness() const
+    {
+        return wakeup_lateness_;
+    };
+    /// Get compute time distribution
+    const LatencyStatus& compute_time() const
+    {
+        return compute_time_;
+    };
+
     /// Update Protobuf message
     void update_pb_message() override;
 
@@ -130,6 +152,10 @@ class ThreadStatus : public StatusBase<PB_ThreadStatus<SYSMON_THREADSTATUS_NAME_
     uint32_t overshots_;
     /// Stack memory status
     MemoryStatus stack_status_;
+    /// Delay between scheduled and actual period start
+    LatencyStatus wakeup_lateness_;
+    /// Time spent from period start to next wake-up request
+    LatencyStatus compute_time_;
 };
 
 /// Display heap memory status
@@ -35,12 +35,27 @@ namespace sysmon {
 void display_heap_status();
 /// Display each thread status
 void display_threads_status();
+/// Display each monitored execution time status
+void display_executions_status();
 /// Start system monitoring thread
 void sysmon_start();
 /// Update threads scheduling status
 /// @param  pid             Thread pid
 /// @param  has_overshot    Period overshot
-void update_thread_sched_status(kernel_pid_t pid, bool has_overshot);
+/// @param  lateness_us     Delay between scheduled and actual period start, in microseconds
+/// @param  compute_us      Time spent in the period before waiting for the next one, in
+///                         microseconds
+void update_thread_sched_status(kernel_pid_t pid, bool has_overshot, uint32_t lateness_us,
+                                uint32_t compute_us);
+/// Update execution time status of a monitored code section
+/// @param  index           Section index, below SYSMON_EXECUTIONS_MAX
+/// @param  name            Section name
+/// @param  count           Number of executions
+/// @param  min_ns          Minimum execution time in nanoseconds
+/// @param  mean_ns         Mean execution time in nanoseconds
+/// @param  max_ns          Maximum execution time in nanoseconds
+void update_execution_status(size_t index, const char* name, uint32_t count, uint32_t min_ns,
+                             uint32_t mean_ns, uint32_t max_ns);
 
 #ifdef MODULE_CANPB
 /// Register canpb serial interface for messaging
@@ -4,6 +4,7 @@
 #include <malloc.h>
 
 // RIOT includes
+#include <etl/array.h>
 #include <etl/map.h>
 #include <etl/pool.h>
 #include <thread.h>
@@ -13,6 +14,7 @@
 // Project includes
 #include "PB_Sysmon.hpp"
 #include "heap_private.hpp"
+#include "sysmon/ExecutionStatus.hpp"
 #include "sysmon/ThreadStatus.hpp"
 #include "sysmon/sysmon.hpp"
 #include "thread/thread.hpp"
@@ -37,7 +39,8 @@ namespace cogip {
 
 namespace sysmon {
 
-using PB_Sysmon_Message = PB_Sysmon<MAXTHREADS, SYSMON_THREADSTATUS_NAME_MAX_LENGTH>;
+using PB_Sysmon_Message = PB_Sysmon<MAXTHREADS, SYSMON_THREADSTATUS_NAME_MAX_LENGTH,
+                                    SYSMON_EXECUTIONS_MAX, SYSMON_EXECUTIONSTATUS_NAME_MAX_LENGTH>;
 // Sysmon Protobuf message
 static PB_Sysmon_Message pb_sysmon_message_;
 
@@ -49,6 +52,8 @@ inline static cogip::canpb::CanProtobuf* can_protobuf = nullptr;
 static etl::pool<ThreadStatus, MAXTHREADS> threads_status_pool;
 static etl::map<kernel_pid_t, ThreadStatus*, MAXTHREADS> _sysmon_threads_status;
 static MemoryStatus _sysmon_heap_status;
+static etl::array<ExecutionStatus, SYSMON_EXECUTIONS_MAX> _sysmon_executions_status;
+static size_t _sysmon_executions_status_count = 0;
 
 // Thread stack
 static char _sysmon_updater_thread_stack[THREAD_STACKSIZE_SMALL];
@@ -123,7 +128,8 @@ static void _update_threads_status(void)
     }
 }
 
-void update_thread_sched_status(kernel_pid_t pid, bool has_overshot)
+void update_thread_sched_status(kernel_pid_t pid, bool has_overshot, uint32_t lateness_us,
+                                uint32_t compute_us)
 {
     mutex_lock(&_mutex_sysmon);
 
@@ -137,6 +143,57 @@ void update_thread_sched_status(kernel_pid_t pid, bool has_overshot)
         _sysmon_threads_status[pid]->inc_overshots();
     }
 
+    _sysmon_threads_status[pid]->add_wakeup_lateness(lateness_us);
+    _sysmon_threads_status[pid]->add_compute_time(compute_us);
+
+    mutex_unlock(&_mutex_sysmon);
+}
+
+void update_execution_status(size_t index, const char* name, uint32_t count, uint32_t min_ns,
+                             uint32_t mean_ns, uint32_t max_ns)
+{
+    if (index >= SYSMON_EXECUTIONS_MAX) {
+        return;
+    }
+
+    mutex_lock(&_mutex_sysmon);
+
+    _sysmon_executions_status[index].set_name(name);
+    _sysmon_executions_status[index].set_times(count, min_ns, mean_ns, max_ns);
+    if (index >= _sysmon_executions_status_count) {
+        _sysmon_executions_status_count = index + 1;
+    }
+
+    mutex_unlock(&_mutex_sysmon);
+}
+
+/// Update execution time status
+static void _update_executions_status(void)
+{
+    mutex_lock(&_mutex_sysmon);
+
+    for (size_t i = 0; i < _sysmon_executions_status_count; i++) {
+        // Update execution status Protobuf message
+        _sysmon_executions_status[i].update_pb_message();
+        // Add execution status message to sysmon overall Protobuf message
+        pb_sysmon_message_.add_executions_status(_sysmon_executions_status[i].pb_message());
+    }
+
+    mutex_unlock(&_mutex_sysmon);
+}
+
+void display_executions_status(void)
+{
+    mutex_lock(&_mutex_sysmon);
+
+    for (size_t i = 0; i < _sysmon_executions_status_count; i++) {
+        const ExecutionStatus& status = _sysmon_executions_status[i];
+        LOG_INFO("%s: min/mean/max = %" PRIu32 "/%" PRIu32 "/%" PRIu32 " ns (%" PRIu32
+                 " executions)\n",
+                 status.name().c_str(), status.min_ns(), status.mean_ns(), status.max_ns(),
+                 status.count());
+    }
+
     mutex_unlock(&_mutex_sysmon);
 }
 
@@ -158,6 +215,15 @@ void display_threads_status(void)
             LOG_INFO("  overshots  = %" PRIu32 "\n",
                      static_cast<uint32_t>(_sysmon_threads_status[i]->overshots()));
 
+            const LatencyStatus& lateness = _sysmon_threads_status[i]->wakeup_lateness();
+            LOG_INFO("  lateness   = p50 %" PRIu32 " us, p99 %" PRIu32 " us, max %" PRIu32
+                     " us\n",
+                     lateness.percentile(50), lateness.percentile(99), lateness.max());
+            const LatencyStatus& compute = _sysmon_threads_status[i]->compute_time();
+            LOG_INFO("  compute    = p50 %" PRIu32 " us, p99 %" PRIu32 " us, max %" PRIu32
+                     " us\n",
+                     compute.percentile(50), compute.percentile(99), compute.max());
+
             mutex_unlock(&_mutex_sysmon);
         }
     }
@@ -167,6 +233,7 @@ void update_status(void)
 {
     _update_heap_status();
     _update_threads_status();
+    _update_executions_status();
 }
 
 #ifdef MODULE_CANPB
@@ -189,12 +256,13 @@ static void* _thread_status_updater(void* data)
 {
     (void)data;
 
-    ztimer_now_t loop_start_time = ztimer_now(ZTIMER_SEC);
+    ztimer_now_t loop_start_time = cogip::thread::thread_ztimer_now(ZTIMER_SEC);
 
     while (true) {
         pb_sysmon_message_.clear();
         _update_heap_status();
         _update_threads_status();
+        _update_executions_status();
 #ifdef MODULE_CANPB
         _canpb_send_status();
 #endif
@@ -30,11 +30,38 @@ namespace cogip {
 namespace thread {
 
 /// Wrapper to RIOT ztimer_periodic_wakeup()
+/// With sysmon, also records the thread period overshots, wake-up lateness
+/// and compute time.
+///
+/// With the thread_virtual_time module (native boards only), periods are
+/// counted in virtual time instead: once every thread that waited for a
+/// period is waiting again and no other thread is ready, virtual time jumps
+/// to the earliest deadline and the threads reaching it are woken up
+/// together, then run by priority. Periodic threads thus run as fast as the
+/// CPU allows, with the same wake-up order as in real time, and never
+/// overshoot. Sysmon scheduling statistics are not recorded in this mode.
+/// @note In virtual time, a periodic thread must keep calling this function:
+///       virtual time stops while it is running or blocked elsewhere.
 /// @param  clock           ztimer clock to operate on
 /// @param  last_wakeup     base time stamp for the wakeup
 /// @param  period          time in ticks that will be added to last_wakeup
 void thread_ztimer_periodic_wakeup(ztimer_clock_t* clock, uint32_t* last_wakeup, uint32_t period);
 
+/// Align a wake-up time stamp on the period boundaries of its clock, so that
+/// threads sharing a period wake up with a fixed phase between them, even
+/// after a period overshoot.
+/// @param  time            wake-up time stamp, in clock ticks
+/// @param  period          period, in clock ticks
+/// @param  lead            ticks to wake up ahead of the period boundaries
+/// @return Latest time stamp not after time, lead ticks before a period boundary
+uint32_t thread_align_wakeup(uint32_t time, uint32_t period, uint32_t lead = 0);
+
+/// Current time of a clock, as seen by thread_ztimer_periodic_wakeup()
+/// Virtual time with the thread_virtual_time module, ztimer_now() otherwise.
+/// @param  clock           ztimer clock to operate on
+/// @return Current time in clock ticks
+uint32_t thread_ztimer_now(ztimer_clock_t* clock);
+
 } // namespace thread
 
 } // namespace cogip
@@ -4,7 +4,11 @@
 
 // RIOT includes
 #include <irq.h>
+#ifdef MODULE_THREAD_VIRTUAL_TIME
+#include <mutex.h>
+#endif
 #include <thread.h>
+#include <time_units.h>
 #include <ztimer.h>
 
 // Project includes
@@ -17,32 +21,221 @@ namespace cogip {
 
 namespace thread {
 
+#if defined(MODULE_SYSMON) && !defined(MODULE_THREAD_VIRTUAL_TIME)
+/// Actual start time of the current period of each thread, in its clock ticks
+static uint32_t _period_start[KERNEL_PID_LAST + 1];
+/// Whether _period_start is known, false before the first wake-up
+static bool _period_start_known[KERNEL_PID_LAST + 1];
+#endif
+
+#if defined(MODULE_SYSMON) || defined(MODULE_THREAD_VIRTUAL_TIME)
+/// Convert ticks of a ztimer clock to microseconds
+static uint32_t _ticks_to_us(ztimer_clock_t* clock, uint32_t ticks)
+{
+#ifdef MODULE_ZTIMER_SEC
+    if (clock == ZTIMER_SEC) {
+        return ticks * US_PER_SEC;
+    }
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+    if (clock == ZTIMER_MSEC) {
+        return ticks * US_PER_MS;
+    }
+#endif
+    (void)clock;
+    return ticks;
+}
+#endif
+
+#ifdef MODULE_THREAD_VIRTUAL_TIME
+/// Periodic thread state in virtual time
+struct VirtualWakeup
+{
+    bool registered;      ///< Thread waited for a period at least once
+    bool waiting;         ///< Thread waits for its deadline
+    uint64_t deadline_us; ///< Virtual time of the thread next wake-up
+    mutex_t wakeup;       ///< Locked by the waiting thread, unlocked to wake it up
+};
+
+/// Virtual time, in microseconds
+static uint64_t _virtual_now_us;
+/// Virtual time state of each thread
+static VirtualWakeup _virtual_wakeups[KERNEL_PID_LAST + 1];
+/// Unlocked each time a periodic thread starts waiting
+static mutex_t _virtual_clock_ready = MUTEX_INIT_LOCKED;
+/// Virtual clock thread stack
+static char _virtual_clock_stack[THREAD_STACKSIZE_DEFAULT];
+/// Virtual clock thread started
+static bool _virtual_clock_started;
+
+/// Convert microseconds to ticks of a ztimer clock
+static uint32_t _us_to_ticks(ztimer_clock_t* clock, uint64_t us)
+{
+#ifdef MODULE_ZTIMER_SEC
+    if (clock == ZTIMER_SEC) {
+        return static_cast<uint32_t>(us / US_PER_SEC);
+    }
+#endif
+#ifdef MODULE_ZTIMER_MSEC
+    if (clock == ZTIMER_MSEC) {
+        return static_cast<uint32_t>(us / US_PER_MS);
+    }
+#endif
+    (void)clock;
+    return static_cast<uint32_t>(us);
+}
+
+/// Advance virtual time to the earliest deadline if every periodic thread
+/// waits, then wake up the threads reaching their deadline
+static void _virtual_time_advance()
+{
+    uint64_t next_us = UINT64_MAX;
+
+    unsigned state = irq_disable();
+    for (const VirtualWakeup& wakeup : _virtual_wakeups) {
+        if (!wakeup.registered) {
+            continue;
+        }
+        if (!wakeup.waiting) {
+            irq_restore(state);
+            return;
+        }
+        if (wakeup.deadline_us < next_us) {
+            next_us = wakeup.deadline_us;
+        }
+    }
+    if (next_us != UINT64_MAX) {
+        _virtual_now_us = next_us;
+        // Release all threads reaching their deadline before any of them
+        // runs: context switches are deferred while interrupts are disabled
+        for (VirtualWakeup& wakeup : _virtual_wakeups) {
+            if (wakeup.registered && wakeup.waiting && (wakeup.deadline_us <= next_us)) {
+                wakeup.waiting = false;
+                mutex_unlock(&wakeup.wakeup);
+            }
+        }
+    }
+    irq_restore(state);
+
+    // The scheduler then runs the woken up threads by priority, each one
+    // preempting this one until it waits again, as after a real timer tick
+    thread_yield_higher();
+}
+
+/// Virtual clock thread: runs when every other thread is blocked, that is
+/// when the CPU would be idle until the next periodic wake-up
+static void* _virtual_clock_thread(void* arg)
+{
+    (void)arg;
+
+    while (true) {
+        mutex_lock(&_virtual_clock_ready);
+        _virtual_time_advance();
+    }
+
+    return nullptr;
+}
+
+/// Periodic wake-up in virtual time
+static void _virtual_periodic_wakeup(ztimer_clock_t* clock, uint32_t* last_wakeup,
+                                     uint32_t period)
+{
+    VirtualWakeup& wakeup = _virtual_wakeups[thread_getpid()];
+
+    const uint32_t period_us = _ticks_to_us(clock, period);
+
+    unsigned state = irq_disable();
+    const bool start_clock = !_virtual_clock_started;
+    _virtual_clock_started = true;
+    if (!wakeup.registered) {
+        // Keep the phase of the caller base time stamp (see thread_align_wakeup()),
+        // so that threads phased against each other keep their wake-up order:
+        // the first deadline is one period after the last time in phase with it
+        const uint32_t lag = (_us_to_ticks(clock, _virtual_now_us) - *last_wakeup) % period;
+        const uint64_t now_us = _virtual_now_us - (_virtual_now_us % _ticks_to_us(clock, 1));
+        wakeup.registered = true;
+        wakeup.deadline_us = now_us + (period_us - _ticks_to_us(clock, lag));
+        mutex_trylock(&wakeup.wakeup);
+    } else {
+        wakeup.deadline_us += period_us;
+    }
+    wakeup.waiting = true;
+    irq_restore(state);
+
+    if (start_clock) {
+        thread_create(_virtual_clock_stack, sizeof(_virtual_clock_stack), THREAD_PRIORITY_IDLE - 1,
+                      THREAD_CREATE_STACKTEST, _virtual_clock_thread, nullptr, "virtual_clock");
+    }
+    mutex_unlock(&_virtual_clock_ready);
+    mutex_lock(&wakeup.wakeup);
+
+    *last_wakeup = _us_to_ticks(clock, wakeup.deadline_us);
+}
+#endif
+
+uint32_t thread_align_wakeup(uint32_t time, uint32_t period, uint32_t lead)
+{
+    const uint32_t shifted = time + lead;
+    return time - (shifted % period);
+}
+
+uint32_t thread_ztimer_now(ztimer_clock_t* clock)
+{
+#ifdef MODULE_THREAD_VIRTUAL_TIME
+    unsigned state = irq_disable();
+    uint32_t now = _us_to_ticks(clock, _virtual_now_us);
+    irq_restore(state);
+    return now;
+#else
+    return ztimer_now(clock);
+#endif
+}
+
 void thread_ztimer_periodic_wakeup(ztimer_clock_t* clock, uint32_t* last_wakeup, uint32_t period)
 {
+#ifdef MODULE_THREAD_VIRTUAL_TIME
+    _virtual_periodic_wakeup(clock, last_wakeup, period);
+#else
     unsigned state = irq_disable();
     uint32_t now = ztimer_now(clock);
     uint32_t target = *last_wakeup + period;
     int64_t offset = (int64_t)target - (int64_t)now;
 #ifdef MODULE_SYSMON
     bool has_overshot = false;
+    uint32_t lateness = 0;
 #endif
     kernel_pid_t pid = thread_getpid();
 
     irq_restore(state);
 
+#ifdef MODULE_SYSMON
+    // Before the first wake-up, the period started at the caller base time stamp
+    uint32_t compute = now - (_period_start_known[pid] ? _period_start[pid] : *last_wakeup);
+#endif
+
     if (now <= target) {
         ztimer_sleep(clock, (uint32_t)offset);
         *last_wakeup = target;
+#ifdef MODULE_SYSMON
+        _period_start[pid] = ztimer_now(clock);
+        lateness = _period_start[pid] - target;
+#endif
     } else {
         *last_wakeup = now;
 #ifdef MODULE_SYSMON
         has_overshot = true;
+        // Next period starts right now instead of target
+        _period_start[pid] = now;
+        lateness = now - target;
 #endif
         LOG_WARNING("Thread '%s' latency: %d\n", thread_getname(pid), static_cast<int>(offset));
     }
 
 #ifdef MODULE_SYSMON
-    cogip::sysmon::update_thread_sched_status(pid, has_overshot);
+    _period_start_known[pid] = true;
+    cogip::sysmon::update_thread_sched_status(pid, has_overshot, _ticks_to_us(clock, lateness),
+                                              _ticks_to_us(clock, compute));
+#endif
 #endif
 }
 